@@ -51,4 +51,11 @@ MM_ConcurrentMarkingDelegate::collectRoots(MM_EnvironmentBase *env, uintptr_t co
 
 	return bytesScanned;
 }
+
+void
+MM_ConcurrentMarkingDelegate::acquireExclusiveVMAccessAndSignalThreadsToActivateWriteBarrier(MM_EnvironmentBase *env)
+{
+	/* The example barriers are always called, so starting the concurrent phase is all that is needed */
+	_collector->acquireExclusiveVMAccessAndSignalThreadsToActivateWriteBarrier(env);
+}
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
@@ -207,9 +207,10 @@ public:
 	}
 
 	/**
-	 * Firstly acquire exclusive VM access, and then signal threads to activate WB.
+	 * Firstly acquire exclusive VM access, and then signal threads to activate WB. Called from a safe point
+	 * when optimizeConcurrentWB is enabled, which the snapshot-at-the-beginning barrier requires.
 	 */
-	void acquireExclusiveVMAccessAndSignalThreadsToActivateWriteBarrier(MM_EnvironmentBase *env) {}
+	void acquireExclusiveVMAccessAndSignalThreadsToActivateWriteBarrier(MM_EnvironmentBase *env);
 
 	/**
 	 * This can be used to optimize the concurrent write barrier(s) by conditioning threads to stop
@@ -39,6 +39,19 @@ private:
 protected:
 
 public:
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	/**
+	 * The example language has no reference objects, so its buffer of discovered reference objects is always empty.
+	 */
+	class ReferenceObjectBuffer
+	{
+	public:
+		bool isEmpty() { return true; }
+	};
+
+	ReferenceObjectBuffer _emptyReferenceObjectBuffer;
+	ReferenceObjectBuffer *_referenceObjectBuffer; /**< checked by the scavenger before a mutator thread pays allocation tax */
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
 
 	/* Function members */
 private:
@@ -46,7 +59,11 @@ private:
 protected:
 
 public:
-	GC_Environment() {}
+	GC_Environment()
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+		: _referenceObjectBuffer(&_emptyReferenceObjectBuffer)
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+	{}
 };
 
 /***
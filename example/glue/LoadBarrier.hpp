@@ -0,0 +1,135 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#ifndef LOADBARRIER_HPP_
+#define LOADBARRIER_HPP_
+
+#include "omrcfg.h"
+#include "objectdescription.h"
+
+#include "EnvironmentStandard.hpp"
+#include "GCExtensionsBase.hpp"
+#include "SlotObject.hpp"
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+#include "ForwardedHeader.hpp"
+#include "Scavenger.hpp"
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+
+struct OMR_VMThread;
+
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+/**
+ * Out-of-line part of the load barrier, taken when a reference loaded during the concurrent phase of a scavenge
+ * points into evacuate space. The referenced object is copied, or its existing copy is located, and the reference
+ * is updated to point to the copy so that later loads of the same reference take the fast path (self-healing).
+ *
+ * @param env The environment for the thread loading the reference
+ * @param object The reference that was loaded, in evacuate space
+ * @param slotObject The heap slot the reference was loaded from, or NULL if loaded from referencePtr
+ * @param referencePtr Points to the reference, if it is held outside the heap
+ */
+MMINLINE void
+loadBarrierSlowPath(MM_EnvironmentStandard *env, omrobjectptr_t object, GC_SlotObject *slotObject, omrobjectptr_t *referencePtr)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_Scavenger *scavenger = extensions->scavenger;
+
+	if (!MM_ForwardedHeader(object, extensions->compressObjectReferences()).isForwardedPointer()) {
+		env->_scavengerStats._readObjectBarrierCopy += 1;
+	}
+	env->_scavengerStats._readObjectBarrierUpdate += 1;
+
+	if (NULL != slotObject) {
+		scavenger->copyObjectSlot(env, slotObject);
+	} else {
+		scavenger->copyObjectSlot(env, (volatile omrobjectptr_t *)referencePtr);
+	}
+
+	/* Example mutator threads do not take async callbacks, so a pending request to flush copy caches is honoured here */
+	if (scavenger->getDelegate()->isFlushCachesRequested()) {
+		scavenger->threadReleaseCaches(env, env, true, false);
+	}
+}
+
+/**
+ * Fast path test of the load barrier: a test of the scavenger concurrent state followed by a range check of the
+ * loaded reference against evacuate space.
+ */
+MMINLINE bool
+isLoadBarrierRequired(MM_GCExtensionsBase *extensions, omrobjectptr_t object)
+{
+	return extensions->concurrentScavenger
+			&& extensions->scavenger->isConcurrentCycleInProgress()
+			&& extensions->scavenger->isObjectInEvacuateMemory(object);
+}
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+
+/**
+ * Software load barrier. In the absence of other (equivalent inline or hardware assisted) read barrier, this
+ * method must be used to load a reference from a heap slot whenever the concurrent scavenger is enabled, so that
+ * mutator threads never observe a reference to an object that has been, or is about to be, evacuated.
+ *
+ * The barrier is portable: it requires no memory protection or guarded load support.
+ *
+ * @param omrThread The thread loading the reference
+ * @param slot Points to the heap slot to load from
+ * @return the loaded reference
+ * @see standardWriteBarrierStore(OMR_VMThread *, omrobjectptr_t, fomrobject_t *, omrobjectptr_t)
+ */
+MMINLINE omrobjectptr_t
+loadBarrier(OMR_VMThread *omrThread, fomrobject_t *slot)
+{
+	GC_SlotObject slotObject(omrThread->_vm, slot);
+	omrobjectptr_t object = slotObject.readReferenceFromSlot();
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	MM_EnvironmentStandard *env = MM_EnvironmentStandard::getEnvironment(omrThread);
+	if (isLoadBarrierRequired(env->getExtensions(), object)) {
+		loadBarrierSlowPath(env, object, &slotObject, NULL);
+		object = slotObject.readReferenceFromSlot();
+	}
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+	return object;
+}
+
+/**
+ * Software load barrier for a reference held outside the heap in a location that is not scanned as a root, for
+ * example an entry in a weak table. If the concurrent scavenger is evacuating the referenced object, the object is
+ * copied and the reference is updated, so that the object survives the cycle in which it was handed out.
+ *
+ * @param omrThread The thread loading the reference
+ * @param referencePtr Points to the reference to load, owned by the calling thread
+ * @return the loaded reference
+ */
+MMINLINE omrobjectptr_t
+loadBarrierOffHeap(OMR_VMThread *omrThread, omrobjectptr_t *referencePtr)
+{
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	MM_EnvironmentStandard *env = MM_EnvironmentStandard::getEnvironment(omrThread);
+	if (isLoadBarrierRequired(env->getExtensions(), *referencePtr)) {
+		loadBarrierSlowPath(env, *referencePtr, NULL, referencePtr);
+	}
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+	return *referencePtr;
+}
+
+#endif /* LOADBARRIER_HPP_ */
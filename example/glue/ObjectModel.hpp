@@ -67,6 +67,21 @@ public:
 	 */
 	virtual void tearDown(MM_GCExtensionsBase *extensions) {}
 
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	/**
+	 * Determine the consumed size of an object as it was before it was copied. Example objects do not
+	 * grow when they are moved, so this is the consumed size of the copy.
+	 *
+	 * @param[in] objectPtr points to the copied object
+	 * @return the total size of the original object, in bytes, including padding bytes
+	 */
+	MMINLINE uintptr_t
+	getConsumedSizeInBytesWithHeaderBeforeMove(omrobjectptr_t objectPtr)
+	{
+		return getConsumedSizeInBytesWithHeader(objectPtr);
+	}
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+
 	/**
 	 * Constructor.
 	 */
@@ -38,6 +38,13 @@ GC_ObjectModelDelegate::initializeAllocation(MM_EnvironmentBase *env, void *allo
 	return objectPtr;
 }
 
+void
+GC_ObjectModelDelegate::initializeMinimumSizeObject(MM_EnvironmentBase *env, void *allocAddr)
+{
+	memset(allocAddr, 0, OMR_MINIMUM_OBJECT_SIZE);
+	((omrobjectptr_t)allocAddr)->header.sizeInBytes(OMR_MINIMUM_OBJECT_SIZE);
+}
+
 #if defined(OMR_GC_MODRON_SCAVENGER)
 void
 GC_ObjectModelDelegate::calculateObjectDetailsForCopy(MM_EnvironmentBase *env, MM_ForwardedHeader *forwardedHeader, uintptr_t *objectCopySizeInBytes, uintptr_t *reservedObjectSizeInBytes, uintptr_t *hotFieldAlignmentDescriptor)
@@ -221,6 +221,35 @@ public:
 	{
 		return U_8_MAX;
 	}
+
+#if defined(OMR_GC_AUTO_HOT_FIELDS)
+	/**
+	 * Returns an identity shared by all objects with the same layout of reference fields, used to learn hot
+	 * fields at runtime when the language does not supply them (see scavengerAutoHotFields). Objects in the
+	 * example have no type information, so objects of the same size are assumed to share their layout; objects
+	 * of different types but equal size share what is learned.
+	 *
+	 * @param objectPtr pointer to the object
+	 * @return the shape of the object, or 0 if hot fields should not be learned for the object
+	 */
+	MMINLINE uintptr_t
+	getObjectShape(omrobjectptr_t objectPtr)
+	{
+		return getObjectSizeInBytesWithHeader(objectPtr);
+	}
+
+	/**
+	 * Returns the shape of the object referred to by the forwarded header, see getObjectShape(omrobjectptr_t).
+	 *
+	 * @param forwardedHeader pointer to the MM_ForwardedHeader instance encapsulating the object
+	 * @return the shape of the object, or 0 if hot fields should not be learned for the object
+	 */
+	MMINLINE uintptr_t
+	getObjectShape(MM_ForwardedHeader *forwardedHeader)
+	{
+		return getForwardedObjectSizeInBytes(forwardedHeader);
+	}
+#endif /* defined(OMR_GC_AUTO_HOT_FIELDS) */
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC) */
 
 	/**
@@ -285,8 +314,14 @@ public:
 	void calculateObjectDetailsForCopy(MM_EnvironmentBase *env, MM_ForwardedHeader *forwardedHeader, uintptr_t *objectCopySizeInBytes, uintptr_t *objectReserveSizeInBytes, uintptr_t *hotFieldAlignmentDescriptor);
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 
-	MMINLINE void
-	initializeMinimumSizeObject(MM_EnvironmentBase *env, void *allocAddr) {}
+	/**
+	 * Initialize an object of OMR_MINIMUM_OBJECT_SIZE bytes with no references at allocAddr. Used to seal
+	 * a thread local heap while the snapshot-at-the-beginning barrier is active.
+	 *
+	 * @param[in] env points to the environment for the calling thread
+	 * @param[in] allocAddr address of the OMR_MINIMUM_OBJECT_SIZE bytes to initialize
+	 */
+	void initializeMinimumSizeObject(MM_EnvironmentBase *env, void *allocAddr);
 
 	/**
 	 * Constructor receives a copy of OMR's object flags mask, normalized to low order byte.
@@ -28,6 +28,7 @@
 
 void ex_omr_checkSampleStack(OMR_VMThread *omrVMThread, const void *context);
 void ex_omr_insertMethodEntryInMethodDictionary(OMR_VM *omrVM, const void *method);
+void ex_omr_sampleAllocation(OMR_VMThread *omrVMThread, const void *context);
 
 static void ex_omr_sampleStack(OMR_VMThread *omrVMThread, const void *context);
 
@@ -118,6 +119,27 @@ ex_omr_checkSampleStack(OMR_VMThread *omrVMThread, const void *context)
 	}
 }
 
+/**
+ * This is an example of how the language runtime can attribute allocation samples to methods.
+ *
+ * This function should be called from the language's J9HOOK_MM_OMR_ALLOCATION_SAMPLE listener,
+ * passing the event's currentThread. The GC sets the allocating thread's _allocationSampleBytes
+ * for the duration of the event, and omr_ras_sampleStackTraceStart() charges those bytes to the
+ * method of the top-most stack frame. Unlike ex_omr_checkSampleStack(), the stack is walked whether
+ * or not the sampling tracepoints are enabled. The listener runs on the allocating thread, so it
+ * must not allocate from the heap.
+ *
+ * This function is only an example, and may be completely customized by the language runtime. It
+ * may be omitted if allocation profiling is not implemented.
+ */
+void
+ex_omr_sampleAllocation(OMR_VMThread *omrVMThread, const void *context)
+{
+	if (0 != omrVMThread->_allocationSampleBytes) {
+		ex_omr_sampleStack(omrVMThread, context);
+	}
+}
+
 /**
  * This is an example of how the language runtime can insert a method entry into the method
  * dictionary.
@@ -186,6 +186,20 @@ MM_ScavengerDelegate::reverseForwardedObject(MM_EnvironmentBase *env, MM_Forward
 	}
 }
 
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+void
+MM_ScavengerDelegate::switchConcurrentForThread(MM_EnvironmentBase *env)
+{
+	/* The example load barrier tests the scavenger state on each load, so there is no thread local barrier state to switch */
+}
+
+void
+MM_ScavengerDelegate::fixupIndirectObjectSlots(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr)
+{
+	/* Example objects hold no references outside their own slots */
+}
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+
 #if defined (OMR_GC_COMPRESSED_POINTERS)
 void
 MM_ScavengerDelegate::fixupDestroyedSlot(MM_EnvironmentBase *env, MM_ForwardedHeader *forwardedHeader, MM_MemorySubSpaceSemiSpace *subSpaceNew)
@@ -45,6 +45,9 @@ class MM_MemorySubSpaceSemiSpace;
 class MM_ScavengerDelegate : public MM_BaseVirtual {
 private:
 	MM_GCExtensionsBase* _extensions;
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	volatile bool _flushCachesRequested; /**< set while the scavenger waits for mutator threads to flush their copy caches */
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
 
 protected:
 public:
@@ -244,6 +247,19 @@ public:
 	 * Fixup should update slots to point to the forwarded version of the object and/or remove self forwarded bit in the object itself.
 	 */
 	void fixupIndirectObjectSlots(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr);
+	/**
+	 * Request mutator threads to flush their copy caches, so that the concurrent phase can terminate. Example
+	 * mutator threads do not take async callbacks, so the request is polled by the load barrier slow path.
+	 * @param[in] env The environment for the calling thread.
+	 * @see loadBarrier()
+	 */
+	void signalThreadsToFlushCaches(MM_EnvironmentBase *env) { _flushCachesRequested = true; }
+	/**
+	 * Withdraw a request made by signalThreadsToFlushCaches().
+	 * @param[in] env The environment for the calling thread.
+	 */
+	void cancelSignalToFlushCaches(MM_EnvironmentBase *env) { _flushCachesRequested = false; }
+	MMINLINE bool isFlushCachesRequested() { return _flushCachesRequested; }
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 
 	bool initialize(MM_EnvironmentBase* env) { return true; }
@@ -253,6 +269,9 @@ public:
 	MM_ScavengerDelegate(MM_EnvironmentBase* env)
 		: MM_BaseVirtual()
 		, _extensions(env->getExtensions())
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+		, _flushCachesRequested(false)
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -36,6 +36,12 @@
 #if defined(OMR_GC_SEGREGATED_HEAP)
 #define OMR_SEGREGATEDHEAP "-Xgcpolicy:segregated"
 #define OMR_SEGREGATEDHEAP_LENGTH 21
+#define OMR_XGCSIZECLASSTABLE "-Xgc:sizeClassTable="
+#define OMR_XGCSIZECLASSTABLE_LENGTH 20
+#define OMR_XGCSIZECLASSPROFILING "-Xgc:sizeClassProfiling"
+#define OMR_XGCSIZECLASSPROFILING_LENGTH 23
+#define OMR_XGCALLOCATIONCACHEMAGAZINECOUNT "-Xgc:allocationCacheMagazineCount="
+#define OMR_XGCALLOCATIONCACHEMAGAZINECOUNT_LENGTH 34
 #endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 
 bool
@@ -51,6 +57,23 @@ MM_StartupManagerImpl::handleOption(MM_GCExtensionsBase *extensions, char *optio
 			 */
 			_useSegregatedGC = true;
 			result = true;
+		} else if (0 == strncmp(option, OMR_XGCSIZECLASSTABLE, OMR_XGCSIZECLASSTABLE_LENGTH)) {
+			const char *table = option + OMR_XGCSIZECLASSTABLE_LENGTH;
+			/* the table is validated when the size classes are initialized */
+			if (strlen(table) < sizeof(_sizeClassTable)) {
+				strcpy(_sizeClassTable, table);
+				extensions->sizeClassTable = _sizeClassTable;
+				result = true;
+			}
+		} else if (0 == strncmp(option, OMR_XGCSIZECLASSPROFILING, OMR_XGCSIZECLASSPROFILING_LENGTH)) {
+			extensions->sizeClassProfiling = true;
+			result = true;
+		} else if (0 == strncmp(option, OMR_XGCALLOCATIONCACHEMAGAZINECOUNT, OMR_XGCALLOCATIONCACHEMAGAZINECOUNT_LENGTH)) {
+			uintptr_t magazineCount = 0;
+			if ((0 < getUDATAValue(option + OMR_XGCALLOCATIONCACHEMAGAZINECOUNT_LENGTH, &magazineCount)) && (0 < magazineCount)) {
+				extensions->allocationCacheMagazineCount = magazineCount;
+				result = true;
+			}
 		}
 #endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 	}
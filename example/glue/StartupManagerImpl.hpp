@@ -23,6 +23,9 @@
 #define MM_STARTUPMANAGERIMPL_HPP_
 
 #include "StartupManager.hpp"
+#if defined(OMR_GC_SEGREGATED_HEAP)
+#include "SizeClasses.hpp"
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 
 class MM_CollectorLanguageInterface;
 class MM_MarkingScheme;
@@ -40,6 +43,7 @@ private:
 protected:
 #if defined(OMR_GC_SEGREGATED_HEAP)
 	bool _useSegregatedGC;
+	char _sizeClassTable[OMR_SIZECLASSES_TABLE_LENGTH]; /**< text of the sizeClassTable option, read while the heap is initialized */
 #endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 public:
 	static const uintptr_t defaultMinimumHeapSize = (uintptr_t) 1*1024*1024;
@@ -66,6 +70,9 @@ public:
 		, _useSegregatedGC(false)
 #endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 	{
+#if defined(OMR_GC_SEGREGATED_HEAP)
+		_sizeClassTable[0] = '\0';
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 	}
 };
 
@@ -27,6 +27,7 @@
 #include "GCExtensionsBase.hpp"
 #include "VerboseManagerImpl.hpp"
 
+#include "VerboseHandlerBinaryStandard.hpp"
 #include "VerboseHandlerOutputStandard.hpp"
 
 #if defined(OMR_OS_WINDOWS)
@@ -88,7 +89,7 @@ MM_VerboseManagerImpl::reconfigureVerboseGC(OMR_VM *omrVM)
 	 */
 	WriterType type = parseWriterType(NULL, filename, 0, 0); /* All parameters other than filename aren't used */
 	if (
-			((type == VERBOSE_WRITER_FILE_LOGGING_SYNCHRONOUS) || (type == VERBOSE_WRITER_FILE_LOGGING_BUFFERED))
+			((type == VERBOSE_WRITER_FILE_LOGGING_SYNCHRONOUS) || (type == VERBOSE_WRITER_FILE_LOGGING_BUFFERED) || (type == VERBOSE_WRITER_FILE_LOGGING_BINARY))
 			&& (NULL == strstr(filename, "%p")) && (NULL == strstr(filename, "%pid"))
 		) {
 #define MAX_PID_LENGTH 16
@@ -120,5 +121,8 @@ MM_VerboseManagerImpl::reconfigureVerboseGC(OMR_VM *omrVM)
 MM_VerboseHandlerOutput *
 MM_VerboseManagerImpl::createVerboseHandlerOutputObject(MM_EnvironmentBase *env)
 {
+	if (env->getExtensions()->binaryLogging) {
+		return MM_VerboseHandlerBinaryStandard::newInstance(env, this);
+	}
 	return MM_VerboseHandlerOutputStandard::newInstance(env, this);
 }
@@ -28,6 +28,7 @@ CONFIGURE_ARGS += \
   --enable-fvtest \
   --enable-OMR_GC_SEGREGATED_HEAP \
   --enable-OMR_GC_MODRON_SCAVENGER \
+  --enable-OMR_GC_AUTO_HOT_FIELDS \
   --enable-OMR_GC_MODRON_CONCURRENT_MARK \
   --enable-OMR_GC_VLHGC \
   --enable-OMR_GC_VLHGC_CONCURRENT_COPY_FORWARD \
@@ -19,20 +19,40 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
  *******************************************************************************/
 
+#include "AtomicOperations.hpp"
+#include "CardTable.hpp"
 #include "CollectorLanguageInterface.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCConfigTest.hpp"
+#include "Heap.hpp"
 #include "ObjectAllocationModel.hpp"
 #include "ObjectModel.hpp"
 #include "omrExampleVM.hpp"
+#include "omragent.h"
 #include "omrgc.h"
+#include "ParallelGlobalGC.hpp"
+#include "ParallelHeapWalker.hpp"
+#if defined(OMR_GC_SEGREGATED_HEAP)
+#include "AllocationContextSegregated.hpp"
+#include "HeapRegionDescriptorSegregated.hpp"
+#include "HeapRegionIterator.hpp"
+#include "ObjectHeapIteratorSegregated.hpp"
+#include "OMRVMInterface.hpp"
+#include "SegregatedAllocationInterface.hpp"
+#include "SegregatedAllocationTracker.hpp"
+#include "SizeClasses.hpp"
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+#include "omrprofiler.h"
+#include "omrrasinit.h"
 #include "SlotObject.hpp"
 #include "StandardWriteBarrier.hpp"
+#include "VerboseBinaryDecoder.hpp"
 #include "VerboseWriterChain.hpp"
 
 //#define OMRGCTEST_PRINTFILE
 
 #define MAX_NAME_LENGTH 512
+#define MAX_ALLOCATION_SITES 8
 #define OMRGCTEST_CHECK_RT(rt) \
 	if (0 != (rt)) {\
 		goto done;\
@@ -43,8 +63,33 @@
 const char *gcTests[] = {"fvtest/gctest/configuration/sample_GC_config.xml"
                         , "fvtest/gctest/configuration/test_system_gc.xml"
                         , "fvtest/gctest/configuration/global_GC_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_workstealing_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_numa_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_prefetch_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_sizeclassindex_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_idleuncommit_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_binarylog_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_allocsampling_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_heapiteration_config.xml"
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+                        , "fvtest/gctest/configuration/global_GC_lazysweep_config.xml"
+#endif
+#if defined(OMR_GC_MODRON_COMPACTION)
+                        , "fvtest/gctest/configuration/global_GC_compactincrement_config.xml"
+#endif
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/optavgpause_GC_config.xml"
+                        , "fvtest/gctest/configuration/optavgpause_GC_cardsummary_config.xml"
+                        , "fvtest/gctest/configuration/optavgpause_GC_pacing_config.xml"
+                        , "fvtest/gctest/configuration/optavgpause_GC_dedicatedmark_config.xml"
+#if defined(OMR_GC_REALTIME)
+                        , "fvtest/gctest/configuration/optavgpause_GC_satb_config.xml"
+#endif /* defined(OMR_GC_REALTIME) */
+#endif
+#if defined(OMR_GC_SEGREGATED_HEAP)
+                        , "fvtest/gctest/configuration/segregated_GC_sizeclassprofile_config.xml"
+                        , "fvtest/gctest/configuration/segregated_GC_sizeclasstable_config.xml"
+                        , "fvtest/gctest/configuration/segregated_GC_magazines_config.xml"
 #endif
 #if defined(OMR_GC_MODRON_SCAVENGER)
                         , "fvtest/gctest/configuration/scavenger_GC_config.xml"
@@ -53,11 +98,41 @@ const char *gcTests[] = {"fvtest/gctest/configuration/sample_GC_config.xml"
 #if defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/gencon_GC_config.xml"
                         , "fvtest/gctest/configuration/gencon_GC_backout_config.xml"
+                        , "fvtest/gctest/configuration/gencon_GC_copymodes_config.xml"
+                        , "fvtest/gctest/configuration/gencon_GC_tenurecost_config.xml"
+#if defined(OMR_GC_AUTO_HOT_FIELDS)
+                        , "fvtest/gctest/configuration/gencon_GC_hotfields_config.xml"
+#endif /* defined(OMR_GC_AUTO_HOT_FIELDS) */
+                        , "fvtest/gctest/configuration/gencon_GC_tlhadaptive_config.xml"
+                        , "fvtest/gctest/configuration/gencon_GC_tlhprezero_config.xml"
 #endif
                         };
 
 const char *perfTests[] = {"perftest/gctest/configuration/21645_core.20150126.202455.11862202.0001.xml",
-								"perftest/gctest/configuration/24404_core.20140723.091737.5812.0002.xml"};
+								"perftest/gctest/configuration/24404_core.20140723.091737.5812.0002.xml"
+#if defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_MODRON_CONCURRENT_MARK)
+								, "perftest/gctest/configuration/gencon_scavenge_perf.xml"
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+								, "perftest/gctest/configuration/gencon_concurrentscavenge_perf.xml"
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
+								, "perftest/gctest/configuration/gencon_linkedlist_perf.xml"
+								, "perftest/gctest/configuration/gencon_tree_perf.xml"
+								, "perftest/gctest/configuration/gencon_largearray_perf.xml"
+								, "perftest/gctest/configuration/gencon_churn_perf.xml"
+#endif
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+								, "perftest/gctest/configuration/optavgpause_linkedlist_perf.xml"
+								, "perftest/gctest/configuration/optavgpause_tree_perf.xml"
+								, "perftest/gctest/configuration/optavgpause_largearray_perf.xml"
+								, "perftest/gctest/configuration/optavgpause_churn_perf.xml"
+#endif
+#if defined(OMR_GC_SEGREGATED_HEAP)
+								, "perftest/gctest/configuration/segregated_linkedlist_perf.xml"
+								, "perftest/gctest/configuration/segregated_tree_perf.xml"
+								, "perftest/gctest/configuration/segregated_largearray_perf.xml"
+								, "perftest/gctest/configuration/segregated_churn_perf.xml"
+#endif
+								};
 void
 GCConfigTest::SetUp()
 {
@@ -87,6 +162,19 @@ GCConfigTest::SetUp()
 		FAIL() << "Failed to instantiate collector interface.";
 	}
 
+	/* Sample allocations, charging them to the object node being allocated */
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	if (0 != extensions->allocationSamplingInterval) {
+		J9HookInterface **omrHooks = extensions->getOmrHookInterface();
+		if (0 != (*omrHooks)->J9HookRegisterWithCallSite(omrHooks, J9HOOK_MM_OMR_ALLOCATION_SAMPLE, allocationSampleHook, OMR_GET_CALLSITE(), (void *)this)) {
+			FAIL() << "Failed to register the allocation sample hook.";
+		}
+		rc = omr_ras_initTI(exampleVM->_omrVM);
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): omr_ras_initTI failed, rc=" << rc;
+		rc = omr_agent_getTI()->StartAllocationSampling(exampleVM->_omrVMThread, extensions->allocationSamplingInterval, MAX_ALLOCATION_SITES);
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): StartAllocationSampling failed, rc=" << rc;
+	}
+
 	/* load config file */
 #if defined(OMRGCTEST_PRINTFILE)
 	printFile(GetParam());
@@ -96,6 +184,19 @@ GCConfigTest::SetUp()
 		FAIL() << "Failed to load test configuration file (" << GetParam() << ") with error description: " << result.description() << ".";
 	}
 
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+	/* Force the remembered set into overflow for every concurrent cycle, so concurrent card cleaning re-dirties cards */
+	if (doc.select_node("/gc-config/verification/cardTableSummary")) {
+		J9HookInterface **privateHooks = J9_HOOK_INTERFACE(extensions->privateHookInterface);
+		if ((0 != (*privateHooks)->J9HookRegisterWithCallSite(privateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_KICKOFF, cardTableSummaryKickoffHook, OMR_GET_CALLSITE(), (void *)this))
+			|| (0 != (*privateHooks)->J9HookRegisterWithCallSite(privateHooks, J9HOOK_MM_PRIVATE_EXCLUSIVE_ACCESS_ACQUIRE, cardTableSummaryExclusiveAccessHook, OMR_GET_CALLSITE(), (void *)this))
+			|| (0 != (*privateHooks)->J9HookRegisterWithCallSite(privateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_COLLECTION_CARD_CLEANING_END, cardTableSummaryCardCleaningEndHook, OMR_GET_CALLSITE(), (void *)this))
+		) {
+			FAIL() << "Failed to register the card table summary hooks.";
+		}
+	}
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+
 	/* parse verbose information and initialize verbose manager */
 	pugi::xml_node optionNode = doc.select_node("/gc-config/option").node();
 	const char *verboseFileNamePrefix = optionNode.attribute("verboseLog").value();
@@ -132,6 +233,17 @@ GCConfigTest::TearDown()
 {
 	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
 
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	/* A concurrent scavenge still in progress scans the tables freed below and reports to the verbose streams
+	 * closed below, so complete it first. Verbose output is detached so teardown stays out of the logged results. */
+	if ((NULL != env) && env->getExtensions()->isConcurrentScavengerInProgress()) {
+		if (NULL != verboseManager) {
+			verboseManager->disableVerboseGC();
+		}
+		OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_IMPLICIT_GC_DEFAULT);
+	}
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+
 	/* Free root hash table */
 	if (NULL != exampleVM->rootTable) {
 		hashTableFree(exampleVM->rootTable);
@@ -181,6 +293,25 @@ GCConfigTest::TearDown()
 	omrmem_free_memory((void *)verboseFile);
 	verboseFile = NULL;
 
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+	if (NULL != env) {
+		J9HookInterface **privateHooks = J9_HOOK_INTERFACE(env->getExtensions()->privateHookInterface);
+		(*privateHooks)->J9HookUnregister(privateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_KICKOFF, cardTableSummaryKickoffHook, (void *)this);
+		(*privateHooks)->J9HookUnregister(privateHooks, J9HOOK_MM_PRIVATE_EXCLUSIVE_ACCESS_ACQUIRE, cardTableSummaryExclusiveAccessHook, (void *)this);
+		(*privateHooks)->J9HookUnregister(privateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_COLLECTION_CARD_CLEANING_END, cardTableSummaryCardCleaningEndHook, (void *)this);
+	}
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+
+	if ((NULL != env) && (0 != env->getExtensions()->allocationSamplingInterval)) {
+		J9HookInterface **omrHooks = env->getExtensions()->getOmrHookInterface();
+		(*omrHooks)->J9HookUnregister(omrHooks, J9HOOK_MM_OMR_ALLOCATION_SAMPLE, allocationSampleHook, (void *)this);
+		omr_error_t rc = omr_agent_getTI()->StopAllocationSampling(exampleVM->_omrVMThread);
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "TearDown(): StopAllocationSampling failed, rc=" << rc;
+		omr_ras_cleanupAllocationProfiler(exampleVM->_omrVM);
+		rc = omr_ras_cleanupTI(exampleVM->_omrVM);
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "TearDown(): omr_ras_cleanupTI failed, rc=" << rc;
+	}
+
 	if (NULL != cli) {
 		cli->kill(env);
 	}
@@ -306,9 +437,13 @@ GCConfigTest::allocateHelper(const char *objName, uintptr_t size)
 	objEntry.name = objName;
 	objEntry.objPtr = NULL;
 
+	/* Concurrent marking with the snapshot-at-the-beginning barrier starts only from an allocation at a safe point.
+	 * Everything allocated earlier is already linked from the root table, so every allocation can be one.
+	 */
+	bool noGcFlag = !env->getExtensions()->usingSATBBarrier();
 	uint8_t objectAllocationModelSpace[sizeof(MM_ObjectAllocationModel)];
 	MM_ObjectAllocationModel *noGc = new(objectAllocationModelSpace)
-			MM_ObjectAllocationModel(env, size, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, true));
+			MM_ObjectAllocationModel(env, size, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, noGcFlag));
 	objEntry.objPtr = OMR_GC_AllocateObject(exampleVM->_omrVMThread, noGc);
 
 	if (NULL == objEntry.objPtr) {
@@ -688,8 +823,9 @@ GCConfigTest::removeObjectFromParentSlot(const char *name, ObjectEntry *parentEn
 
 	while (currentSlot < endSlot) {
 		GC_SlotObject slotObject(exampleVM->_omrVM, currentSlot);
-		if (objEntry->objPtr == slotObject.readReferenceFromSlot()) {
+		if (objEntry->objPtr == loadBarrier(exampleVM->_omrVMThread, currentSlot)) {
 			gcTestEnv->log(LEVEL_VERBOSE, "Remove object %s(%p[0x%llx]) from parent %s(%p[0x%llx]) slot %p.\n", name, objEntry->objPtr, objEntry->objPtr->header.raw(), parentEntry->name, parentEntry->objPtr, parentEntry->objPtr->header.raw(), slotObject.readAddressFromSlot());
+			standardPreWriteBarrier(exampleVM->_omrVMThread, currentSlot);
 			slotObject.writeReferenceToSlot(NULL);
 			rt = 0;
 			break;
@@ -730,6 +866,7 @@ GCConfigTest::allocationWalker(pugi::xml_node node)
 		gcTestEnv->log(LEVEL_ERROR, "%s:%d Invalid XML input: please specify namePrefix and type for object %s.\n", __FILE__, __LINE__, namePrefixStr);
 		goto done;
 	}
+	allocationSite = namePrefixStr;
 	/* set default value for breadth and depth to 1 */
 	if (0 == strcmp(breadthStr, "")) {
 		breadthStr = "1";
@@ -809,6 +946,31 @@ printFile(const char *name)
 }
 #endif
 
+pugi::xml_parse_result
+GCConfigTest::loadVerboseLog(pugi::xml_document &verboseDoc, const char *fileName)
+{
+	if (!env->getExtensions()->binaryLogging) {
+		return verboseDoc.load_file(fileName);
+	}
+
+	/* binary logs are decoded into the same XML the text writers produce */
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	VerboseBinaryDecoder decoder;
+	if (RC_OK != decoder.load(fileName)) {
+		pugi::xml_parse_result result;
+		if (EsIsFile != omrfile_attr(fileName)) {
+			result.status = pugi::status_file_not_found;
+		} else {
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to decode binary verbose log %s: %s\n", __FILE__, __LINE__, fileName, decoder.getError());
+			result.status = pugi::status_io_error;
+		}
+		return result;
+	}
+	std::string xml;
+	decoder.toXML(xml);
+	return verboseDoc.load_buffer(xml.data(), xml.size());
+}
+
 int32_t
 GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
 {
@@ -826,11 +988,16 @@ GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
 		isFound[i] = false;
 	}
 
+	/* the binary writer logs from a background thread; closing the streams drains it to the file */
+	if (env->getExtensions()->binaryLogging) {
+		verboseManager->closeStreams(env);
+	}
+
 	/* Loop through multiple files if rolling log is enabled */
 	do {
 		pugi::xml_document verboseDoc;
 		if (0 == numOfFiles) {
-			verboseDoc.load_file(verboseFile);
+			loadVerboseLog(verboseDoc, verboseFile);
 			gcTestEnv->log("Parsing verbose log %s:\n", verboseFile);
 #if defined(OMRGCTEST_PRINTFILE)
 			printFile(verboseFile);
@@ -838,7 +1005,7 @@ GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
 		} else {
 			char currentVerboseFile[MAX_NAME_LENGTH];
 			omrstr_printf(currentVerboseFile, MAX_NAME_LENGTH, "%s.%03zu", verboseFile, seq++);
-			pugi::xml_parse_result result = verboseDoc.load_file(currentVerboseFile);
+			pugi::xml_parse_result result = loadVerboseLog(verboseDoc, currentVerboseFile);
 			if (pugi::status_file_not_found == result.status) {
 				break;
 			}
@@ -906,6 +1073,588 @@ done:
 	return rt;
 }
 
+void
+GCConfigTest::allocationSampleHook(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData)
+{
+	MM_AllocationSampleEvent *event = (MM_AllocationSampleEvent *)eventData;
+	GCConfigTest *test = (GCConfigTest *)userData;
+
+	/* the test has no call stack; the object node being allocated stands in for the allocating method */
+	omr_ras_sampleStackTraceStart(event->currentThread, test->allocationSite);
+}
+
+int32_t
+GCConfigTest::verifyAllocationSites(pugi::xml_node node)
+{
+	int32_t rt = 0;
+	OMR_TI_AllocationSite sites[MAX_ALLOCATION_SITES];
+	int32_t writtenCount = 0;
+	uint64_t sampledBytes = 0;
+	uint64_t siteBytes = 0;
+	const char *topSite = node.attribute("topSite").value();
+
+	omr_error_t rc = omr_agent_getTI()->GetAllocationSites(exampleVM->_omrVMThread, MAX_ALLOCATION_SITES, sites, &writtenCount, &sampledBytes);
+	if (OMR_ERROR_NONE != rc) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d GetAllocationSites failed, rc=%d.\n", __FILE__, __LINE__, rc);
+		goto done;
+	}
+	if ((0 == writtenCount) || (sampledBytes < env->getExtensions()->allocationSamplingInterval)) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d No allocation was sampled: %d sites, %llu bytes.\n", __FILE__, __LINE__, writtenCount, sampledBytes);
+		goto done;
+	}
+	for (int32_t i = 0; i < writtenCount; i++) {
+		gcTestEnv->log(LEVEL_VERBOSE, "Allocation site %s: %llu bytes\n", (const char *)sites[i].methodKey, sites[i].bytes);
+		if ((NULL == sites[i].methodKey) || ((0 < i) && (sites[i].bytes > sites[i - 1].bytes))) {
+			rt = 1;
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Allocation site %d is unnamed or out of order.\n", __FILE__, __LINE__, i);
+			goto done;
+		}
+		siteBytes += sites[i].bytes;
+	}
+	/* every site fits in the profiler, so no sampled bytes are lost to eviction */
+	if (siteBytes != sampledBytes) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Allocation sites account for %llu of %llu sampled bytes.\n", __FILE__, __LINE__, siteBytes, sampledBytes);
+		goto done;
+	}
+	if ((0 != strcmp(topSite, "")) && (0 != strcmp(topSite, (const char *)sites[0].methodKey))) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Top allocation site is %s, expected %s.\n", __FILE__, __LINE__, (const char *)sites[0].methodKey, topSite);
+		goto done;
+	}
+
+done:
+	return rt;
+}
+
+void
+GCConfigTest::heapObjectsCallback(OMR_VMThread *vmThread, const OMR_TI_HeapObject *objects, uintptr_t objectCount, void *userData)
+{
+	HeapIterationTotals *totals = (HeapIterationTotals *)userData;
+	uintptr_t batchBytes = 0;
+
+	/* called concurrently from the GC threads */
+	if ((0 == objectCount) || (objectCount > totals->batchSize)) {
+		MM_AtomicOperations::add(&totals->invalidBatches, 1);
+	}
+	for (uintptr_t i = 0; i < objectCount; i++) {
+		if ((NULL == objects[i].object) || (0 == objects[i].size)) {
+			MM_AtomicOperations::add(&totals->invalidBatches, 1);
+		}
+		batchBytes += objects[i].size;
+	}
+	MM_AtomicOperations::add(&totals->objectCount, objectCount);
+	MM_AtomicOperations::add(&totals->objectBytes, batchBytes);
+	MM_AtomicOperations::add(&totals->batchCount, 1);
+}
+
+void
+GCConfigTest::countMarkedObject(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectptr_t object, void *userData)
+{
+	HeapIterationTotals *totals = (HeapIterationTotals *)userData;
+
+	if (totals->markMap->isBitSet(object)) {
+		MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(omrVMThread->_vm);
+		totals->objectCount += 1;
+		totals->objectBytes += extensions->objectModel.getConsumedSizeInBytesWithHeader(object);
+	}
+}
+
+int32_t
+GCConfigTest::verifyHeapIteration(pugi::xml_node node)
+{
+	int32_t rt = 0;
+	OMR_TI const *ti = omr_agent_getTI();
+	HeapIterationTotals parallelTotals;
+	HeapIterationTotals serialTotals;
+	memset(&parallelTotals, 0, sizeof(parallelTotals));
+	memset(&serialTotals, 0, sizeof(serialTotals));
+	parallelTotals.batchSize = (uintptr_t)atoi(node.attribute("batchSize").value());
+
+	omr_error_t rc = ti->IterateHeap(exampleVM->_omrVMThread, 0, heapObjectsCallback, &parallelTotals);
+	if (OMR_ERROR_ILLEGAL_ARGUMENT == rc) {
+		rc = ti->IterateHeap(exampleVM->_omrVMThread, parallelTotals.batchSize, NULL, &parallelTotals);
+	}
+	if (OMR_ERROR_ILLEGAL_ARGUMENT == rc) {
+		/* the batches of all GC threads would not fit in the address space */
+		rc = ti->IterateHeap(exampleVM->_omrVMThread, UDATA_MAX, heapObjectsCallback, &parallelTotals);
+	}
+	if (OMR_ERROR_ILLEGAL_ARGUMENT != rc) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d IterateHeap accepted an illegal argument, rc=%d.\n", __FILE__, __LINE__, rc);
+		goto done;
+	}
+
+	rc = ti->IterateHeap(exampleVM->_omrVMThread, parallelTotals.batchSize, heapObjectsCallback, &parallelTotals);
+	if (OMR_ERROR_NONE != rc) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d IterateHeap failed, rc=%d.\n", __FILE__, __LINE__, rc);
+		goto done;
+	}
+	gcTestEnv->log(LEVEL_VERBOSE, "Heap iteration reported %zu objects (%zu bytes) in %zu batches\n", parallelTotals.objectCount, parallelTotals.objectBytes, parallelTotals.batchCount);
+	if ((0 == parallelTotals.objectCount) || (0 != parallelTotals.invalidBatches)) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Heap iteration reported %zu objects and %zu invalid batches.\n", __FILE__, __LINE__, parallelTotals.objectCount, parallelTotals.invalidBatches);
+		goto done;
+	}
+
+	/* the iteration leaves the heap marked, so a serial walk of the marked objects must find the same objects */
+	{
+		MM_ParallelGlobalGC *globalCollector = (MM_ParallelGlobalGC *)env->getExtensions()->getGlobalCollector();
+		MM_ParallelHeapWalker *heapWalker = (MM_ParallelHeapWalker *)globalCollector->getHeapWalker();
+		serialTotals.markMap = heapWalker->getMarkMap();
+		env->acquireExclusiveVMAccess();
+		heapWalker->allObjectsDo(env, countMarkedObject, &serialTotals, MEMORY_TYPE_RAM, false, false, false);
+		env->releaseExclusiveVMAccess();
+	}
+	if ((serialTotals.objectCount != parallelTotals.objectCount) || (serialTotals.objectBytes != parallelTotals.objectBytes)) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Heap iteration reported %zu objects (%zu bytes), a serial walk found %zu objects (%zu bytes).\n",
+			__FILE__, __LINE__, parallelTotals.objectCount, parallelTotals.objectBytes, serialTotals.objectCount, serialTotals.objectBytes);
+		goto done;
+	}
+
+done:
+	return rt;
+}
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+int32_t
+GCConfigTest::verifySizeClassProfile(pugi::xml_node node)
+{
+	int32_t rt = 0;
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_SizeClasses *sizeClasses = extensions->defaultSizeClasses;
+	uint64_t histogram[OMR_SIZECLASSES_PROFILE_BUCKETS];
+	uintptr_t fittedCellSizes[OMR_SIZECLASSES_NUM_SMALL + 1];
+	uintptr_t reloadedCellSizes[OMR_SIZECLASSES_NUM_SMALL + 1];
+	char table[OMR_SIZECLASSES_TABLE_LENGTH];
+	uint64_t smallRequests = 0;
+	uint64_t currentWaste = 0;
+	uint64_t fittedWaste = 0;
+
+	/* the profile normally takes a thread's counts when it exits, this thread is still allocating */
+	env->_allocationTracker->flushRequestSizes(env);
+	sizeClasses->getRequestSizeHistogram(histogram);
+	for (uintptr_t bucket = 0; bucket < (OMR_SIZECLASSES_PROFILE_BUCKETS - 1); bucket++) {
+		smallRequests += histogram[bucket];
+	}
+	if (0 == smallRequests) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d The size class profile counted no small requests.\n", __FILE__, __LINE__);
+		goto done;
+	}
+
+	currentWaste = MM_SizeClasses::getRoundingWaste(histogram, env->getOmrVM()->_sizeClasses->smallCellSizes);
+	fittedWaste = MM_SizeClasses::fitCellSizes(env, histogram, fittedCellSizes);
+	if ((U_64_MAX == fittedWaste) || (fittedWaste > currentWaste) || (fittedWaste != MM_SizeClasses::getRoundingWaste(histogram, fittedCellSizes))) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d The fitted size classes waste %llu bytes, the current ones %llu bytes.\n", __FILE__, __LINE__, fittedWaste, currentWaste);
+		goto done;
+	}
+
+	/* the table reported at shutdown must be accepted by the sizeClassTable option as is */
+	MM_SizeClasses::formatCellSizes(env, table, sizeof(table), fittedCellSizes);
+	gcTestEnv->log(LEVEL_VERBOSE, "Fitted size classes waste %llu bytes (current %llu bytes): sizeClassTable=%s\n", fittedWaste, currentWaste, table);
+	if (!MM_SizeClasses::parseCellSizes(table, reloadedCellSizes)
+		|| (0 != memcmp(fittedCellSizes, reloadedCellSizes, sizeof(fittedCellSizes)))
+	) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d The fitted table does not reload: sizeClassTable=%s\n", __FILE__, __LINE__, table);
+		goto done;
+	}
+
+done:
+	return rt;
+}
+
+int32_t
+GCConfigTest::verifySizeClassTable(pugi::xml_node node)
+{
+	int32_t rt = 0;
+	const char *table = doc.select_node("/gc-config/option").node().attribute("sizeClassTable").value();
+	uintptr_t *cellSizes = env->getOmrVM()->_sizeClasses->smallCellSizes;
+	uintptr_t expectedCellSizes[OMR_SIZECLASSES_NUM_SMALL + 1];
+
+	if (!MM_SizeClasses::parseCellSizes(table, expectedCellSizes)) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d The configuration has no valid sizeClassTable option: %s\n", __FILE__, __LINE__, table);
+		goto done;
+	}
+	for (uintptr_t szClass = OMR_SIZECLASSES_MIN_SMALL; szClass <= OMR_SIZECLASSES_MAX_SMALL; szClass++) {
+		if (cellSizes[szClass] != expectedCellSizes[szClass]) {
+			rt = 1;
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Size class %zu has cells of %zu bytes, the sizeClassTable option gives %zu bytes.\n", __FILE__, __LINE__, szClass, cellSizes[szClass], expectedCellSizes[szClass]);
+			goto done;
+		}
+	}
+
+done:
+	return rt;
+}
+
+static int
+compareObjects(const void *left, const void *right)
+{
+	uintptr_t leftObject = (uintptr_t)*(omrobjectptr_t *)left;
+	uintptr_t rightObject = (uintptr_t)*(omrobjectptr_t *)right;
+	return (leftObject < rightObject) ? -1 : ((leftObject > rightObject) ? 1 : 0);
+}
+
+int J9THREAD_PROC
+GCConfigTest::magazineWorkerMain(void *entryArg)
+{
+	MagazineWorker *worker = (MagazineWorker *)entryArg;
+	MagazineTestState *state = worker->state;
+	/* a mix of size classes, so refills carve magazines for several of them */
+	const uintptr_t fieldCounts[] = {2, 5, 9, 14, 30};
+	const uintptr_t fieldCountsLength = sizeof(fieldCounts) / sizeof(fieldCounts[0]);
+
+	if (OMR_ERROR_NONE != OMR_Thread_Init(state->omrVM, NULL, &worker->omrVMThread, "GCConfigTest magazine worker")) {
+		worker->omrVMThread = NULL;
+	}
+
+	omrthread_monitor_enter(state->monitor);
+	state->attachedThreads += 1;
+	omrthread_monitor_notify_all(state->monitor);
+	while (!state->started) {
+		omrthread_monitor_wait(state->monitor);
+	}
+	omrthread_monitor_exit(state->monitor);
+
+	if (NULL != worker->omrVMThread) {
+		MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(worker->omrVMThread);
+		for (uintptr_t i = 0; i < state->objectsPerThread; i++) {
+			uintptr_t size = sizeof(omrobjectptr_t) + (fieldCounts[(i + worker->index) % fieldCountsLength] * sizeof(fomrobject_t));
+			uint8_t objectAllocationModelSpace[sizeof(MM_ObjectAllocationModel)];
+			MM_ObjectAllocationModel *noGc = new(objectAllocationModelSpace)
+					MM_ObjectAllocationModel(env, size, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, true));
+			omrobjectptr_t object = OMR_GC_AllocateObject(worker->omrVMThread, noGc);
+			if (NULL == object) {
+				break;
+			}
+			worker->objects[worker->objectCount] = object;
+			worker->objectCount += 1;
+		}
+		MM_SegregatedAllocationInterface::getObjectAllocationInterface(env)->getReplenishCounts(&worker->replenishes, &worker->magazineLoads);
+	}
+
+	/* stay attached until the heap has been walked, so the cache and spare magazines are still held */
+	omrthread_monitor_enter(state->monitor);
+	state->parkedThreads += 1;
+	omrthread_monitor_notify_all(state->monitor);
+	while (!state->released) {
+		omrthread_monitor_wait(state->monitor);
+	}
+	omrthread_monitor_exit(state->monitor);
+
+	if (NULL != worker->omrVMThread) {
+		OMR_Thread_Free(worker->omrVMThread);
+	}
+
+	omrthread_monitor_enter(state->monitor);
+	state->exitedThreads += 1;
+	omrthread_monitor_notify_all(state->monitor);
+	omrthread_monitor_exit(state->monitor);
+	return 0;
+}
+
+void
+GCConfigTest::walkSegregatedHeap(MagazineWalkTotals *totals)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	GC_HeapRegionIterator regionIterator(extensions->heap->getHeapRegionManager());
+	MM_HeapRegionDescriptorSegregated *region = NULL;
+
+	totals->walkedObjects = 0;
+	totals->foundObjects = 0;
+	totals->invalidObjects = 0;
+
+	env->acquireExclusiveVMAccess();
+	GC_OMRVMInterface::flushCachesForWalk(env->getOmrVM());
+	while (NULL != (region = (MM_HeapRegionDescriptorSegregated *)regionIterator.nextRegion())) {
+		GC_ObjectHeapIteratorSegregated objectIterator(extensions, (omrobjectptr_t)region->getLowAddress(), (omrobjectptr_t)region->getHighAddress(), region->getRegionType(), region->getCellSize(), false, false);
+		omrobjectptr_t object = NULL;
+		while (NULL != (object = objectIterator.nextObject())) {
+			totals->walkedObjects += 1;
+			if ((MM_HeapRegionDescriptor::SEGREGATED_SMALL == region->getRegionType())
+				&& (extensions->objectModel.getConsumedSizeInBytesWithHeader(object) > region->getCellSize())
+			) {
+				totals->invalidObjects += 1;
+			}
+			if (NULL != bsearch(&object, totals->objects, totals->objectCount, sizeof(omrobjectptr_t), compareObjects)) {
+				totals->foundObjects += 1;
+			}
+		}
+	}
+	env->releaseExclusiveVMAccess();
+}
+
+int32_t
+GCConfigTest::verifyAllocationCacheMagazines(pugi::xml_node node)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	int32_t rt = 0;
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	uintptr_t threadCount = (uintptr_t)atoi(node.attribute("threads").value());
+	MagazineTestState state;
+	MagazineWorker *workers = NULL;
+	MagazineWalkTotals totals;
+	uintptr_t baselineObjects = 0;
+	uintptr_t allocatedObjects = 0;
+	uint64_t replenishes = 0;
+	uint64_t magazineLoads = 0;
+	uintptr_t spareBytes = 0;
+	uintptr_t depotBytes = 0;
+	uint64_t startTime = 0;
+	uint64_t elapsedMicros = 0;
+
+	memset(&state, 0, sizeof(state));
+	memset(&totals, 0, sizeof(totals));
+	state.omrVM = exampleVM->_omrVM;
+	state.objectsPerThread = (uintptr_t)atoi(node.attribute("objectsPerThread").value());
+
+	/* objects already in the heap, nothing else allocates until the workers are done */
+	walkSegregatedHeap(&totals);
+	baselineObjects = totals.walkedObjects;
+
+	workers = (MagazineWorker *)omrmem_allocate_memory(threadCount * sizeof(MagazineWorker), OMRMEM_CATEGORY_MM);
+	totals.objects = (omrobjectptr_t *)omrmem_allocate_memory(threadCount * state.objectsPerThread * sizeof(omrobjectptr_t), OMRMEM_CATEGORY_MM);
+	if ((NULL == workers) || (NULL == totals.objects) || (0 != omrthread_monitor_init_with_name(&state.monitor, 0, "GCConfigTest magazine workers"))) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to set up %zu allocating threads.\n", __FILE__, __LINE__, threadCount);
+		goto done;
+	}
+	memset(workers, 0, threadCount * sizeof(MagazineWorker));
+	for (uintptr_t i = 0; i < threadCount; i++) {
+		omrthread_t thread = NULL;
+		workers[i].state = &state;
+		workers[i].index = i;
+		workers[i].objects = totals.objects + (i * state.objectsPerThread);
+		if (0 != omrthread_create(&thread, 0, J9THREAD_PRIORITY_NORMAL, 0, magazineWorkerMain, &workers[i])) {
+			/* run with the threads that did start, so the started ones can be released */
+			rt = 1;
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to start allocating thread %zu.\n", __FILE__, __LINE__, i);
+			threadCount = i;
+			break;
+		}
+	}
+
+	omrthread_monitor_enter(state.monitor);
+	while (state.attachedThreads < threadCount) {
+		omrthread_monitor_wait(state.monitor);
+	}
+	startTime = omrtime_hires_clock();
+	state.started = true;
+	omrthread_monitor_notify_all(state.monitor);
+	while (state.parkedThreads < threadCount) {
+		omrthread_monitor_wait(state.monitor);
+	}
+	elapsedMicros = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	omrthread_monitor_exit(state.monitor);
+
+	/* all threads are parked: their caches and spare magazines are held, the depots hold the rest of their refills */
+	for (uintptr_t i = 0; i < threadCount; i++) {
+		if (NULL == workers[i].omrVMThread) {
+			rt = 1;
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Allocating thread %zu failed to attach.\n", __FILE__, __LINE__, i);
+			continue;
+		}
+		MM_EnvironmentBase *workerEnv = MM_EnvironmentBase::getEnvironment(workers[i].omrVMThread);
+		MM_AllocationContextSegregated *context = (MM_AllocationContextSegregated *)workerEnv->getAllocationContext();
+		bool sharedContext = false;
+		for (uintptr_t j = 0; j < i; j++) {
+			if ((NULL != workers[j].omrVMThread) && (context == MM_EnvironmentBase::getEnvironment(workers[j].omrVMThread)->getAllocationContext())) {
+				sharedContext = true;
+			}
+		}
+		if (!sharedContext) {
+			depotBytes += context->getMagazineDepotBytes(workerEnv);
+		}
+		spareBytes += MM_SegregatedAllocationInterface::getObjectAllocationInterface(workerEnv)->getSpareMagazineBytes();
+		allocatedObjects += workers[i].objectCount;
+		replenishes += workers[i].replenishes;
+		magazineLoads += workers[i].magazineLoads;
+	}
+	gcTestEnv->log(LEVEL_VERBOSE, "%zu threads allocated %zu objects in %llu us with %zu magazines per refill: %llu replenishes, %llu from magazines, %zu spare bytes, %zu depot bytes\n",
+		threadCount, allocatedObjects, elapsedMicros, extensions->allocationCacheMagazineCount, replenishes, magazineLoads, spareBytes, depotBytes);
+	if (allocatedObjects != (threadCount * state.objectsPerThread)) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Allocated %zu of %zu objects without a GC.\n", __FILE__, __LINE__, allocatedObjects, threadCount * state.objectsPerThread);
+	}
+	if (extensions->allocationCacheMagazineCount > 2) {
+		if ((0 == spareBytes) || (0 == depotBytes) || (0 == magazineLoads)) {
+			rt = 1;
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Magazines were not held: %zu spare bytes, %zu depot bytes, %llu magazine loads.\n", __FILE__, __LINE__, spareBytes, depotBytes, magazineLoads);
+		}
+	} else if (1 == extensions->allocationCacheMagazineCount) {
+		if ((0 != spareBytes) || (0 != depotBytes) || (0 != magazineLoads)) {
+			rt = 1;
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Magazines were carved with the magazine layer off: %zu spare bytes, %zu depot bytes, %llu magazine loads.\n", __FILE__, __LINE__, spareBytes, depotBytes, magazineLoads);
+		}
+	}
+
+	/* walk the heap while the magazines are held, every allocated object must be found and nothing else */
+	for (uintptr_t i = 0; i < threadCount; i++) {
+		memmove(totals.objects + totals.objectCount, workers[i].objects, workers[i].objectCount * sizeof(omrobjectptr_t));
+		totals.objectCount += workers[i].objectCount;
+	}
+	qsort(totals.objects, totals.objectCount, sizeof(omrobjectptr_t), compareObjects);
+	walkSegregatedHeap(&totals);
+	if ((totals.walkedObjects != (baselineObjects + allocatedObjects)) || (totals.foundObjects != allocatedObjects) || (0 != totals.invalidObjects)) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Walked %zu objects (%zu invalid), expected %zu, found %zu of the %zu allocated objects.\n",
+			__FILE__, __LINE__, totals.walkedObjects, totals.invalidObjects, baselineObjects + allocatedObjects, totals.foundObjects, allocatedObjects);
+	}
+
+	omrthread_monitor_enter(state.monitor);
+	state.released = true;
+	omrthread_monitor_notify_all(state.monitor);
+	while (state.exitedThreads < threadCount) {
+		omrthread_monitor_wait(state.monitor);
+	}
+	omrthread_monitor_exit(state.monitor);
+
+	/* the exited threads flushed their caches and spare magazines, the depots are untouched */
+	walkSegregatedHeap(&totals);
+	if ((totals.walkedObjects != (baselineObjects + allocatedObjects)) || (totals.foundObjects != allocatedObjects) || (0 != totals.invalidObjects)) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d After the threads exited, walked %zu objects (%zu invalid), expected %zu, found %zu of the %zu allocated objects.\n",
+			__FILE__, __LINE__, totals.walkedObjects, totals.invalidObjects, baselineObjects + allocatedObjects, totals.foundObjects, allocatedObjects);
+	}
+
+done:
+	if (NULL != state.monitor) {
+		omrthread_monitor_destroy(state.monitor);
+	}
+	omrmem_free_memory(totals.objects);
+	omrmem_free_memory(workers);
+	return rt;
+}
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+void
+GCConfigTest::setReachableRemembered(omrobjectptr_t objectPtr, bool remembered)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	/* the remembered state doubles as the visited flag, so each object is walked once */
+	if (remembered != extensions->objectModel.isRemembered(objectPtr)) {
+		if (remembered) {
+			extensions->objectModel.setRememberedBits(objectPtr, STATE_REMEMBERED);
+		} else {
+			extensions->objectModel.clearRemembered(objectPtr);
+		}
+		uintptr_t size = extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+		fomrobject_t *currentSlot = (fomrobject_t *)objectPtr + 1;
+		fomrobject_t *endSlot = (fomrobject_t *)((uint8_t *)objectPtr + size);
+		for (; currentSlot < endSlot; currentSlot++) {
+			GC_SlotObject slotObject(exampleVM->_omrVM, currentSlot);
+			omrobjectptr_t childPtr = slotObject.readReferenceFromSlot();
+			if (NULL != childPtr) {
+				setReachableRemembered(childPtr, remembered);
+			}
+		}
+	}
+}
+
+void
+GCConfigTest::setRootsRemembered(bool remembered)
+{
+	J9HashTableState state;
+	RootEntry *rootEntry = (RootEntry *)hashTableStartDo(exampleVM->rootTable, &state);
+	while (NULL != rootEntry) {
+		if (NULL != rootEntry->rootPtr) {
+			setReachableRemembered(rootEntry->rootPtr, remembered);
+		}
+		rootEntry = (RootEntry *)hashTableNextDo(&state);
+	}
+}
+
+void
+GCConfigTest::countUncleanCards(uintptr_t *uncleanCards, uintptr_t *unsummarizedCards)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_CardTable *cardTable = extensions->cardTable;
+	Card *card = cardTable->heapAddrToCardAddr(env, extensions->heap->getHeapBase());
+	Card *endCard = cardTable->heapAddrToCardAddr(env, extensions->heap->getHeapTop());
+
+	/* every unclean card must be found through the summary table, or card cleaning would skip it */
+	for (card = MM_CardTable::skipCleanCards(card, endCard); card < endCard; card = MM_CardTable::skipCleanCards(card + 1, endCard)) {
+		*uncleanCards += 1;
+		if (card != cardTable->findUncleanCard(card, card + 1)) {
+			*unsummarizedCards += 1;
+		}
+	}
+}
+
+void
+GCConfigTest::cardTableSummaryKickoffHook(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData)
+{
+	GCConfigTest *test = (GCConfigTest *)userData;
+
+	/* the remembered set overflows without a scavenger, so the live objects stand in for the remembered objects */
+	test->setRootsRemembered(true);
+	test->env->getExtensions()->setScavengerRememberedSetOverflowState();
+	test->cardTableSummaryTotals.forcedCycles += 1;
+}
+
+void
+GCConfigTest::cardTableSummaryExclusiveAccessHook(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData)
+{
+	GCConfigTest *test = (GCConfigTest *)userData;
+	MM_GCExtensionsBase *extensions = test->env->getExtensions();
+
+	if (extensions->isScavengerRememberedSetInOverflowState()) {
+		/* the collection is about to start: check the cards left by concurrent cleaning, then end the overflow so the cycle completes */
+		test->countUncleanCards(&test->cardTableSummaryTotals.uncleanCards, &test->cardTableSummaryTotals.unsummarizedCards);
+		extensions->clearScavengerRememberedSetOverflowState();
+		test->setRootsRemembered(false);
+	}
+}
+
+void
+GCConfigTest::cardTableSummaryCardCleaningEndHook(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData)
+{
+	GCConfigTest *test = (GCConfigTest *)userData;
+
+	/* final card cleaning has cleaned every card it found and reset the summary cards, so any unclean card left was skipped */
+	test->countUncleanCards(&test->cardTableSummaryTotals.skippedCards, &test->cardTableSummaryTotals.unsummarizedCards);
+}
+
+int32_t
+GCConfigTest::verifyCardTableSummary(pugi::xml_node node)
+{
+	int32_t rt = 0;
+	uintptr_t minUncleanCards = (uintptr_t)atoi(node.attribute("minUncleanCards").value());
+
+	gcTestEnv->log(LEVEL_VERBOSE, "%zu concurrent cycles with remembered set overflow left %zu unclean cards, %zu skipped by final card cleaning and %zu with a clean summary card\n",
+		cardTableSummaryTotals.forcedCycles, cardTableSummaryTotals.uncleanCards, cardTableSummaryTotals.skippedCards, cardTableSummaryTotals.unsummarizedCards);
+	if (0 == cardTableSummaryTotals.forcedCycles) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d No concurrent cycle ran with remembered set overflow.\n", __FILE__, __LINE__);
+		goto done;
+	}
+	if (cardTableSummaryTotals.uncleanCards < minUncleanCards) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Concurrent card cleaning left %zu unclean cards, expected at least %zu.\n", __FILE__, __LINE__, cardTableSummaryTotals.uncleanCards, minUncleanCards);
+		goto done;
+	}
+	if ((0 != cardTableSummaryTotals.unsummarizedCards) || (0 != cardTableSummaryTotals.skippedCards)) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d %zu unclean cards have a clean summary card, %zu were skipped by final card cleaning.\n",
+			__FILE__, __LINE__, cardTableSummaryTotals.unsummarizedCards, cardTableSummaryTotals.skippedCards);
+		goto done;
+	}
+
+done:
+	return rt;
+}
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+
 int32_t
 GCConfigTest::parseGarbagePolicy(pugi::xml_node node)
 {
@@ -973,6 +1722,11 @@ GCConfigTest::triggerOperation(pugi::xml_node node)
 			}
 			OMRGCTEST_CHECK_RT(rt);
 			verboseManager->getWriterChain()->endOfCycle(env);
+		} else if (0 == strcmp(node.name(), "idle")) {
+			/* stop allocating for a while, for services that act once the application goes idle */
+			int64_t millis = (int64_t)atoi(node.attribute("millis").value());
+			gcTestEnv->log("Idling for %lld ms...\n", (long long)millis);
+			omrthread_sleep(millis);
 		}
 	}
 done:
@@ -1046,6 +1800,40 @@ TEST_P(GCConfigTest, test)
 			pugi::xpath_node_set verboseGCs = configChild.select_nodes(verboseNodeSet);
 			rt = verifyVerboseGC(verboseGCs);
 			ASSERT_EQ(0, rt) << "Failed in verbose GC verification.";
+			pugi::xml_node allocationSitesNode = configChild.child("allocationSites");
+			if (allocationSitesNode) {
+				rt = verifyAllocationSites(allocationSitesNode);
+				ASSERT_EQ(0, rt) << "Failed in allocation site verification.";
+			}
+			pugi::xml_node heapIterationNode = configChild.child("heapIteration");
+			if (heapIterationNode) {
+				rt = verifyHeapIteration(heapIterationNode);
+				ASSERT_EQ(0, rt) << "Failed in heap iteration verification.";
+			}
+#if defined(OMR_GC_SEGREGATED_HEAP)
+			pugi::xml_node sizeClassProfileNode = configChild.child("sizeClassProfile");
+			if (sizeClassProfileNode) {
+				rt = verifySizeClassProfile(sizeClassProfileNode);
+				ASSERT_EQ(0, rt) << "Failed in size class profile verification.";
+			}
+			pugi::xml_node sizeClassTableNode = configChild.child("sizeClassTable");
+			if (sizeClassTableNode) {
+				rt = verifySizeClassTable(sizeClassTableNode);
+				ASSERT_EQ(0, rt) << "Failed in size class table verification.";
+			}
+			pugi::xml_node allocationCacheMagazinesNode = configChild.child("allocationCacheMagazines");
+			if (allocationCacheMagazinesNode) {
+				rt = verifyAllocationCacheMagazines(allocationCacheMagazinesNode);
+				ASSERT_EQ(0, rt) << "Failed in allocation cache magazine verification.";
+			}
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+			pugi::xml_node cardTableSummaryNode = configChild.child("cardTableSummary");
+			if (cardTableSummaryNode) {
+				rt = verifyCardTableSummary(cardTableSummaryNode);
+				ASSERT_EQ(0, rt) << "Failed in card table summary verification.";
+			}
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 			gcTestEnv->log("[ Verification Successful ]\n\n");
 		} else if (0 == strcmp(configChild.name(), "operation")) {
 			gcTestEnv->log("\n++++++++++++++++++++++++++++Operation+++++++++++++++++++++++++++\n");
@@ -25,6 +25,10 @@
 #include "GCExtensionsBase.hpp"
 #include "gcTestHelpers.hpp"
 #include "GlobalCollector.hpp"
+#include "LoadBarrier.hpp"
+#include "MarkMap.hpp"
+#include "mmomrhook.h"
+#include "omragent.h"
 #include "omrlinkedlist.h"
 #include "ObjectAllocationInterface.hpp"
 #include "ObjectModel.hpp"
@@ -69,6 +73,53 @@ typedef struct XmlStr {
 	const char *structure;
 } XmlStr;
 
+typedef struct HeapIterationTotals {
+	MM_MarkMap *markMap; /**< set to count only the marked objects of a serial walk */
+	uintptr_t batchSize;
+	volatile uintptr_t objectCount;
+	volatile uintptr_t objectBytes;
+	volatile uintptr_t batchCount;
+	volatile uintptr_t invalidBatches; /**< empty or oversized batches, or batches holding an object without a size */
+} HeapIterationTotals;
+
+typedef struct CardTableSummaryTotals {
+	uintptr_t forcedCycles; /**< concurrent cycles run with the remembered set forced into overflow */
+	uintptr_t uncleanCards; /**< unclean cards left for final card cleaning by those cycles */
+	uintptr_t skippedCards; /**< unclean cards left after final card cleaning */
+	uintptr_t unsummarizedCards; /**< unclean cards with a clean summary card, which card cleaning would skip */
+} CardTableSummaryTotals;
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+typedef struct MagazineTestState {
+	OMR_VM *omrVM;
+	omrthread_monitor_t monitor; /**< guards the counts and flags below */
+	uintptr_t objectsPerThread;
+	uintptr_t attachedThreads;
+	uintptr_t parkedThreads; /**< threads done allocating, still holding their caches and spare magazines */
+	uintptr_t exitedThreads;
+	bool started;
+	bool released;
+} MagazineTestState;
+
+typedef struct MagazineWorker {
+	MagazineTestState *state;
+	uintptr_t index;
+	OMR_VMThread *omrVMThread;
+	omrobjectptr_t *objects; /**< objects allocated by this thread, all garbage */
+	uintptr_t objectCount;
+	uint64_t replenishes; /**< cache replenishes while allocating the objects */
+	uint64_t magazineLoads; /**< the replenishes served by a spare or depot magazine */
+} MagazineWorker;
+
+typedef struct MagazineWalkTotals {
+	omrobjectptr_t *objects; /**< sorted objects of all workers */
+	uintptr_t objectCount;
+	uintptr_t walkedObjects;
+	uintptr_t foundObjects; /**< walked objects that are in objects */
+	uintptr_t invalidObjects; /**< walked objects that overrun their cell */
+} MagazineWalkTotals;
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+
 class GCConfigTest : public ::testing::Test, public ::testing::WithParamInterface<const char *>
 {
 	/*
@@ -87,6 +138,12 @@ protected:
 	char *verboseFile;
 	uintptr_t numOfFiles;
 
+	/* allocation profiling options */
+	const char *allocationSite; /**< namePrefix of the object node being allocated, used as the allocation site key */
+
+	/* card table summary options */
+	CardTableSummaryTotals cardTableSummaryTotals;
+
 	/*
 	 * Function members
 	 */
@@ -107,7 +164,29 @@ protected:
 #if defined(OMRGCTEST_PRINTFILE)
 	void printFile(const char *name);
 #endif
+	pugi::xml_parse_result loadVerboseLog(pugi::xml_document &verboseDoc, const char *fileName);
 	int32_t verifyVerboseGC(pugi::xpath_node_set verboseGCs);
+	int32_t verifyAllocationSites(pugi::xml_node node);
+	static void allocationSampleHook(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData);
+	int32_t verifyHeapIteration(pugi::xml_node node);
+	static void heapObjectsCallback(OMR_VMThread *vmThread, const OMR_TI_HeapObject *objects, uintptr_t objectCount, void *userData);
+	static void countMarkedObject(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectptr_t object, void *userData);
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	int32_t verifySizeClassProfile(pugi::xml_node node);
+	int32_t verifySizeClassTable(pugi::xml_node node);
+	int32_t verifyAllocationCacheMagazines(pugi::xml_node node);
+	void walkSegregatedHeap(MagazineWalkTotals *totals);
+	static int J9THREAD_PROC magazineWorkerMain(void *entryArg);
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+	int32_t verifyCardTableSummary(pugi::xml_node node);
+	void setReachableRemembered(omrobjectptr_t objectPtr, bool remembered);
+	void setRootsRemembered(bool remembered);
+	void countUncleanCards(uintptr_t *uncleanCards, uintptr_t *unsummarizedCards);
+	static void cardTableSummaryKickoffHook(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData);
+	static void cardTableSummaryExclusiveAccessHook(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData);
+	static void cardTableSummaryCardCleaningEndHook(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData);
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 	int32_t parseGarbagePolicy(pugi::xml_node node);
 	int32_t triggerOperation(pugi::xml_node node);
 	int32_t iniXMLStr(const char *configStyle);
@@ -133,7 +212,12 @@ protected:
 	{
 		ObjectEntry searchEntry;
 		searchEntry.name = name;
-		return (ObjectEntry *)hashTableFind(exampleVM->objectTable, &searchEntry);
+		ObjectEntry *objectEntry = (ObjectEntry *)hashTableFind(exampleVM->objectTable, &searchEntry);
+		if (NULL != objectEntry) {
+			/* objectTable is not scanned as a root, so entries are loaded through the barrier */
+			loadBarrierOffHeap(exampleVM->_omrVMThread, &objectEntry->objPtr);
+		}
+		return objectEntry;
 	}
 
 	ObjectEntry *
@@ -159,6 +243,7 @@ public:
 		, verboseManager(NULL)
 		, verboseFile(NULL)
 		, numOfFiles(0)
+		, allocationSite(NULL)
 	{
 		gp.namePrefix = NULL;
 		gp.percentage = 0.0f;
@@ -167,6 +252,8 @@ public:
 		gp.garbageSeq = 0;
 		gp.accumulatedSize = 0;
 
+		memset(&cardTableSummaryTotals, 0, sizeof(cardTableSummaryTotals));
+
 		xs.object = NULL;
 		xs.namePrefix = NULL;
 		xs.type = NULL;
@@ -0,0 +1,67 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#if !defined(GCUNITTEST_HPP_INCLUDED)
+#define GCUNITTEST_HPP_INCLUDED
+
+#include "CollectorLanguageInterface.hpp"
+#include "EnvironmentBase.hpp"
+#include "gcTestHelpers.hpp"
+
+/**
+ * Fixture for tests that drive GC components directly rather than through an allocation
+ * configuration. The heap, collector and dispatcher are started from a gc-config file whose
+ * <option> element selects the components under test; nothing is allocated.
+ */
+class GCUnitTest : public ::testing::Test
+{
+	/*
+	 * Data members
+	 */
+protected:
+	OMR_VM_Example *exampleVM;
+	MM_EnvironmentBase *env;
+	MM_CollectorLanguageInterface *cli;
+
+	/*
+	 * Function members
+	 */
+protected:
+	/**
+	 * Start the heap, collector and dispatcher threads configured by configFile and attach the calling thread.
+	 * Call with ASSERT_NO_FATAL_FAILURE() from SetUp().
+	 * @param configFile the gc-config file, relative to the source root
+	 */
+	void startVM(const char *configFile);
+
+	virtual void TearDown();
+
+public:
+	GCUnitTest()
+		: ::testing::Test()
+		, exampleVM(&(gcTestEnv->exampleVM))
+		, env(NULL)
+		, cli(NULL)
+	{
+	}
+};
+
+#endif /* GCUNITTEST_HPP_INCLUDED */
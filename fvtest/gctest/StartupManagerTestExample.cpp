@@ -82,8 +82,54 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 					extensions->allowMergedSpaces = atoi(attr.value()) * unitSize;
 				} else if (0 == strcmp(attr.name(), "maxSizeDefaultMemorySpace")) {
 					extensions->maxSizeDefaultMemorySpace = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "workStealingDequeSize")) {
+					extensions->workStealingDequeSize = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "markingPrefetchDepth")) {
+					extensions->markingPrefetchDepth = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "freeListSizeClassIndex")) {
+					extensions->freeListSizeClassIndex = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "tlhAdaptiveSizing")) {
+					extensions->tlhAdaptiveSizing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "tlhAdaptiveRefreshInterval")) {
+					extensions->tlhAdaptiveRefreshInterval = atoi(attr.value());
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+				} else if (0 == strcmp(attr.name(), "batchClearTLH")) {
+					extensions->batchClearTLH = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "tlhPrezeroing")) {
+					extensions->tlhPrezeroing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "tlhPrezeroChunkSize")) {
+					extensions->tlhPrezeroChunkSize = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "tlhPrezeroMaximumBytes")) {
+					extensions->tlhPrezeroMaximumBytes = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "tlhPrezeroMaximumFreePercent")) {
+					extensions->tlhPrezeroMaximumFreePercent = atoi(attr.value());
+#endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+				} else if (0 == strcmp(attr.name(), "sizeClassTable")) {
+					if (strlen(attr.value()) < sizeof(_sizeClassTable)) {
+						strcpy(_sizeClassTable, attr.value());
+						extensions->sizeClassTable = _sizeClassTable;
+					} else {
+						gcTestEnv->log(LEVEL_ERROR, "Failed: sizeClassTable is too long: %s\n", attr.value());
+						result = false;
+					}
+				} else if (0 == strcmp(attr.name(), "sizeClassProfiling")) {
+					extensions->sizeClassProfiling = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "allocationCacheMagazineCount")) {
+					extensions->allocationCacheMagazineCount = atoi(attr.value());
+					if (0 == extensions->allocationCacheMagazineCount) {
+						gcTestEnv->log(LEVEL_ERROR, "Failed: allocationCacheMagazineCount must be at least 1\n");
+						result = false;
+					}
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+				} else if (0 == strcmp(attr.name(), "numaAwarePacketLists")) {
+					extensions->numaAwarePacketLists = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "simulatedNUMANodeCount")) {
+					extensions->_numaManager.setSimulatedNodeCountForFVTest(atoi(attr.value()));
 				} else if (0 == strcmp(attr.name(), "gcthreadCount")) {
-					/* TODO: support multi-thread GC*/
+					extensions->gcThreadCount = atoi(attr.value());
+					extensions->gcThreadCountSpecified = true;
+					extensions->gcThreadCountForced = true;
 				} else if (0 == strcmp(attr.name(), "GCPolicy")) {
 					if (0 == j9_cmdla_stricmp(attr.value(), "gencon")) {
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -91,8 +137,14 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 #else
 						gcTestEnv->log(LEVEL_ERROR, "WARNING: GCPolicy=gencon ignored, requires OMR_GC_MODRON_SCAVENGER (see configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+					} else if (0 == j9_cmdla_stricmp(attr.value(), "segregated")) {
+#if defined(OMR_GC_SEGREGATED_HEAP)
+						_useSegregatedGC = true;
+#else
+						gcTestEnv->log(LEVEL_ERROR, "WARNING: GCPolicy=segregated ignored, requires OMR_GC_SEGREGATED_HEAP (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 					} else  if (0 != j9_cmdla_stricmp(attr.value(), "optavgpause")) {
-						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized GC policy (expected gencon or optavgpause): %s\n", attr.value());
+						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized GC policy (expected gencon, optavgpause or segregated): %s\n", attr.value());
 						result = false;
 					}
 				} else if (0 == strcmp(attr.name(), "concurrentMark")) {
@@ -101,11 +153,78 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 #else
 					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentMark=true ignored, requires OMR_GC_MODRON_CONCURRENT_MARK (see configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK)*/
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+				} else if (0 == strcmp(attr.name(), "concurrentSlack")) {
+					extensions->concurrentSlack = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "optimizeConcurrentWB")) {
+					extensions->optimizeConcurrentWB = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "cardTableSummary")) {
+					extensions->cardTableSummary = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "concurrentPacing")) {
+					extensions->concurrentPacing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "concurrentPacingHistory")) {
+					extensions->concurrentPacingHistory = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "concurrentMarkDedicatedThreads")) {
+					extensions->concurrentMarkDedicatedThreads = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "concurrentMarkCPUBudget")) {
+					extensions->concurrentMarkCPUBudget = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "satbBarrier")) {
+#if defined(OMR_GC_REALTIME)
+					extensions->configurationOptions._forceOptionWriteBarrierSATB = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: satbBarrier=true ignored, requires OMR_GC_REALTIME (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_REALTIME) */
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+				} else if (0 == strcmp(attr.name(), "concurrentSweep")) {
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+					extensions->concurrentSweep = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentSweep=true ignored, requires OMR_GC_CONCURRENT_SWEEP (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
+				} else if (0 == strcmp(attr.name(), "concurrentSweepHelperThreads")) {
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+					extensions->concurrentSweepHelperThreads = atoi(attr.value());
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
+				} else if (0 == strcmp(attr.name(), "binaryLogging")) {
+					extensions->binaryLogging = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "allocationSamplingInterval")) {
+					extensions->allocationSamplingInterval = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "idleHeapUncommit")) {
+					extensions->idleHeapUncommit = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "idleHeapUncommitIntervalMillis")) {
+					extensions->idleHeapUncommitIntervalMillis = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "idleHeapUncommitAllocationRate")) {
+					extensions->idleHeapUncommitAllocationRate = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "idleHeapUncommitIdleSamples")) {
+					extensions->idleHeapUncommitIdleSamples = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "idleHeapUncommitRetainPercent")) {
+					extensions->idleHeapUncommitRetainPercent = atoi(attr.value());
+#if defined(OMR_GC_MODRON_COMPACTION)
+				} else if (0 == strcmp(attr.name(), "compactOnGlobalGC")) {
+					extensions->compactOnGlobalGC = atoi(attr.value());
+					extensions->noCompactOnGlobalGC = (0 == extensions->compactOnGlobalGC) ? 1 : 0;
+				} else if (0 == strcmp(attr.name(), "compactIncrementSubAreas")) {
+					extensions->compactIncrementSubAreas = atoi(attr.value());
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 				} else if (0 == strcmp(attr.name(), "forceBackOut")) {
 					extensions->fvtest_forceScavengerBackout = (0 == j9_cmdla_stricmp(attr.value(), "true"));
 				} else if (0 == strcmp(attr.name(), "forcePoisonEvacuate")) {
 					extensions->fvtest_forcePoisonEvacuate = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerNonTemporalCopyThreshold")) {
+					extensions->scavengerNonTemporalCopyThreshold = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "scavengerChunkedCopyThreshold")) {
+					extensions->scavengerChunkedCopyThreshold = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "scvTenureStrategyCost")) {
+					extensions->scvTenureStrategyCost = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerAutoHotFields")) {
+					extensions->scavengerAutoHotFields = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "concurrentScavenger")) {
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+					extensions->concurrentScavenger = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentScavenger=true ignored, requires OMR_GC_CONCURRENT_SCAVENGER\n");
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 				} else if ((0 == strcmp(attr.name(), "verboseLog")) || (0 == strcmp(attr.name(), "numOfFiles")) || (0 == strcmp(attr.name(), "numOfCycles")) || (0 == strcmp(attr.name(), "sizeUnit"))) {
 				} else {
@@ -116,6 +235,11 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 #if defined(OMR_GC_MODRON_SCAVENGER)
 			extensions->fvtest_forceScavengerBackout &= extensions->scavengerEnabled;
 			extensions->fvtest_forcePoisonEvacuate &= extensions->scavengerEnabled;
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+			/* the software load barrier stands in for hardware guarded loads */
+			extensions->concurrentScavenger &= extensions->scavengerEnabled;
+			extensions->softwareRangeCheckReadBarrier = extensions->concurrentScavenger;
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
 #endif /* OMR_GC_MODRON_SCAVENGER */
 		}
 	}
@@ -0,0 +1,147 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "GCUnitTest.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "HeapMapIterator.hpp"
+#include "MarkingScheme.hpp"
+#include "MarkMap.hpp"
+#include "ParallelGlobalGC.hpp"
+
+#define HMI_TEST_MAP_WORDS 48
+
+class HeapMapIteratorTest : public GCUnitTest
+{
+protected:
+	MM_MarkMap *markMap;
+	uintptr_t *rangeBase;
+	uintptr_t *rangeTop;
+
+	virtual void
+	SetUp()
+	{
+		ASSERT_NO_FATAL_FAILURE(startVM("fvtest/gctest/configuration/global_GC_workstealing_config.xml"));
+
+		MM_GCExtensionsBase *extensions = env->getExtensions();
+		markMap = ((MM_ParallelGlobalGC *)extensions->getGlobalCollector())->getMarkingScheme()->getMarkMap();
+
+		/* Start and end the range part way into a map word, so partial first and last words are covered */
+		uintptr_t grain = markMap->getObjectGrain();
+		uint8_t *mapBase = (uint8_t *)extensions->heap->getHeapBase();
+		rangeBase = (uintptr_t *)(mapBase + (5 * grain));
+		rangeTop = (uintptr_t *)(mapBase + (((HMI_TEST_MAP_WORDS * OMRBITS_BITS_IN_SLOT) - 7) * grain));
+		markMap->setBitsInRange(env, mapBase, mapBase + (HMI_TEST_MAP_WORDS * OMRBITS_BITS_IN_SLOT * grain), true);
+	}
+
+	virtual void
+	TearDown()
+	{
+		if (NULL != env) {
+			uint8_t *mapBase = (uint8_t *)env->getExtensions()->heap->getHeapBase();
+			markMap->setBitsInRange(env, mapBase, mapBase + (HMI_TEST_MAP_WORDS * OMRBITS_BITS_IN_SLOT * markMap->getObjectGrain()), true);
+		}
+		GCUnitTest::TearDown();
+	}
+
+	/**
+	 * Fill the map with empty runs, full words, random words and words with only the top or bottom bit set,
+	 * including bits just outside the range on both sides.
+	 */
+	void
+	markPattern()
+	{
+		uintptr_t grain = markMap->getObjectGrain();
+		uint8_t *mapBase = (uint8_t *)env->getExtensions()->heap->getHeapBase();
+		uint32_t seed = 0x9e3779b9;
+
+		for (uintptr_t word = 0; word < HMI_TEST_MAP_WORDS; word++) {
+			for (uintptr_t bit = 0; bit < OMRBITS_BITS_IN_SLOT; bit++) {
+				bool mark = false;
+				switch (word % 6) {
+				case 0:
+				case 4:
+					break;
+				case 1:
+					mark = true;
+					break;
+				case 2:
+				case 5:
+					seed = (seed * 1103515245) + 12345;
+					mark = (0 != ((seed >> 16) & 1));
+					break;
+				case 3:
+					mark = ((0 == bit) || ((OMRBITS_BITS_IN_SLOT - 1) == bit));
+					break;
+				}
+				/* The first and last words straddle the range boundaries */
+				mark = mark || (0 == word) || ((HMI_TEST_MAP_WORDS - 1) == word);
+				if (mark) {
+					markMap->setBit((omrobjectptr_t)(mapBase + (((word * OMRBITS_BITS_IN_SLOT) + bit) * grain)));
+				}
+			}
+		}
+	}
+};
+
+/**
+ * nextObjects() decodes a whole map word at a time; for any batch size it must return the same objects,
+ * in the same order, as repeated calls to nextObject(), and keep returning 0 once the range is exhausted.
+ */
+TEST_F(HeapMapIteratorTest, NextObjectsMatchesNextObject)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	std::vector<omrobjectptr_t> expected;
+	omrobjectptr_t object = NULL;
+
+	markPattern();
+	MM_HeapMapIterator objectIterator(extensions, markMap, rangeBase, rangeTop, false);
+	while (NULL != (object = objectIterator.nextObject())) {
+		ASSERT_TRUE(markMap->isBitSet(object));
+		ASSERT_LE((uintptr_t *)rangeBase, (uintptr_t *)object);
+		ASSERT_GT((uintptr_t *)rangeTop, (uintptr_t *)object);
+		expected.push_back(object);
+	}
+	ASSERT_LT((size_t)OMRBITS_BITS_IN_SLOT, expected.size());
+
+	const uintptr_t batchSizes[] = {1, 2, 7, 32, OMRBITS_BITS_IN_SLOT, OMRBITS_BITS_IN_SLOT + 1, 1000};
+	for (size_t i = 0; i < sizeof(batchSizes) / sizeof(batchSizes[0]); i++) {
+		uintptr_t batchSize = batchSizes[i];
+		omrobjectptr_t objects[1000];
+		size_t found = 0;
+		uintptr_t batchCount = 0;
+
+		MM_HeapMapIterator batchIterator(extensions, markMap, rangeBase, rangeTop, false);
+		while (0 != (batchCount = batchIterator.nextObjects(objects, batchSize))) {
+			ASSERT_GE(batchSize, batchCount);
+			for (uintptr_t j = 0; j < batchCount; j++) {
+				ASSERT_GT(expected.size(), found) << "batch size " << batchSize;
+				ASSERT_EQ(expected[found], objects[j]) << "batch size " << batchSize << ", object " << found;
+				found += 1;
+			}
+		}
+		ASSERT_EQ(expected.size(), found) << "batch size " << batchSize;
+		ASSERT_EQ((uintptr_t)0, batchIterator.nextObjects(objects, batchSize));
+		ASSERT_TRUE(NULL == batchIterator.nextObject());
+	}
+}
@@ -0,0 +1,178 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK) && defined(OMR_GC_REALTIME)
+
+#include "GCUnitTest.hpp"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "MarkingScheme.hpp"
+#include "omrthread.h"
+#include "Packet.hpp"
+#include "ParallelGlobalGC.hpp"
+#include "WorkPacketsSATB.hpp"
+
+#define SATB_TEST_THREADS 4
+#define SATB_TEST_PACKETS_PER_THREAD 32
+#define SATB_TEST_PACKETS (SATB_TEST_THREADS * SATB_TEST_PACKETS_PER_THREAD)
+
+/**
+ * A mutator that publishes its share of full barrier packets.
+ */
+struct BarrierPacketPublisher {
+	OMR_VM *omrVM;
+	MM_WorkPacketsSATB *workPackets;
+	MM_Packet **packets;
+	uintptr_t count;
+	volatile uintptr_t *finished;
+	omr_error_t rc;
+};
+
+static int J9THREAD_PROC
+publishBarrierPackets(void *arg)
+{
+	BarrierPacketPublisher *publisher = (BarrierPacketPublisher *)arg;
+	OMR_VMThread *omrVMThread = NULL;
+
+	publisher->rc = OMR_Thread_Init(publisher->omrVM, NULL, &omrVMThread, "SATBBarrierPublisher");
+	if (OMR_ERROR_NONE == publisher->rc) {
+		MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+		for (uintptr_t i = 0; i < publisher->count; i++) {
+			publisher->workPackets->putFullPacket(env, publisher->packets[i]);
+		}
+		publisher->rc = OMR_Thread_Free(omrVMThread);
+	}
+	MM_AtomicOperations::add(publisher->finished, 1);
+
+	return 0;
+}
+
+class WorkPacketsSATBTest : public GCUnitTest
+{
+protected:
+	MM_WorkPacketsSATB *workPackets;
+
+	virtual void
+	SetUp()
+	{
+		/* optavgpause concurrent mark with the SATB barrier; nothing is allocated, so no cycle starts */
+		ASSERT_NO_FATAL_FAILURE(startVM("fvtest/gctest/configuration/optavgpause_GC_satb_config.xml"));
+
+		MM_GCExtensionsBase *extensions = env->getExtensions();
+		ASSERT_TRUE(extensions->usingSATBBarrier());
+		workPackets = (MM_WorkPacketsSATB *)((MM_ParallelGlobalGC *)extensions->getGlobalCollector())->getMarkingScheme()->getWorkPackets();
+		workPackets->resetFullBarrierPacketCounts();
+	}
+
+	static void *
+	marker(uintptr_t index)
+	{
+		return (void *)(0x10000 + (index * 0x40));
+	}
+};
+
+/**
+ * Several mutators publish full barrier packets while a marking thread keeps taking the stack in bulk.
+ * Published packets must not be visible to the packet lists until they are moved, and every packet must
+ * be moved exactly once, whichever push a move races with.
+ */
+TEST_F(WorkPacketsSATBTest, PutFullPacketWhileMoving)
+{
+	MM_Packet *packets[SATB_TEST_PACKETS];
+	BarrierPacketPublisher publishers[SATB_TEST_THREADS];
+	omrthread_t threads[SATB_TEST_THREADS];
+	volatile uintptr_t finished = 0;
+	uintptr_t seen[SATB_TEST_PACKETS] = {0};
+
+	ASSERT_TRUE(workPackets->isAllPacketsEmpty());
+	for (uintptr_t i = 0; i < SATB_TEST_PACKETS; i++) {
+		packets[i] = workPackets->getBarrierPacket(env);
+		ASSERT_TRUE(NULL != packets[i]);
+		ASSERT_TRUE(packets[i]->push(env, marker(i)));
+	}
+
+	/* Published but not yet moved packets are on no list */
+	workPackets->putFullPacket(env, packets[0]);
+	ASSERT_TRUE(workPackets->fullBarrierPacketsAvailable());
+	ASSERT_FALSE(workPackets->inputPacketAvailable(env));
+	ASSERT_FALSE(workPackets->tracingExhausted());
+	ASSERT_TRUE(workPackets->moveFullBarrierPackets(env));
+	ASSERT_TRUE(workPackets->inputPacketAvailable(env));
+	ASSERT_EQ((uintptr_t)1, workPackets->getFullBarrierPacketsMoved());
+
+	/* packets[0] is already on the full list; the publishers push the rest */
+	omrthread_attr_t attr = NULL;
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_init(&attr));
+	ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE));
+	uintptr_t started = 0;
+	for (uintptr_t i = 0; i < SATB_TEST_THREADS; i++) {
+		uintptr_t first = OMR_MAX(1, i * SATB_TEST_PACKETS_PER_THREAD);
+		publishers[i].omrVM = exampleVM->_omrVM;
+		publishers[i].workPackets = workPackets;
+		publishers[i].packets = &packets[first];
+		publishers[i].count = ((i + 1) * SATB_TEST_PACKETS_PER_THREAD) - first;
+		publishers[i].finished = &finished;
+		publishers[i].rc = OMR_ERROR_NONE;
+		if (J9THREAD_SUCCESS != omrthread_create_ex(&threads[i], &attr, 0, publishBarrierPackets, &publishers[i])) {
+			break;
+		}
+		started += 1;
+	}
+	omrthread_attr_destroy(&attr);
+
+	/* Drain concurrently with the pushes, then once more after the last one */
+	while (finished < started) {
+		workPackets->moveFullBarrierPackets(env);
+	}
+	workPackets->moveFullBarrierPackets(env);
+	for (uintptr_t i = 0; i < started; i++) {
+		omrthread_join(threads[i]);
+		ASSERT_EQ(OMR_ERROR_NONE, publishers[i].rc) << "publisher " << i;
+	}
+	ASSERT_EQ((uintptr_t)SATB_TEST_THREADS, started);
+
+	ASSERT_FALSE(workPackets->fullBarrierPacketsAvailable());
+	ASSERT_EQ((uintptr_t)SATB_TEST_PACKETS, workPackets->getFullBarrierPacketsMoved());
+	ASSERT_LE((uintptr_t)2, workPackets->getFullBarrierPacketBatches());
+	ASSERT_GE((uintptr_t)SATB_TEST_PACKETS, workPackets->getFullBarrierPacketBatches());
+
+	/* Every packet comes back from the packet lists exactly once */
+	MM_Packet *packet = NULL;
+	while (NULL != (packet = workPackets->getInputPacketNoWait(env))) {
+		void *element = NULL;
+		while (NULL != (element = packet->pop(env))) {
+			uintptr_t index = ((uintptr_t)element - (uintptr_t)marker(0)) / 0x40;
+			ASSERT_LT(index, (uintptr_t)SATB_TEST_PACKETS);
+			seen[index] += 1;
+		}
+		workPackets->putPacket(env, packet);
+	}
+	for (uintptr_t i = 0; i < SATB_TEST_PACKETS; i++) {
+		ASSERT_EQ((uintptr_t)1, seen[i]) << "packet " << i;
+	}
+	ASSERT_TRUE(workPackets->isAllPacketsEmpty());
+}
+
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) && defined(OMR_GC_REALTIME) */
@@ -0,0 +1,126 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "GCUnitTest.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "MarkingScheme.hpp"
+#include "omrgcconsts.h"
+#include "ParallelGlobalGC.hpp"
+#include "WorkStack.hpp"
+
+class WorkStackTest : public GCUnitTest
+{
+protected:
+	MM_WorkStack *workStack;
+
+	virtual void
+	SetUp()
+	{
+		/* optavgpause with work-stealing deques and several GC threads */
+		ASSERT_NO_FATAL_FAILURE(startVM("fvtest/gctest/configuration/global_GC_workstealing_config.xml"));
+
+		MM_GCExtensionsBase *extensions = env->getExtensions();
+		MM_WorkPackets *workPackets = ((MM_ParallelGlobalGC *)extensions->getGlobalCollector())->getMarkingScheme()->getWorkPackets();
+		workStack = &env->_workStack;
+		workStack->prepareForWork(env, workPackets);
+		workStack->attachWorkStealingDeque(env, extensions->dispatcher);
+		ASSERT_TRUE(workStack->workStealingDequeAttached());
+	}
+
+	virtual void
+	TearDown()
+	{
+		workStack->setPrefetchDepth(0);
+		workStack->flush(env);
+		GCUnitTest::TearDown();
+	}
+
+	static void *
+	object(uintptr_t index)
+	{
+		return (void *)(0x10000 + (index * 0x40));
+	}
+
+	static void *
+	splitTag(uintptr_t index)
+	{
+		return (void *)((index << 8) | PACKET_ARRAY_SPLIT_TAG);
+	}
+};
+
+/**
+ * Split arrays are pushed with their tag as a pair, which goes to a packet, while single elements go to the
+ * deque. Drain the stack the way a marking thread does: every array returned by popPrefetched() pushes children
+ * to the deque while it is scanned, then pops its tag with popSplitTag(). No tag may be returned as an object,
+ * each array must get its own tag, and every pushed object must come back exactly once.
+ */
+TEST_F(WorkStackTest, SplitArrayPairsWithDeque)
+{
+	const uintptr_t arrayCount = 3;
+	const uintptr_t rootCount = 2;
+	const uintptr_t childrenPerArray = 2;
+	uintptr_t pushed = 0;
+	uintptr_t popped = 0;
+	uintptr_t seen[64] = {0};
+
+	workStack->setPrefetchDepth(4);
+
+	/* arrays are objects 0..arrayCount-1, roots follow, then the children pushed while arrays are scanned */
+	for (uintptr_t i = 0; i < arrayCount; i++) {
+		workStack->push(env, object(i), splitTag(i));
+		pushed += 1;
+	}
+	workStack->flushOutputPacket(env);
+	for (uintptr_t i = arrayCount; i < (arrayCount + rootCount); i++) {
+		workStack->push(env, object(i));
+		pushed += 1;
+	}
+
+	uintptr_t nextChild = arrayCount + rootCount;
+	while (popped < pushed) {
+		void *element = workStack->popPrefetched(env);
+		ASSERT_TRUE(NULL != element);
+		ASSERT_EQ((uintptr_t)0, ((uintptr_t)element) & PACKET_ARRAY_SPLIT_TAG) << "a split array tag was returned as an object";
+		uintptr_t index = ((uintptr_t)element - (uintptr_t)object(0)) / 0x40;
+		ASSERT_LT(index, (uintptr_t)64);
+		seen[index] += 1;
+		popped += 1;
+
+		if (index < arrayCount) {
+			for (uintptr_t i = 0; i < childrenPerArray; i++) {
+				workStack->push(env, object(nextChild));
+				nextChild += 1;
+				pushed += 1;
+			}
+			ASSERT_EQ(splitTag(index), workStack->popSplitTag(env)) << "array " << index << " lost its tag";
+		} else {
+			ASSERT_TRUE(NULL == workStack->popSplitTag(env)) << "object " << index << " is not a split array";
+		}
+	}
+
+	ASSERT_EQ(arrayCount + rootCount + (arrayCount * childrenPerArray), pushed);
+	for (uintptr_t i = 0; i < pushed; i++) {
+		ASSERT_EQ((uintptr_t)1, seen[i]) << "object " << i;
+	}
+	ASSERT_TRUE(NULL == workStack->popNoWait(env));
+}
@@ -0,0 +1,144 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#include "omr.h"
+#include "omragent.h"
+#include "omrprofiler.h"
+#include "omrTest.h"
+#include "omrTestHelpers.h"
+#include "omrvm.h"
+
+#include "rasTestHelpers.hpp"
+
+class RASAllocationProfilerTest: public ::testing::Test
+{
+protected:
+	virtual void
+	SetUp()
+	{
+		OMRTEST_ASSERT_ERROR_NONE(omrTestVMInit(&testVM, rasTestEnv->getPortLibrary()));
+		OMRTEST_ASSERT_ERROR_NONE(OMR_Thread_Init(&testVM.omrVM, NULL, &vmthread, "allocationProfilerTest"));
+		ti = omr_agent_getTI();
+	}
+
+	virtual void
+	TearDown()
+	{
+		omr_ras_cleanupAllocationProfiler(&testVM.omrVM);
+		OMRTEST_ASSERT_ERROR_NONE(OMR_Thread_Free(vmthread));
+
+		/* Now clear up the VM we started for this test case. */
+		OMRTEST_ASSERT_ERROR_NONE(omrTestVMFini(&testVM));
+	}
+
+	/* Report an allocation sample the way the GC hook listener does, walking a two frame stack */
+	void
+	sample(const void *topMethod, const void *callerMethod, uintptr_t bytes)
+	{
+		vmthread->_allocationSampleBytes = bytes;
+		omr_ras_sampleStackTraceStart(vmthread, topMethod);
+		ASSERT_EQ((uintptr_t)0, vmthread->_allocationSampleBytes);
+		omr_ras_sampleStackTraceContinue(vmthread, callerMethod);
+	}
+
+	/* OMR VM data structures */
+	OMRTestVM testVM;
+	OMR_VMThread *vmthread;
+	const OMR_TI *ti;
+};
+
+TEST_F(RASAllocationProfilerTest, TopSites)
+{
+	const void *methodA = (void *)0x10;
+	const void *methodB = (void *)0x20;
+	const void *methodC = (void *)0x30;
+	const void *caller = (void *)0x40;
+
+	OMRTEST_ASSERT_ERROR_NONE(omr_ras_initAllocationProfiler(&testVM.omrVM, 2));
+
+	sample(methodA, caller, 100);
+	sample(methodB, caller, 500);
+	sample(methodA, caller, 100);
+	sample(methodC, caller, 50);
+	sample(methodA, caller, 100);
+
+	/* stack walks that are not reporting an allocation sample are not charged */
+	omr_ras_sampleStackTraceStart(vmthread, methodC);
+	omr_ras_sampleStackTraceStart(vmthread, methodC);
+
+	OMR_TI_AllocationSite sites[3];
+	int32_t writtenCount = 0;
+	uint64_t sampledBytes = 0;
+	OMRTEST_ASSERT_ERROR_NONE(ti->GetAllocationSites(vmthread, 3, sites, &writtenCount, &sampledBytes));
+	ASSERT_EQ(2, writtenCount);
+	ASSERT_EQ((uint64_t)850, sampledBytes);
+	ASSERT_EQ(methodB, sites[0].methodKey);
+	ASSERT_EQ((uint64_t)500, sites[0].bytes);
+	ASSERT_EQ(methodA, sites[1].methodKey);
+	ASSERT_EQ((uint64_t)300, sites[1].bytes);
+
+	/* a smaller buffer gets the heaviest sites */
+	OMRTEST_ASSERT_ERROR_NONE(ti->GetAllocationSites(vmthread, 1, sites, &writtenCount, NULL));
+	ASSERT_EQ(1, writtenCount);
+	ASSERT_EQ(methodB, sites[0].methodKey);
+
+	/* re-initializing discards the samples */
+	OMRTEST_ASSERT_ERROR_NONE(omr_ras_initAllocationProfiler(&testVM.omrVM, 3));
+	OMRTEST_ASSERT_ERROR_NONE(ti->GetAllocationSites(vmthread, 3, sites, &writtenCount, &sampledBytes));
+	ASSERT_EQ(0, writtenCount);
+	ASSERT_EQ((uint64_t)0, sampledBytes);
+
+	sample(methodC, caller, 50);
+	OMRTEST_ASSERT_ERROR_NONE(ti->GetAllocationSites(vmthread, 3, sites, &writtenCount, &sampledBytes));
+	ASSERT_EQ(1, writtenCount);
+	ASSERT_EQ(methodC, sites[0].methodKey);
+	ASSERT_EQ((uint64_t)50, sites[0].bytes);
+}
+
+TEST_F(RASAllocationProfilerTest, NegativeCases)
+{
+	OMR_TI_AllocationSite sites[1];
+	int32_t writtenCount = 0;
+
+	/* samples are dropped while there is no profiler */
+	sample((void *)0x10, (void *)0x20, 100);
+
+	OMRTEST_ASSERT_ERROR(OMR_THREAD_NOT_ATTACHED, ti->StartAllocationSampling(NULL, 1024, 1));
+	OMRTEST_ASSERT_ERROR(OMR_ERROR_ILLEGAL_ARGUMENT, ti->StartAllocationSampling(vmthread, 0, 1));
+	OMRTEST_ASSERT_ERROR(OMR_ERROR_ILLEGAL_ARGUMENT, ti->StartAllocationSampling(vmthread, 1024, 0));
+
+	/* this VM has no GC to report samples */
+	OMRTEST_ASSERT_ERROR(OMR_ERROR_NOT_AVAILABLE, ti->StartAllocationSampling(vmthread, 1024, 1));
+	OMRTEST_ASSERT_ERROR(OMR_ERROR_NOT_AVAILABLE, ti->StopAllocationSampling(vmthread));
+	OMRTEST_ASSERT_ERROR(OMR_ERROR_NOT_AVAILABLE, ti->GetAllocationSites(vmthread, 1, sites, &writtenCount, NULL));
+
+	OMRTEST_ASSERT_ERROR(OMR_ERROR_ILLEGAL_ARGUMENT, omr_ras_initAllocationProfiler(&testVM.omrVM, 0));
+	OMRTEST_ASSERT_ERROR_NONE(omr_ras_initAllocationProfiler(&testVM.omrVM, 1));
+
+	OMRTEST_ASSERT_ERROR(OMR_THREAD_NOT_ATTACHED, ti->GetAllocationSites(NULL, 1, sites, &writtenCount, NULL));
+	OMRTEST_ASSERT_ERROR(OMR_ERROR_ILLEGAL_ARGUMENT, ti->GetAllocationSites(vmthread, -1, sites, &writtenCount, NULL));
+	OMRTEST_ASSERT_ERROR(OMR_ERROR_ILLEGAL_ARGUMENT, ti->GetAllocationSites(vmthread, 1, NULL, &writtenCount, NULL));
+	OMRTEST_ASSERT_ERROR(OMR_ERROR_ILLEGAL_ARGUMENT, ti->GetAllocationSites(vmthread, 1, sites, NULL, NULL));
+	OMRTEST_ASSERT_ERROR_NONE(ti->GetAllocationSites(vmthread, 0, NULL, &writtenCount, NULL));
+	ASSERT_EQ(0, writtenCount);
+}
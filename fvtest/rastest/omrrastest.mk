@@ -28,6 +28,7 @@ ARTIFACT_TYPE := cxx_executable
 OBJECTS := \
   agentNegativeTest \
   agentTest \
+  allocationProfilerTest \
   main \
   memoryCategoriesTest \
   methodDictionaryTest \
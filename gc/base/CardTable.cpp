@@ -22,6 +22,11 @@
 
 #include "omrcfg.h"
 
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define OMR_CARD_SCAN_SSE2
+#endif /* defined(__SSE2__) || defined(_M_X64) */
+
 #include "CardTable.hpp"
 
 #include "AtomicOperations.hpp"
@@ -71,6 +76,43 @@ MM_CardTable::tearDown(MM_EnvironmentBase *env)
 	MM_MemoryManager *memoryManager = extensions->memoryManager;
 	/* Get rid of the virtual memory allocated for card table */
 	memoryManager->destroyVirtualMemory(env, &_cardTableMemoryHandle);
+
+	if (NULL != _summaryTable) {
+		env->getForge()->free(_summaryTable);
+		_summaryTable = NULL;
+	}
+}
+
+bool
+MM_CardTable::initializeSummaryTable(MM_EnvironmentBase *env, MM_Heap *heap)
+{
+	uintptr_t cardTableSize = calculateCardTableSize(env, heap->getMaximumPhysicalRange());
+	_summaryTableSize = MM_Math::roundToCeiling(CARD_SUMMARY_CARDS, cardTableSize) >> CARD_SUMMARY_SHIFT;
+	_summaryTable = (Card *)env->getForge()->allocate(_summaryTableSize, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _summaryTable) {
+		return false;
+	}
+	memset((void *)_summaryTable, CARD_CLEAN, _summaryTableSize);
+
+	return true;
+}
+
+void
+MM_CardTable::clearSummaryForRange(Card *lowCard, Card *highCard)
+{
+	if (NULL != _summaryTable) {
+		/* groups only partially within the range stay as they are */
+		Card *lowSummary = getSummaryForCard(lowCard + (CARD_SUMMARY_CARDS - 1));
+		Card *highSummary = getSummaryForCard(highCard);
+		for (Card *summary = lowSummary; summary < highSummary; summary++) {
+			if ((Card)CARD_CLEAN != *summary) {
+				Card *groupEndCard = getFirstCardForSummary(summary + 1);
+				if (groupEndCard == skipCleanCards(getFirstCardForSummary(summary), groupEndCard)) {
+					*summary = (Card)CARD_CLEAN;
+				}
+			}
+		}
+	}
 }
 
 uintptr_t
@@ -256,6 +298,7 @@ MM_CardTable::dirtyCardWithValue(MM_EnvironmentBase *env, omrobjectptr_t objectR
 		if (newValue != oldValue) {
 			Assert_MM_true((CARD_DIRTY == newValue) || (CARD_CLEAN == oldValue));
 			*card = newValue;
+			dirtySummaryForCard(card);
 		}
 	}
 }
@@ -270,6 +313,7 @@ MM_CardTable::dirtyCardRange(MM_EnvironmentBase *env, void *heapAddrFrom, void *
 		/* If card not already dirty then dirty it */
 		if ((Card)CARD_DIRTY != *card) {
 			*card = (Card)CARD_DIRTY;
+			dirtySummaryForCard(card);
 		}
 	}
 }
@@ -298,6 +342,88 @@ MM_CardTable::cardAddrToHeapAddr(MM_EnvironmentBase *env, Card *cardAddr)
 	return (void *)((uintptr_t)getHeapBase() + (((uintptr_t)cardAddr - (uintptr_t)getCardTableStart()) << CARD_SIZE_SHIFT));
 }
 
+Card *
+MM_CardTable::skipCleanCards(Card *card, Card *endCard)
+{
+#if defined(OMR_CARD_SCAN_SSE2)
+	uintptr_t const alignment = sizeof(__m128i);
+#else /* defined(OMR_CARD_SCAN_SSE2) */
+	uintptr_t const alignment = sizeof(uintptr_t);
+#endif /* defined(OMR_CARD_SCAN_SSE2) */
+
+	/* card at a time up to the first aligned group of cards */
+	while ((card < endCard) && (0 != ((uintptr_t)card % alignment))) {
+		if ((Card)CARD_CLEAN != *card) {
+			return card;
+		}
+		card += 1;
+	}
+
+#if defined(OMR_CARD_SCAN_SSE2)
+	/* CARD_CLEAN is zero, so a group of cards is clean if the OR of its vectors compares equal to zero */
+	__m128i const clean = _mm_setzero_si128();
+	while ((uintptr_t)(endCard - card) >= (4 * sizeof(__m128i))) {
+		__m128i cards = _mm_or_si128(
+				_mm_or_si128(_mm_load_si128((__m128i *)card), _mm_load_si128((__m128i *)(card + sizeof(__m128i)))),
+				_mm_or_si128(_mm_load_si128((__m128i *)(card + (2 * sizeof(__m128i)))), _mm_load_si128((__m128i *)(card + (3 * sizeof(__m128i))))));
+		if (0xFFFF != _mm_movemask_epi8(_mm_cmpeq_epi8(cards, clean))) {
+			break;
+		}
+		card += 4 * sizeof(__m128i);
+	}
+	while ((uintptr_t)(endCard - card) >= sizeof(__m128i)) {
+		if (0xFFFF != _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128((__m128i *)card), clean))) {
+			break;
+		}
+		card += sizeof(__m128i);
+	}
+#else /* defined(OMR_CARD_SCAN_SSE2) */
+	while ((uintptr_t)(endCard - card) >= sizeof(uintptr_t)) {
+		if ((uintptr_t)CARD_CLEAN != *(uintptr_t *)card) {
+			break;
+		}
+		card += sizeof(uintptr_t);
+	}
+#endif /* defined(OMR_CARD_SCAN_SSE2) */
+
+	/* the first unclean card is within the next group, or the tail is shorter than a group */
+	while ((card < endCard) && ((Card)CARD_CLEAN == *card)) {
+		card += 1;
+	}
+
+	return card;
+}
+
+Card *
+MM_CardTable::findUncleanCard(Card *card, Card *endCard)
+{
+	if (NULL == _summaryTable) {
+		return skipCleanCards(card, endCard);
+	}
+
+	while (card < endCard) {
+		Card *summary = getSummaryForCard(card);
+		if ((Card)CARD_CLEAN == *summary) {
+			/* skip to the next group which may hold an unclean card */
+			Card *endSummary = getSummaryForCard(endCard - 1) + 1;
+			summary = skipCleanCards(summary, endSummary);
+			if (summary >= endSummary) {
+				break;
+			}
+			card = getFirstCardForSummary(summary);
+		}
+
+		Card *groupEndCard = OMR_MIN(endCard, getFirstCardForSummary(summary + 1));
+		Card *uncleanCard = skipCleanCards(card, groupEndCard);
+		if (uncleanCard < groupEndCard) {
+			return uncleanCard;
+		}
+		card = groupEndCard;
+	}
+
+	return endCard;
+}
+
 MMINLINE void
 MM_CardTable::cleanRange(MM_EnvironmentBase *env, MM_CardCleaner *cardCleaner, Card *low, Card *high)
 {
@@ -305,13 +431,18 @@ MM_CardTable::cleanRange(MM_EnvironmentBase *env, MM_CardCleaner *cardCleaner, C
 	Card *endCard = high;
 	uintptr_t cardsCleaned = 0;
 	while (thisCard < endCard) {
-		if (CARD_CLEAN != *thisCard) {
-			void *lowAddress = (void *)cardAddrToHeapAddr(env, thisCard);
-			void *highAddress = (void *)((uintptr_t)lowAddress + CARD_SIZE);
-			
-			cardCleaner->clean(env, lowAddress, highAddress, thisCard);
-			cardsCleaned += 1;
+		Card *dirtyCard = findUncleanCard(thisCard, endCard);
+		if (dirtyCard >= endCard) {
+			break;
 		}
+		env->_cardCleaningStats.recordCleanRun((uintptr_t)(dirtyCard - thisCard));
+		thisCard = dirtyCard;
+
+		void *lowAddress = (void *)cardAddrToHeapAddr(env, thisCard);
+		void *highAddress = (void *)((uintptr_t)lowAddress + CARD_SIZE);
+
+		cardCleaner->clean(env, lowAddress, highAddress, thisCard);
+		cardsCleaned += 1;
 		thisCard += 1;
 	}
 	env->_cardCleaningStats._cardsCleaned += cardsCleaned;
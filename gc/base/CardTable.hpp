@@ -41,6 +41,13 @@ class MM_CardCleaner;
 class MM_Heap;
 class MM_HeapRegionDescriptor;
 
+/**
+ * Number of cards (as a shift) covered by one summary card, see MM_CardTable::_summaryTable.
+ * @ingroup GC_Base
+ */
+#define CARD_SUMMARY_SHIFT 9
+#define CARD_SUMMARY_CARDS ((uintptr_t)1 << CARD_SUMMARY_SHIFT)
+
 /**
  * @todo Provide typedef documentation
  * @ingroup GC_Base
@@ -62,6 +69,8 @@ private:
 	Card *_cardTableStart;
 	Card *_cardTableVirtualStart;
 	void *_heapBase; 
+	Card *_summaryTable; /**< one card per CARD_SUMMARY_CARDS cards, not CARD_CLEAN if any of them may be unclean; NULL if not in use */
+	uintptr_t _summaryTableSize; /**< size of _summaryTable in bytes */
 
 
 public:
@@ -134,6 +143,44 @@ public:
 	 * @return The lowest address of the heap which the given card tracks 
 	 */
 	void *cardAddrToHeapAddr(MM_EnvironmentBase *env, Card *cardAddr);	
+
+	/**
+	 * Skip the run of clean cards starting at card. The card table is expected to be mostly clean, so
+	 * cards are compared a vector at a time where the platform supports it (a uintptr_t at a time otherwise).
+	 * @param[in] card The first card to check
+	 * @param[in] endCard The card immediately AFTER the last card to check
+	 * @return The first card in [card, endCard) which is not CARD_CLEAN, or endCard if all are clean
+	 */
+	static Card *skipCleanCards(Card *card, Card *endCard);
+
+	/**
+	 * Find the first unclean card in a range. Where the summary table is in use, groups of cards with a
+	 * clean summary card are skipped without reading their cards.
+	 * @param[in] card The first card to check
+	 * @param[in] endCard The card immediately AFTER the last card to check
+	 * @return The first card in [card, endCard) which is not CARD_CLEAN, or endCard if all are clean
+	 */
+	Card *findUncleanCard(Card *card, Card *endCard);
+
+	/**
+	 * Record that a card may be unclean in the summary table. Must be called after any card is set to a
+	 * value other than CARD_CLEAN.
+	 * @param[in] card The card
+	 */
+	MMINLINE void dirtySummaryForCard(Card *card)
+	{
+		if (NULL != _summaryTable) {
+			Card *summary = getSummaryForCard(card);
+			if ((Card)CARD_DIRTY != *summary) {
+				*summary = (Card)CARD_DIRTY;
+			}
+		}
+	}
+
+	/**
+	 * @return true if the summary table is in use
+	 */
+	MMINLINE bool isSummaryTableEnabled() { return NULL != _summaryTable; }
 	
 	/**
 	 * Called to request that that the CardTable for entire heap range be cleaned.
@@ -257,6 +304,31 @@ protected:
 	 * @return false if the decommit failed
 	 */
 	bool decommitCardTableMemory(MM_EnvironmentBase *env, Card *lowCard, Card *highCard, Card *lowValidCard, Card *highValidCard);
+
+	/**
+	 * Allocate the summary table, with all summary cards clean.
+	 * @param env[in] The main GC thread
+	 * @param heap[in] The heap which this card table is meant to describe
+	 * @return false if the summary table could not be allocated
+	 */
+	bool initializeSummaryTable(MM_EnvironmentBase *env, MM_Heap *heap);
+
+	/**
+	 * Clear the summary cards of the groups of cards entirely within [lowCard, highCard) whose cards are
+	 * all clean. Groups holding an unclean card keep a dirty summary card.
+	 * @note The caller must guarantee that none of those cards is being dirtied.
+	 */
+	void clearSummaryForRange(Card *lowCard, Card *highCard);
+
+	MMINLINE Card *getSummaryForCard(Card *card)
+	{
+		return _summaryTable + (((uintptr_t)card - (uintptr_t)_cardTableStart) >> CARD_SUMMARY_SHIFT);
+	}
+
+	MMINLINE Card *getFirstCardForSummary(Card *summary)
+	{
+		return _cardTableStart + (((uintptr_t)summary - (uintptr_t)_summaryTable) << CARD_SUMMARY_SHIFT);
+	}
 	
 	/**
 	 * Create a CardTable object.
@@ -268,6 +340,8 @@ protected:
 		, _cardTableStart(NULL)
 		, _cardTableVirtualStart(NULL)
 		, _heapBase(NULL)
+		, _summaryTable(NULL)
+		, _summaryTableSize(0)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -500,6 +500,12 @@ MM_Configuration::initializeGCParameters(MM_EnvironmentBase *env)
 	if (extensions->scavengerEnabled) {
 		if (MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_NONE == extensions->scavengerScanOrdering) {
 			extensions->scavengerScanOrdering = MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_HIERARCHICAL;
+#if defined(OMR_GC_AUTO_HOT_FIELDS)
+			if (extensions->scavengerAutoHotFields) {
+				/* learned hot fields are only used by the depth copy of dynamic breadth first scan ordering */
+				extensions->scavengerScanOrdering = MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_DYNAMIC_BREADTH_FIRST;
+			}
+#endif /* defined(OMR_GC_AUTO_HOT_FIELDS) */
 		} else if (MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_DYNAMIC_BREADTH_FIRST == extensions->scavengerScanOrdering) {
 			extensions->adaptiveGcCountBetweenHotFieldSort = true;
 		}
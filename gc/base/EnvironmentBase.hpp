@@ -66,7 +66,9 @@ typedef enum {
 	WRITE_BARRIER_THREAD,
 	CON_MARK_HELPER_THREAD,
 	GC_WORKER_THREAD,
-	GC_MAIN_THREAD
+	GC_MAIN_THREAD,
+	CON_SWEEP_HELPER_THREAD,
+	TLH_PREZERO_HELPER_THREAD
 } ThreadType;
 
 /**
@@ -152,11 +154,14 @@ public:
 	uintptr_t _oolTraceAllocationBytes; /**< Tracks the bytes allocated since the last ool object trace */
 	uintptr_t _traceAllocationBytes;  /**< Tracks the bytes allocated since the last object trace */
 	uintptr_t _traceAllocationBytesCurrentTLH; /**< keep the bytes of times of sampling threshold for last object trace(include allocation bytes inside TLH) */
+	uintptr_t _allocationSamplingBytes; /**< Tracks the bytes allocated since the last J9HOOK_MM_OMR_ALLOCATION_SAMPLE */
 
 	uintptr_t approxScanCacheCount; /**< Local copy of approximate entries in global Cache Scan List. Updated upon allocation of new cache. */
 
 	MM_Validator *_activeValidator; /**< Used to identify and report crashes inside Validators */
 
+	uintptr_t _packetListNumaNode; /**< 0-based index of the NUMA node whose work packet sublists this thread prefers */
+
 	MM_MarkStats _markStats;
 
 	MM_RootScannerStats _rootScannerStats; /**< Per thread stats to track the performance of the root scanner */
@@ -746,8 +751,10 @@ public:
 		,_oolTraceAllocationBytes(0)
 		,_traceAllocationBytes(0)
 		,_traceAllocationBytesCurrentTLH(0)
+		,_allocationSamplingBytes(0)
 		,approxScanCacheCount(0)
 		,_activeValidator(NULL)
+		,_packetListNumaNode(0)
 		,_lastSyncPointReached(NULL)
 #if defined(OMR_GC_SEGREGATED_HEAP)
 		,_allocationTracker(NULL)
@@ -804,8 +811,10 @@ public:
 		,_oolTraceAllocationBytes(0)
 		,_traceAllocationBytes(0)
 		,_traceAllocationBytesCurrentTLH(0)
+		,_allocationSamplingBytes(0)
 		,approxScanCacheCount(0)
 		,_activeValidator(NULL)
+		,_packetListNumaNode(0)
 		,_lastSyncPointReached(NULL)
 #if defined(OMR_GC_SEGREGATED_HEAP)
 		,_allocationTracker(NULL)
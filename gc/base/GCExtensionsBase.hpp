@@ -81,6 +81,7 @@ class MM_SweepHeapSectioning;
 class MM_SweepPoolManager;
 class MM_SweepPoolManagerAddressOrderedList;
 class MM_SweepPoolManagerAddressOrderedListBase;
+class MM_TLHPrezeroer;
 class MM_RealtimeGC;
 class MM_VerboseManagerBase;
 struct J9Pool;
@@ -271,6 +272,7 @@ public:
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 	/* Temporary move from the leaf implementation */
 	bool concurrentSweep;
+	uintptr_t concurrentSweepHelperThreads; /**< number of background threads that finish a lazy sweep between collections */
 #endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
 
 	bool largePageWarnOnError;
@@ -314,6 +316,7 @@ public:
 	bool doFrequentObjectAllocationSampling; /**< Whether to track object allocations*/
 	uintptr_t oolObjectSamplingBytesGranularity; /**< How often (in bytes) we do allocation sampling as tracked by per thread's local _oolTraceAllocationBytes. */
 	uintptr_t objectSamplingBytesGranularity; /**< How often (in bytes) we do allocation sampling as tracked by per thread's local _traceAllocationBytes. */
+	uintptr_t allocationSamplingInterval; /**< How often (in bytes) each thread reports J9HOOK_MM_OMR_ALLOCATION_SAMPLE, 0 to disable. See OMR_GC_SetAllocationSamplingInterval(). */
 
 	uintptr_t frequentObjectAllocationSamplingRate; /**< # bytes to sample / # bytes allocated */
 	MM_FrequentObjectsStats* frequentObjectsStats;
@@ -328,6 +331,7 @@ public:
 	uint32_t largeObjectAllocationProfilingTopK; /**< number of most allocation size we want to track/report in large object allocation profiling */
 	MM_FreeEntrySizeClassStats freeEntrySizeClassStatsSimulated; /**< snapshot of free memory status used for simulated allocator for fragmentation estimation */
 	uintptr_t freeMemoryProfileMaxSizeClasses; /**< maximum number of sizeClass maintained for heap free memory profile (computed from SizeClassRatio) */
+	bool freeListSizeClassIndex; /**< if true, address ordered memory pools index their free list by power of two size class to shorten large allocate walks */
 
 	volatile OMR_VMThread* gcExclusiveAccessThreadId; /**< thread token that represents the current "winning" thread for performing garbage collection */
 	omrthread_monitor_t gcExclusiveAccessMutex; /**< Mutex used for acquiring gc priviledges as well as for signalling waiting threads that GC has been completed */
@@ -348,6 +352,8 @@ public:
 	uintptr_t tlhIncrementSize;
 	uintptr_t tlhSurvivorDiscardThreshold; /**< below this size GC (Scavenger) will discard survivor copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
 	uintptr_t tlhTenureDiscardThreshold; /**< below this size GC (Scavenger) will discard tenure copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
+	bool tlhAdaptiveSizing; /**< if true, each thread sizes its TLH refreshes from its own allocation rate rather than growing them by tlhIncrementSize */
+	uintptr_t tlhAdaptiveRefreshInterval; /**< with tlhAdaptiveSizing, the time in microseconds a TLH should last a thread allocating at its recent rate */
 
 	MM_AllocationStats allocationStats; /**< Statistics for allocations. */
 	uintptr_t bytesAllocatedMost;
@@ -408,6 +414,9 @@ public:
 	uintptr_t workpacketCount; /**< this value is ONLY set if -Xgcworkpackets is specified - otherwise the workpacket count is determined heuristically */
 	uintptr_t packetListSplit; /**< the number of ways to split packet lists, set by command line option, or determined heuristically based on the number of GC threads */
 	bool packetListSplitForced;  /**< Flag to distinguish if packetListSplit is externally enforced (for example, specified by command line) */
+	uintptr_t workStealingDequeSize; /**< capacity (in elements) of the per GC thread work-stealing deques used by parallel mark, 0 disables work stealing */
+	uintptr_t markingPrefetchDepth; /**< number of popped objects the marking loop keeps prefetched ahead of scanning, 0 disables the prefetch ring */
+	bool numaAwarePacketLists; /**< if true, work packet sublists are grouped per NUMA node and GC threads prefer packets from their own node */
 	uintptr_t markingArraySplitMaximumAmount; /**< maximum number of elements to split array scanning work in marking scheme */
 	uintptr_t markingArraySplitMinimumAmount; /**< minimum number of elements to split array scanning work in marking scheme */
 
@@ -459,6 +468,11 @@ public:
 
 #if defined(OMR_GC_BATCH_CLEAR_TLH)
 	uintptr_t batchClearTLH;
+	bool tlhPrezeroing; /**< if true (and batchClearTLH is set), a background thread zeroes nursery memory ahead of TLH refreshes */
+	uintptr_t tlhPrezeroChunkSize; /**< bytes the TLH zeroing thread takes from the nursery and zeroes at a time */
+	uintptr_t tlhPrezeroMaximumBytes; /**< the TLH zeroing thread keeps up to this many zeroed bytes ready */
+	uintptr_t tlhPrezeroMaximumFreePercent; /**< the TLH zeroing thread keeps at most this percentage of the free nursery zeroed */
+	MM_TLHPrezeroer *tlhPrezeroer; /**< the TLH zeroing service, NULL if tlhPrezeroing is not in effect */
 #endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
 	omrthread_monitor_t gcStatsMutex;
 	uintptr_t gcThreadCount; /**< Initial number of GC threads - chosen default or specified in java options*/
@@ -481,6 +495,7 @@ public:
 	bool depthCopyTwoPaths;
 	bool depthCopyThreePaths;
 	bool alwaysDepthCopyFirstOffset;
+	bool scavengerAutoHotFields; /**< learn the hot fields of objects the language does not describe from the slots the scavenger copies through, implies dynamicBreadthFirstScanOrdering, ignored unless built with OMR_GC_AUTO_HOT_FIELDS */
 	bool allowPermanantHotFields;
 	bool hotFieldResettingEnabled;
 	uintptr_t maxConsecutiveHotFieldSelections;
@@ -499,6 +514,7 @@ public:
 	bool scvTenureStrategyAdaptive; /**< Flag for enabling the Adaptive scavenger tenure strategy. */
 	bool scvTenureStrategyLookback; /**< Flag for enabling the Lookback scavenger tenure strategy. */
 	bool scvTenureStrategyHistory; /**< Flag for enabling the History scavenger tenure strategy. */
+	bool scvTenureStrategyCost; /**< Flag for enabling the Cost scavenger tenure strategy, which minimizes projected copy bytes plus projected tenured garbage. */
 	bool scavengerEnabled;
 	bool scavengerRsoScanUnsafe;
 	uintptr_t cacheListSplit; /**< the number of ways to split scanCache lists, set by command line option, or determined heuristically based on the number of GC threads */
@@ -592,6 +608,7 @@ public:
 	uintptr_t compactOnSystemGC;
 	uintptr_t nocompactOnSystemGC;
 	bool compactToSatisfyAllocate;
+	uintptr_t compactIncrementSubAreas; /**< if non-zero, a compaction evacuates at most this many adjacent, most fragmented sub areas and only fixes up the rest of the heap. This bounds the copy work only: fixup still visits every live object */
 #endif /* defined(OMR_GC_MODRON_COMPACTION) */
 
 	bool payAllocationTax;
@@ -607,6 +624,12 @@ public:
 	uintptr_t concurrentSlack; /**< number of bytes to add to the concurrent kickoff threshold buffer */
 	uintptr_t cardCleanPass2Boost;
 	uintptr_t cardCleaningPasses;
+	bool cardTableSummary; /**< if true, the concurrent card table keeps a summary card per CARD_SUMMARY_CARDS cards so card cleaning skips clean ranges. Every card dirtying path must go through MM_CardTable */
+	bool concurrentPacing; /**< if true, the concurrent kickoff threshold and the expected helper tracing are predicted from the rates of recent concurrent cycles */
+	uintptr_t concurrentPacingHistory; /**< number of recent concurrent cycles the pacing is predicted from (at most CONCURRENT_PACING_MAX_HISTORY) */
+	uintptr_t concurrentMarkDedicatedThreads; /**< if non-zero, concurrent marking is done by up to this many dispatcher threads and mutators pay no tracing tax */
+	uintptr_t concurrentMarkCPUBudget; /**< percentage of the CPUs available to the process (after any cgroup CPU quota) the dedicated concurrent mark threads may use */
+	volatile uint64_t concurrentMarkDedicatedCPUTime; /**< total CPU time, in microseconds, consumed by dedicated concurrent mark threads */
 
 	UDATA fvtest_concurrentCardTablePreparationDelay; /**< Delay for concurrent card table preparation in milliseconds */
 
@@ -713,6 +736,9 @@ public:
 	uintptr_t allocationCacheMaximumSize;
 	uintptr_t allocationCacheInitialSize;
 	uintptr_t allocationCacheIncrementSize;
+	const char *sizeClassTable; /**< Comma separated small cell sizes replacing the compiled-in SMALL_SIZECLASSES, only read while the heap is initialized; NULL to keep them */
+	bool sizeClassProfiling; /**< Record a histogram of allocation request sizes and report a size class table fitted to it at shutdown */
+	uintptr_t allocationCacheMagazineCount; /**< Magazines carved per region refill of a segregated allocation cache (one loaded, one spare, the rest to the allocation context depot); the default of 1 keeps the magazine layer off */
 	bool nonDeterministicSweep;
 /* OMR_GC_REALTIME (in for all) */
 
@@ -725,6 +751,7 @@ public:
 	bool verboseExtensions;
 	bool verboseNewFormat; /**< a flag, enabled by -XXgc:verboseNewFormat, to enable the new verbose GC format */
 	bool bufferedLogging; /**< Enabled by -Xgc:bufferedLogging.  Use buffered filestreams when writing logs (e.g. verbose:gc) to a file */
+	bool binaryLogging; /**< Enabled by -Xgc:binaryLogging.  Log verbose:gc to file as binary records drained by a background thread, for vgcdecode to turn into XML */
 
 	uintptr_t lowAllocationThreshold; /**< the lower bound of the allocation threshold range */
 	uintptr_t highAllocationThreshold; /**< the upper bound of the allocation threshold range */
@@ -744,6 +771,8 @@ public:
 	};
 	HeapInitializationFailureReason heapInitializationFailureReason; /**< Error code provided additional information about heap initialization failure */
 	bool scavengerAlignHotFields; /**< True if the scavenger is to check the hot field description for an object in order to better cache align it when tenuring (enabled with the -Xgc:hotAlignment option) */
+	uintptr_t scavengerNonTemporalCopyThreshold; /**< objects of at least this many bytes are copied by the scavenger with streaming stores that bypass the cache, 0 to always use memcpy */
+	uintptr_t scavengerChunkedCopyThreshold; /**< objects of at least this many bytes are split into chunks that idle scavenger threads help copy, 0 to always copy on one thread */
 	uintptr_t suballocatorInitialSize; /**< the initial chunk size in bytes for the heap suballocator (enabled with the -Xgc:suballocatorInitialSize option) */
 	uintptr_t suballocatorCommitSize; /**< the commit size in bytes for the heap suballocator (enabled with the -Xgc:suballocatorCommitSize option) */
 	uintptr_t suballocatorIncrementSize; /**< the increment size in bytes for the heap suballocator (enabled with the -Xgc:suballocatorIncrementSize option) */
@@ -867,6 +896,11 @@ public:
 	bool pretouchHeapOnExpand; /**< True to pretouch memory during initial heap inflation or heap expansion */
 
 	uintptr_t decommitMinimumFree; /**< percentage of free heap to be retained as committed, default=0 for gencon, complete tenture free memory will be decommitted */
+	bool idleHeapUncommit; /**< Enables the background service releasing free heap pages once allocation goes idle, default is false */
+	uintptr_t idleHeapUncommitIntervalMillis; /**< Time between samples of the allocation rate taken by the idle heap uncommit service */
+	uintptr_t idleHeapUncommitAllocationRate; /**< Allocation rate, in bytes per second, below which a sample counts as idle */
+	uintptr_t idleHeapUncommitIdleSamples; /**< Consecutive idle samples, with no collection in between, before free pages are released */
+	uintptr_t idleHeapUncommitRetainPercent; /**< Percentage of the container memory limit (or of the maximum heap size, if smaller) kept committed as free heap */
 
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
 	bool gcOnIdle; /**< Enables releasing free heap pages if true while systemGarbageCollect invoked with IDLE GC code, default is false */
@@ -1516,6 +1550,7 @@ public:
 #endif /* defined(OMR_GC_VLHGC) */
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 		, concurrentSweep(false)
+		, concurrentSweepHelperThreads(1)
 #endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
 		, largePageWarnOnError(false)
 		, largePageFailOnError(false)
@@ -1549,6 +1584,7 @@ public:
 		, doFrequentObjectAllocationSampling(false) /* Finds most frequently allocated classes. Disabled by default. */
 		, oolObjectSamplingBytesGranularity(16*1024*1024) /* Default granularity set to 16M (shows <1% perf loss). */
 		, objectSamplingBytesGranularity(UDATA_MAX) /* default UDATA_MAX (disabled) */
+		, allocationSamplingInterval(0) /* disabled until an agent starts allocation sampling */
 		, frequentObjectAllocationSamplingRate(100)
 		, frequentObjectsStats(NULL)
 		, frequentObjectAllocationSamplingDepth(0)
@@ -1560,6 +1596,7 @@ public:
 		, largeObjectAllocationProfilingSizeClassRatio(120)
 		, largeObjectAllocationProfilingTopK(8)
 		, freeMemoryProfileMaxSizeClasses(0)
+		, freeListSizeClassIndex(false)
 		, gcExclusiveAccessThreadId(NULL)
 		, gcExclusiveAccessMutex(NULL)
 		, _lightweightNonReentrantLockPool(NULL)
@@ -1575,6 +1612,8 @@ public:
 		, tlhIncrementSize(4096)
 		, tlhSurvivorDiscardThreshold(tlhMinimumSize)
 		, tlhTenureDiscardThreshold(tlhMinimumSize)
+		, tlhAdaptiveSizing(false)
+		, tlhAdaptiveRefreshInterval(1000)
 		, allocationStats()
 		, bytesAllocatedMost(0)
 		, vmThreadAllocatedMost(NULL)
@@ -1619,6 +1658,9 @@ public:
 		, workpacketCount(0) /* only set if -Xgcworkpackets specified */
 		, packetListSplit(0)
 		, packetListSplitForced(false)
+		, workStealingDequeSize(0)
+		, markingPrefetchDepth(0)
+		, numaAwarePacketLists(false)
 		, markingArraySplitMaximumAmount(DEFAULT_ARRAY_SPLIT_MAXIMUM_SIZE)
 		, markingArraySplitMinimumAmount(DEFAULT_ARRAY_SPLIT_MINIMUM_SIZE)
 		, rootScannerStatsEnabled(false)
@@ -1662,6 +1704,11 @@ public:
 		, softMx(0) /* softMx only set if specified */
 #if defined(OMR_GC_BATCH_CLEAR_TLH)
 		, batchClearTLH(0)
+		, tlhPrezeroing(false)
+		, tlhPrezeroChunkSize(64 * 1024)
+		, tlhPrezeroMaximumBytes(4 * 1024 * 1024)
+		, tlhPrezeroMaximumFreePercent(10)
+		, tlhPrezeroer(NULL)
 #endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
 		, gcThreadCount(0)
 		, gcThreadCountSpecified(false)
@@ -1676,6 +1723,7 @@ public:
 		, depthCopyTwoPaths(true)
 		, depthCopyThreePaths(false)
 		, alwaysDepthCopyFirstOffset(false)
+		, scavengerAutoHotFields(false)
 		, allowPermanantHotFields (false)
 		, hotFieldResettingEnabled (false)
 		, maxConsecutiveHotFieldSelections(10)
@@ -1695,6 +1743,7 @@ public:
 		, scvTenureStrategyAdaptive(true)
 		, scvTenureStrategyLookback(true)
 		, scvTenureStrategyHistory(true)
+		, scvTenureStrategyCost(false)
 		, scavengerEnabled(false)
 		, scavengerRsoScanUnsafe(false)
 		, cacheListSplit(0)
@@ -1771,6 +1820,7 @@ public:
 		, compactOnSystemGC(0)
 		, nocompactOnSystemGC(0)
 		, compactToSatisfyAllocate(false)
+		, compactIncrementSubAreas(0)
 #endif /* defined(OMR_GC_MODRON_COMPACTION) */
 		, payAllocationTax(false)
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
@@ -1784,6 +1834,12 @@ public:
 		, concurrentSlack(0)
 		, cardCleanPass2Boost(2)
 		, cardCleaningPasses(2)
+		, cardTableSummary(false)
+		, concurrentPacing(false)
+		, concurrentPacingHistory(4)
+		, concurrentMarkDedicatedThreads(0)
+		, concurrentMarkCPUBudget(25)
+		, concurrentMarkDedicatedCPUTime(0)
 		, fvtest_concurrentCardTablePreparationDelay(0)
 		, fvtest_forceConcurrentTLHMarkMapCommitFailure(0)
 		, fvtest_forceConcurrentTLHMarkMapCommitFailureCounter(0)
@@ -1864,6 +1920,9 @@ public:
 		, allocationCacheMaximumSize(16384)
 		, allocationCacheInitialSize(256)
 		, allocationCacheIncrementSize(256)
+		, sizeClassTable(NULL)
+		, sizeClassProfiling(false)
+		, allocationCacheMagazineCount(1)
 		, nonDeterministicSweep(false)
 		, configuration(NULL)
 		, verboseGCManager(NULL)
@@ -1871,6 +1930,7 @@ public:
 		, verboseExtensions(false)
 		, verboseNewFormat(true)
 		, bufferedLogging(false)
+		, binaryLogging(false)
 		, lowAllocationThreshold(UDATA_MAX)
 		, highAllocationThreshold(UDATA_MAX)
 		, disableInlineCacheForAllocationThreshold(false)
@@ -1878,6 +1938,8 @@ public:
 		, heapCeiling(0) /* default for normal platforms is 0 (i.e. no ceiling) */
 		, heapInitializationFailureReason(HEAP_INITIALIZATION_FAILURE_REASON_NO_ERROR)
 		, scavengerAlignHotFields(true) /* VM Design 1774: hot field alignment is on by default */
+		, scavengerNonTemporalCopyThreshold(0)
+		, scavengerChunkedCopyThreshold(0)
 		, suballocatorInitialSize(SUBALLOCATOR_INITIAL_SIZE) /* default for heap suballocator initial size is 200 MB */
 		, suballocatorCommitSize(SUBALLOCATOR_COMMIT_SIZE) /* default for heap suballocator commit size is 50 MB */
 		, suballocatorIncrementSize(SUBALLOCATOR_INCREMENT_SIZE) /* default for heap suballocator commit size is 8 MB or 256 MB for AIX */
@@ -1973,6 +2035,11 @@ public:
 		, darkMatterSampleRate(32)
 		, pretouchHeapOnExpand(false)
 		, decommitMinimumFree(0)
+		, idleHeapUncommit(false)
+		, idleHeapUncommitIntervalMillis(1000)
+		, idleHeapUncommitAllocationRate(1024 * 1024)
+		, idleHeapUncommitIdleSamples(5)
+		, idleHeapUncommitRetainPercent(2)
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
 		, gcOnIdle(false)
 		, compactOnIdle(false)
@@ -24,6 +24,7 @@
 #include "Bits.hpp"
 #include "GCExtensionsBase.hpp"
 #include "HeapMap.hpp"
+#include "HeapMapWordIterator.hpp"
 #include "Math.hpp"
 #include "ObjectModel.hpp"
 
@@ -68,6 +69,26 @@ MM_HeapMapIterator::reset(MM_HeapMap *heapMap, uintptr_t *heapChunkBase, uintptr
 	return true;
 }
 
+MMINLINE void
+MM_HeapMapIterator::nextHeapMapSlot()
+{
+	/* The termination point may not be at the end of the map slot - adjust accordingly */
+	_heapSlotCurrent += J9MODRON_HEAP_SLOTS_PER_HEAPMAP_BIT * (OMRBITS_BITS_IN_SLOT - _bitIndexHead);
+
+	/* Move to the next non-empty mark map slot, skipping runs of empty slots in bulk */
+	_heapMapSlotCurrent += 1;
+	_bitIndexHead = 0;
+	if(_heapSlotCurrent < _heapChunkTop) {
+		uintptr_t slotsRemaining = MM_Math::roundToCeiling(J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT, _heapChunkTop - _heapSlotCurrent) / J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT;
+		uintptr_t *heapMapSlotNonEmpty = MM_HeapMapWordIterator::skipEmptyWords(_heapMapSlotCurrent, _heapMapSlotCurrent + slotsRemaining);
+		_heapSlotCurrent += J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT * (heapMapSlotNonEmpty - _heapMapSlotCurrent);
+		_heapMapSlotCurrent = heapMapSlotNonEmpty;
+		if(_heapSlotCurrent < _heapChunkTop) {
+			_heapMapSlotValue = *_heapMapSlotCurrent;
+		}
+	}
+}
+
 omrobjectptr_t
 MM_HeapMapIterator::nextObject()
 {
@@ -123,16 +144,58 @@ MM_HeapMapIterator::nextObject()
 			return (nextObject < (omrobjectptr_t)_heapChunkTop ? nextObject : NULL);
 		}
 
-		/* The termination point may not be at the end of the map slot - adjust accordingly */
-		_heapSlotCurrent += J9MODRON_HEAP_SLOTS_PER_HEAPMAP_BIT * (OMRBITS_BITS_IN_SLOT - _bitIndexHead);
+		nextHeapMapSlot();
+	}
 
-		/* Move to the next mark map slot */
-		_heapMapSlotCurrent += 1;
-		_bitIndexHead = 0;
-		if(_heapSlotCurrent < _heapChunkTop) {
-			_heapMapSlotValue = *_heapMapSlotCurrent;
+	return (omrobjectptr_t)NULL;
+}
+
+uintptr_t
+MM_HeapMapIterator::nextObjects(omrobjectptr_t *objects, uintptr_t maxObjects)
+{
+	uintptr_t count = 0;
+
+	while ((count < maxObjects) && (_heapSlotCurrent < _heapChunkTop)) {
+		/* Emit every object starting in the cached map slot before the heap map is read again */
+		while ((J9MODRON_HMI_SLOT_EMPTY != _heapMapSlotValue) && (count < maxObjects)) {
+			uintptr_t trailingZeros = MM_Bits::trailingZeros(_heapMapSlotValue);
+			_heapSlotCurrent += J9MODRON_HEAP_SLOTS_PER_HEAPMAP_BIT * trailingZeros;
+			_heapMapSlotValue >>= trailingZeros;
+			_bitIndexHead += trailingZeros;
+
+			omrobjectptr_t nextObject = (omrobjectptr_t)_heapSlotCurrent;
+			if (nextObject >= (omrobjectptr_t)_heapChunkTop) {
+				/* The rest of the slot maps beyond the range - the iteration is complete */
+				return count;
+			}
+			objects[count] = nextObject;
+			count += 1;
+
+			uintptr_t sizeInHeapMapBits = 1;
+			if (_useLargeObjectOptimization) {
+				sizeInHeapMapBits = MM_Bits::convertBytesToSlots(_extensions->objectModel.getConsumedSizeInBytesWithHeader(nextObject)) / J9MODRON_HEAP_SLOTS_PER_HEAPMAP_BIT;
+			}
+
+			/* Jump over the body of the object, reloading the cached slot only if the object ends in a later one */
+			_heapSlotCurrent += J9MODRON_HEAP_SLOTS_PER_HEAPMAP_BIT * sizeInHeapMapBits;
+			_bitIndexHead += sizeInHeapMapBits;
+			if (_bitIndexHead < OMRBITS_BITS_IN_SLOT) {
+				_heapMapSlotValue >>= sizeInHeapMapBits;
+			} else {
+				_heapMapSlotCurrent += _bitIndexHead / OMRBITS_BITS_IN_SLOT;
+				_bitIndexHead %= OMRBITS_BITS_IN_SLOT;
+				if (_heapSlotCurrent >= _heapChunkTop) {
+					return count;
+				}
+				_heapMapSlotValue = *_heapMapSlotCurrent;
+				_heapMapSlotValue >>= _bitIndexHead;
+			}
+		}
+
+		if (J9MODRON_HMI_SLOT_EMPTY == _heapMapSlotValue) {
+			nextHeapMapSlot();
 		}
 	}
 
-	return (omrobjectptr_t)NULL;
+	return count;
 }
@@ -37,6 +37,7 @@ class MM_GCExtensionsBase;
  */
 #define J9MODRON_HMI_SLOT_EMPTY ((uintptr_t)0x0)
 #define J9MODRON_HMI_HEAPMAP_ALIGNMENT (J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT * sizeof(uintptr_t))
+#define J9MODRON_HMI_BATCH_SIZE 32 /**< Suggested number of objects to request per MM_HeapMapIterator::nextObjects() call */
 
 /**
  * Iterate over objects in a chunk of heap using a heap map.
@@ -55,9 +56,24 @@ private:
 	MM_GCExtensionsBase * const _extensions; /**< The GC extensions for the JVM */
 	bool _useLargeObjectOptimization;	/**< Set to true if we want to read objects from the heap and determine their size in order to skip mark map bits which are inside the object.  If this is set to false, we will blindly return the addresses representing the set bits in the mark map */
 
+	/**
+	 * Advance past the remaining bits of the current heap map slot to the next non-empty slot in the range,
+	 * caching its value.
+	 */
+	MMINLINE void nextHeapMapSlot();
+
 public:
 	omrobjectptr_t nextObject();
 
+	/**
+	 * Return up to maxObjects of the next objects in the range, in address order, as repeated calls to nextObject() would.
+	 * All objects starting in a heap map slot are decoded from its cached value before the next slot is loaded.
+	 * @param objects[out] Array receiving the object addresses
+	 * @param maxObjects[in] Size of the objects array
+	 * @return The number of objects stored in objects, 0 once the iteration is complete
+	 */
+	uintptr_t nextObjects(omrobjectptr_t *objects, uintptr_t maxObjects);
+
 	bool setHeapMap(MM_HeapMap *heapMap);
 
 	bool reset(MM_HeapMap *heapMap, uintptr_t *heapChunkBase, uintptr_t *heapChunkTop);
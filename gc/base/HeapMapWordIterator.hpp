@@ -34,6 +34,12 @@
 #include "Bits.hpp"
 #include "HeapMap.hpp"
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif /* defined(__AVX2__) */
+
 enum {
 	J9MODRON_HEAP_BYTES_PER_UDATA_OF_HEAP_MAP = (J9MODRON_HEAP_SLOTS_PER_HEAPMAP_BIT * sizeof(uintptr_t) * sizeof(uintptr_t) * BITS_IN_BYTE)
 };
@@ -66,6 +72,81 @@ public:
 		return nextObject;
 	}
 
+	/**
+	 * Return up to maxObjects of the remaining objects in the word, in address order.
+	 * @param objects[out] Array receiving the object addresses
+	 * @param maxObjects[in] Size of the objects array (a word never holds more than OMRBITS_BITS_IN_SLOT objects)
+	 * @return The number of objects stored in objects, 0 once the word is exhausted
+	 */
+	MMINLINE uintptr_t nextObjects(omrobjectptr_t *objects, uintptr_t maxObjects)
+	{
+		uintptr_t count = 0;
+		while ((0 != _cache) && (count < maxObjects)) {
+			uintptr_t trailingZeros = MM_Bits::trailingZeros(_cache);
+			_heapSlotCurrent += J9MODRON_HEAP_SLOTS_PER_HEAPMAP_BIT * trailingZeros;
+			_cache >>= trailingZeros;
+			objects[count] = (omrobjectptr_t) _heapSlotCurrent;
+			count += 1;
+			_heapSlotCurrent += J9MODRON_HEAP_SLOTS_PER_HEAPMAP_BIT;
+			_cache >>= 1;
+		}
+		return count;
+	}
+
+	/**
+	 * Find the first non-empty heap map word in [mapCurrent, mapTop).  Sparse maps (mostly dead heap) are dominated
+	 * by runs of empty words, so these are tested 512 bits at a time where vector instructions are available to the
+	 * build (256 bits at a time otherwise) before falling back to single words for the remainder.
+	 * @param mapCurrent[in] The first heap map word to examine
+	 * @param mapTop[in] The heap map word after the last one to examine
+	 * @return The first non-empty word, or mapTop if all words in the range are empty
+	 */
+	static MMINLINE uintptr_t *skipEmptyWords(uintptr_t *mapCurrent, uintptr_t *mapTop)
+	{
+#if defined(__AVX2__)
+		const uintptr_t wordsPerStep = (2 * sizeof(__m256i)) / sizeof(uintptr_t);
+		while (wordsPerStep <= (uintptr_t)(mapTop - mapCurrent)) {
+			__m256i low = _mm256_loadu_si256((const __m256i *)mapCurrent);
+			__m256i high = _mm256_loadu_si256((const __m256i *)(mapCurrent + (wordsPerStep / 2)));
+			__m256i bits = _mm256_or_si256(low, high);
+			if (!_mm256_testz_si256(bits, bits)) {
+				break;
+			}
+			mapCurrent += wordsPerStep;
+		}
+#elif defined(__SSE2__) || defined(_M_X64)
+		const uintptr_t wordsPerStep = (4 * sizeof(__m128i)) / sizeof(uintptr_t);
+		const __m128i zero = _mm_setzero_si128();
+		while (wordsPerStep <= (uintptr_t)(mapTop - mapCurrent)) {
+			const __m128i *vector = (const __m128i *)mapCurrent;
+			__m128i bits = _mm_or_si128(
+					_mm_or_si128(_mm_loadu_si128(vector), _mm_loadu_si128(vector + 1)),
+					_mm_or_si128(_mm_loadu_si128(vector + 2), _mm_loadu_si128(vector + 3)));
+			if (0xFFFF != _mm_movemask_epi8(_mm_cmpeq_epi8(bits, zero))) {
+				break;
+			}
+			mapCurrent += wordsPerStep;
+		}
+#else /* defined(__AVX2__) */
+		const uintptr_t wordsPerStep = 256 / OMRBITS_BITS_IN_SLOT;
+		while (wordsPerStep <= (uintptr_t)(mapTop - mapCurrent)) {
+			uintptr_t bits = 0;
+			for (uintptr_t i = 0; i < wordsPerStep; i++) {
+				bits |= mapCurrent[i];
+			}
+			if (0 != bits) {
+				break;
+			}
+			mapCurrent += wordsPerStep;
+		}
+#endif /* defined(__AVX2__) */
+		/* at most one step's worth of words is left to look at individually */
+		while ((mapCurrent < mapTop) && (0 == *mapCurrent)) {
+			mapCurrent += 1;
+		}
+		return mapCurrent;
+	}
+
 	MMINLINE MM_HeapMapWordIterator(MM_HeapMap *heapMap, void *heapCardAddress)
 	{
 		uintptr_t heapOffsetInBytes = (uintptr_t)heapCardAddress - (uintptr_t)heapMap->getHeapBase();
@@ -0,0 +1,263 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#include "omrcfg.h"
+#include "omrgcconsts.h"
+#include "omrport.h"
+#include "ModronAssertions.h"
+
+#include "IdleHeapUncommit.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "MemorySpace.hpp"
+#include "MemorySubSpace.hpp"
+#include "ParallelDispatcher.hpp"
+
+MM_IdleHeapUncommit *
+MM_IdleHeapUncommit::newInstance(MM_EnvironmentBase *env)
+{
+	MM_IdleHeapUncommit *idleHeapUncommit = (MM_IdleHeapUncommit *)env->getForge()->allocate(sizeof(MM_IdleHeapUncommit), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != idleHeapUncommit) {
+		new(idleHeapUncommit) MM_IdleHeapUncommit(env);
+		if (!idleHeapUncommit->initialize(env)) {
+			idleHeapUncommit->kill(env);
+			idleHeapUncommit = NULL;
+		}
+	}
+	return idleHeapUncommit;
+}
+
+void
+MM_IdleHeapUncommit::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_IdleHeapUncommit::initialize(MM_EnvironmentBase *env)
+{
+	_extensions = env->getExtensions();
+	return (0 == omrthread_monitor_init_with_name(&_monitor, 0, "MM_IdleHeapUncommit::_monitor"));
+}
+
+void
+MM_IdleHeapUncommit::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _monitor) {
+		omrthread_monitor_destroy(_monitor);
+		_monitor = NULL;
+	}
+}
+
+bool
+MM_IdleHeapUncommit::startup()
+{
+	bool success = false;
+
+	/* hold the monitor over start-up of the thread so it cannot report its state before we wait for it */
+	omrthread_monitor_enter(_monitor);
+	_state = STATE_STARTING;
+	intptr_t forkResult = createThreadWithCategory(
+		NULL,
+		OMR_OS_STACK_SIZE,
+		J9THREAD_PRIORITY_MIN,
+		0,
+		service_thread_proc,
+		this,
+		J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 == forkResult) {
+		while (STATE_STARTING == _state) {
+			omrthread_monitor_wait(_monitor);
+		}
+		success = (STATE_RUNNING == _state);
+	} else {
+		_state = STATE_ERROR;
+	}
+	omrthread_monitor_exit(_monitor);
+
+	return success;
+}
+
+void
+MM_IdleHeapUncommit::shutdown()
+{
+	if (STATE_ERROR != _state) {
+		omrthread_monitor_enter(_monitor);
+		while (STATE_TERMINATED != _state) {
+			_state = STATE_TERMINATION_REQUESTED;
+			omrthread_monitor_notify(_monitor);
+			omrthread_monitor_wait(_monitor);
+		}
+		omrthread_monitor_exit(_monitor);
+	}
+}
+
+uintptr_t
+MM_IdleHeapUncommit::service_thread_proc2(OMRPortLibrary *portLib, void *info)
+{
+	MM_IdleHeapUncommit *idleHeapUncommit = (MM_IdleHeapUncommit *)info;
+	/* sample until asked to terminate.  This method will NOT return */
+	idleHeapUncommit->serviceEntryPoint();
+	Assert_MM_unreachable();
+	return 0;
+}
+
+int J9THREAD_PROC
+MM_IdleHeapUncommit::service_thread_proc(void *info)
+{
+	MM_IdleHeapUncommit *idleHeapUncommit = (MM_IdleHeapUncommit *)info;
+	MM_GCExtensionsBase *extensions = idleHeapUncommit->_extensions;
+	OMR_VM *omrVM = extensions->getOmrVM();
+	OMRPORT_ACCESS_FROM_OMRVM(omrVM);
+	uintptr_t rc = 0;
+	omrsig_protect(service_thread_proc2, info,
+		extensions->dispatcher->getSignalHandler(), omrVM,
+		OMRPORT_SIG_FLAG_SIGALLSYNC | OMRPORT_SIG_FLAG_MAY_CONTINUE_EXECUTION,
+		&rc);
+	return 0;
+}
+
+void
+MM_IdleHeapUncommit::serviceEntryPoint()
+{
+	OMR_VMThread *omrVMThread = MM_EnvironmentBase::attachVMThread(_extensions->getOmrVM(), "GC Idle Heap Uncommit", MM_EnvironmentBase::ATTACH_GC_HELPER_THREAD);
+
+	omrthread_monitor_enter(_monitor);
+	if (NULL == omrVMThread) {
+		_state = STATE_ERROR;
+		omrthread_monitor_notify(_monitor);
+		omrthread_exit(_monitor);
+	} else {
+		MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+
+		_lastGCCount = getCollectionCount();
+		_lastFreeBytes = _extensions->heap->getApproximateActiveFreeMemorySize();
+		_state = STATE_RUNNING;
+		omrthread_monitor_notify(_monitor);
+
+		while (STATE_RUNNING == _state) {
+			omrthread_monitor_wait_timed(_monitor, (int64_t)_extensions->idleHeapUncommitIntervalMillis, 0);
+			if (STATE_RUNNING == _state) {
+				omrthread_monitor_exit(_monitor);
+				if (sampleIsIdle(env)) {
+					releaseFreePages(env);
+				}
+				omrthread_monitor_enter(_monitor);
+			}
+		}
+
+		/* notify the shutting down thread, which resumes once the monitor is released on exit */
+		_state = STATE_TERMINATED;
+		omrthread_monitor_notify(_monitor);
+		MM_EnvironmentBase::detachVMThread(_extensions->getOmrVM(), omrVMThread, MM_EnvironmentBase::ATTACH_GC_HELPER_THREAD);
+		omrthread_exit(_monitor);
+	}
+}
+
+uintptr_t
+MM_IdleHeapUncommit::getCollectionCount()
+{
+	/* excessiveGCStats leaves out explicit collections, which are activity too */
+	uintptr_t gcCount = _extensions->globalGCStats.gcCount;
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	gcCount += _extensions->scavengerStats._gcCount;
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+	return gcCount;
+}
+
+bool
+MM_IdleHeapUncommit::sampleIsIdle(MM_EnvironmentBase *env)
+{
+	uintptr_t gcCount = getCollectionCount();
+	uintptr_t freeBytes = _extensions->heap->getApproximateActiveFreeMemorySize();
+	/* free memory only shrinks between collections, and by what has been allocated */
+	uintptr_t allocatedBytes = (freeBytes < _lastFreeBytes) ? (_lastFreeBytes - freeBytes) : 0;
+	uint64_t idleBytes = ((uint64_t)_extensions->idleHeapUncommitAllocationRate * _extensions->idleHeapUncommitIntervalMillis) / 1000;
+	bool releaseDue = false;
+
+	if ((gcCount != _lastGCCount) || (allocatedBytes > idleBytes)) {
+		/* active again: the next idle period may release what this activity commits */
+		_idleSamples = 0;
+		_releasedThisIdlePeriod = false;
+	} else if (!_releasedThisIdlePeriod) {
+		_idleSamples += 1;
+		releaseDue = (_idleSamples >= _extensions->idleHeapUncommitIdleSamples);
+	}
+
+	_lastGCCount = gcCount;
+	_lastFreeBytes = freeBytes;
+	return releaseDue;
+}
+
+uintptr_t
+MM_IdleHeapUncommit::getRetainedFreeBytes(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uint64_t limit = _extensions->memoryMax;
+	uint64_t containerLimit = 0;
+
+	/* free heap never exceeds the maximum heap size, so a larger container limit is not a useful basis */
+	if (omrsysinfo_cgroup_is_memlimit_set() && (0 == omrsysinfo_cgroup_get_memlimit(&containerLimit))) {
+		limit = OMR_MIN(limit, containerLimit);
+	}
+	return (uintptr_t)((limit / 100) * _extensions->idleHeapUncommitRetainPercent);
+}
+
+void
+MM_IdleHeapUncommit::releaseFreePages(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_Heap *heap = _extensions->heap;
+	MM_MemorySpace *memorySpace = heap->getDefaultMemorySpace();
+
+	uintptr_t retainedBytes = getRetainedFreeBytes(env);
+
+	/* the retained amount stays committed as headroom, only the free memory above it is given back */
+	if (heap->getApproximateActiveFreeMemorySize(MEMORY_TYPE_OLD) > retainedBytes) {
+		env->acquireExclusiveVMAccess();
+		uint64_t startTime = omrtime_hires_clock();
+		uintptr_t releasedBytes = memorySpace->releaseFreeMemoryPages(env, MEMORY_TYPE_OLD, retainedBytes);
+		uint64_t endTime = omrtime_hires_clock();
+		TRIGGER_J9HOOK_MM_PRIVATE_HEAP_RESIZE(
+			_extensions->privateHookInterface,
+			env->getOmrVMThread(),
+			endTime,
+			J9HOOK_MM_PRIVATE_HEAP_RESIZE,
+			HEAP_RELEASE_FREE_PAGES,
+			MEMORY_TYPE_OLD,
+			/* GC Time Ratio not applicable for "release free heap pages" */
+			0,
+			releasedBytes,
+			heap->getActiveMemorySize(MEMORY_TYPE_OLD),
+			omrtime_hires_delta(startTime, endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS),
+			/* reason enum variable not applicable/used, so passing univeral value 1 = not found*/
+			1
+			);
+		env->releaseExclusiveVMAccess();
+	}
+
+	_releasedThisIdlePeriod = true;
+}
@@ -0,0 +1,134 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#if !defined(IDLEHEAPUNCOMMIT_HPP_)
+#define IDLEHEAPUNCOMMIT_HPP_
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "omrthread.h"
+
+#include "BaseVirtual.hpp"
+
+class MM_EnvironmentBase;
+class MM_GCExtensionsBase;
+
+/**
+ * Background service returning free heap pages to the operating system once the application goes idle.
+ * Collections only give memory back when their free ratio heuristics contract the heap, so a process that
+ * goes quiet after a peak keeps its peak footprint. This thread samples the allocation rate every
+ * idleHeapUncommitIntervalMillis and, after idleHeapUncommitIdleSamples consecutive samples with no
+ * collection and allocation below idleHeapUncommitAllocationRate, decommits the pages of the free entries in
+ * the old space. That pass neither collects nor compacts, and runs once per idle period.
+ * @ingroup GC_Base
+ */
+class MM_IdleHeapUncommit : public MM_BaseVirtual
+{
+/*
+ * Data members
+ */
+public:
+protected:
+private:
+	typedef enum IdleHeapUncommitState
+	{
+		STATE_ERROR = 0,
+		STATE_STARTING,
+		STATE_RUNNING,
+		STATE_TERMINATION_REQUESTED,
+		STATE_TERMINATED,
+	} IdleHeapUncommitState;
+
+	MM_GCExtensionsBase *_extensions; /**< The GC extensions */
+	omrthread_monitor_t _monitor; /**< Protects _state, and times the wait between samples */
+	volatile IdleHeapUncommitState _state; /**< The state (protected by _monitor) of the service thread */
+	uintptr_t _lastGCCount; /**< Collections of all types completed at the previous sample */
+	uintptr_t _lastFreeBytes; /**< Approximate free heap at the previous sample */
+	uintptr_t _idleSamples; /**< Consecutive samples found idle */
+	bool _releasedThisIdlePeriod; /**< Free pages were released since the last sample showing activity */
+
+/*
+ * Function members
+ */
+public:
+	static MM_IdleHeapUncommit *newInstance(MM_EnvironmentBase *env);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Start the service thread, waiting until it reports success.
+	 * @return true on success, false on failure
+	 */
+	bool startup();
+
+	/**
+	 * Stop the service thread, waiting until it has detached.
+	 */
+	void shutdown();
+
+	MM_IdleHeapUncommit(MM_EnvironmentBase *env)
+		: MM_BaseVirtual()
+		, _extensions(NULL)
+		, _monitor(NULL)
+		, _state(STATE_ERROR)
+		, _lastGCCount(0)
+		, _lastFreeBytes(0)
+		, _idleSamples(0)
+		, _releasedThisIdlePeriod(false)
+	{
+		_typeId = __FUNCTION__;
+	}
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+private:
+	static int J9THREAD_PROC service_thread_proc(void *info);
+	static uintptr_t service_thread_proc2(OMRPortLibrary *portLib, void *info);
+	void serviceEntryPoint();
+
+	/**
+	 * @return global collections and scavenges completed so far, explicit ones included
+	 */
+	uintptr_t getCollectionCount();
+
+	/**
+	 * Take a sample of the allocation rate since the previous one.
+	 * @return true if free pages are due for release
+	 */
+	bool sampleIsIdle(MM_EnvironmentBase *env);
+
+	/**
+	 * Free heap the service leaves committed: idleHeapUncommitRetainPercent of the container memory limit,
+	 * or of the maximum heap size when no container limit is set or the limit is larger.
+	 */
+	uintptr_t getRetainedFreeBytes(MM_EnvironmentBase *env);
+
+	/**
+	 * Decommit the free pages of the old space beyond the retained free bytes, under exclusive VM access so no
+	 * collection or allocation changes the free lists underneath, and report the bytes released as a heap resize.
+	 */
+	void releaseFreePages(MM_EnvironmentBase *env);
+};
+
+#endif /* IDLEHEAPUNCOMMIT_HPP_ */
@@ -321,13 +321,26 @@ MM_MarkingScheme::scanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
 void
 MM_MarkingScheme::completeScan(MM_EnvironmentBase *env)
 {
-	do {
-		omrobjectptr_t objectPtr = NULL;
-		while (NULL != (objectPtr = (omrobjectptr_t )env->_workStack.pop(env))) {
-			env->_markStats._bytesScanned += scanObject(env, objectPtr);
-			env->_markStats._objectsScanned += 1;
-		}
-	} while (_workPackets->handleWorkPacketOverflow(env));
+	if (0 != _extensions->markingPrefetchDepth) {
+		/* scan objects in the order they leave the prefetch ring so that their cache lines are (hopefully) already loaded */
+		env->_workStack.setPrefetchDepth(_extensions->markingPrefetchDepth);
+		do {
+			omrobjectptr_t objectPtr = NULL;
+			while (NULL != (objectPtr = (omrobjectptr_t )env->_workStack.popPrefetched(env))) {
+				env->_markStats._bytesScanned += scanObject(env, objectPtr);
+				env->_markStats._objectsScanned += 1;
+			}
+		} while (_workPackets->handleWorkPacketOverflow(env));
+		env->_workStack.setPrefetchDepth(0);
+	} else {
+		do {
+			omrobjectptr_t objectPtr = NULL;
+			while (NULL != (objectPtr = (omrobjectptr_t )env->_workStack.pop(env))) {
+				env->_markStats._bytesScanned += scanObject(env, objectPtr);
+				env->_markStats._objectsScanned += 1;
+			}
+		} while (_workPackets->handleWorkPacketOverflow(env));
+	}
 }
 
 /****************************************
@@ -221,6 +221,7 @@ MM_MemoryPool::resetHeapStatistics(bool memoryPoolCollected)
 	_allocBytes = 0;
 	_allocDiscardedBytes = 0;
 	_allocSearchCount = 0;
+	_allocSizeClassIndexCount = 0;
 }
 
 /**
@@ -235,6 +236,7 @@ MM_MemoryPool::mergeHeapStats(MM_HeapStats *heapStats, bool active)
 	
 	heapStats->_allocDiscardedBytes += _allocDiscardedBytes;
 	heapStats->_allocSearchCount += _allocSearchCount;
+	heapStats->_allocSizeClassIndexCount += _allocSizeClassIndexCount;
 
 	if (active) {
 		heapStats->_activeFreeEntryCount += getActualFreeEntryCount();
@@ -512,7 +514,7 @@ MM_MemoryPool::kill(MM_EnvironmentBase *env)
 }
 
 uintptr_t
-MM_MemoryPool::releaseFreeMemoryPages(MM_EnvironmentBase* env)
+MM_MemoryPool::releaseFreeMemoryPages(MM_EnvironmentBase* env, uintptr_t &retainedBytes)
 {
         /* Should have been implemented */
         Assert_MM_unreachable();
@@ -96,6 +96,7 @@ protected:
 	
 	uintptr_t _allocDiscardedBytes;
 	uintptr_t _allocSearchCount;
+	uintptr_t _allocSizeClassIndexCount; /**< Number of allocates whose free list walk was started further ahead by the size class index */
 
 	MM_GCExtensionsBase *_extensions; /**< GC Extensions for this JVM */
 	
@@ -419,9 +420,10 @@ public:
 	}
 
 	/**
+	 * @param[in,out] retainedBytes free bytes to leave committed, reduced by the free memory this pool keeps committed
 	 * @return bytes of free memory in the pool released/decommited back to OS
 	 */
-	virtual uintptr_t releaseFreeMemoryPages(MM_EnvironmentBase* env);
+	virtual uintptr_t releaseFreeMemoryPages(MM_EnvironmentBase* env, uintptr_t &retainedBytes);
 
 #if defined(J9VM_OPT_CRIU_SUPPORT)
 	/**
@@ -458,6 +460,7 @@ public:
 		_lastFreeBytes(0),
 		_allocDiscardedBytes(0),
 		_allocSearchCount(0),
+		_allocSizeClassIndexCount(0),
 		_extensions(env->getExtensions()),
 		_largeObjectAllocateStats(NULL),
 		_darkMatterBytes(0),
@@ -492,6 +495,7 @@ public:
 		_lastFreeBytes(0),
 		_allocDiscardedBytes(0),
 		_allocSearchCount(0),
+		_allocSizeClassIndexCount(0),
 		_extensions(env->getExtensions()),
 		_largeObjectAllocateStats(NULL),
 		_darkMatterBytes(0),
@@ -157,6 +157,9 @@ MM_MemoryPoolAddressOrderedList::initialize(MM_EnvironmentBase *env)
 	}
 	_hintInactive = previousInactiveHint;
 
+	_sizeClassIndexEnabled = ext->freeListSizeClassIndex;
+	clearSizeClassIndex();
+
 	return true;
 }
 
@@ -433,6 +436,117 @@ MM_MemoryPoolAddressOrderedList::updateHintsBeyondEntry(MM_HeapLinkedFreeHeader
 	}
 }
 
+/****************************************
+ * Size Class Index Functionality
+ ****************************************
+ */
+
+/**
+ * The size class index keeps, for each power of two 2^k, the free entry preceding the first entry whose size is at least 2^k.
+ * Every entry up to and including an index entry is therefore smaller than 2^k, so a walk for any size >= 2^k may start there.
+ * A NULL slot means walking from the list head, which makes a cleared index equivalent to no index at all.
+ * Entries only shrink or disappear between rebuilds. Heap expansion moves the slots at or beyond the new memory back to its
+ * predecessor; any other path that adds free memory to the list clears the index.
+ */
+void
+MM_MemoryPoolAddressOrderedList::clearSizeClassIndex()
+{
+	for (uintptr_t i = 0; i < SIZE_CLASS_INDEX_COUNT; i++) {
+		_sizeClassIndex[i] = NULL;
+	}
+}
+
+void
+MM_MemoryPoolAddressOrderedList::buildSizeClassIndex(MM_EnvironmentBase *env)
+{
+	bool const compressed = compressObjectReferences();
+
+	clearSizeClassIndex();
+
+	/* The largest non-empty size class bounds how far the walk has to go */
+	MM_FreeEntrySizeClassStats *freeEntrySizeClassStats = _largeObjectAllocateStats->getFreeEntrySizeClassStats();
+	uintptr_t stopSize = UDATA_MAX;
+	for (intptr_t sizeClass = (intptr_t)freeEntrySizeClassStats->getMaxSizeClasses() - 1; sizeClass >= 0; sizeClass--) {
+		if ((0 != freeEntrySizeClassStats->getCount(sizeClass)) || (0 != freeEntrySizeClassStats->getFrequentAllocCount(sizeClass))) {
+			stopSize = _largeObjectAllocateStats->getSizeClassSizes(sizeClass);
+			break;
+		}
+	}
+
+	MM_HeapLinkedFreeHeader *previousFreeEntry = NULL;
+	MM_HeapLinkedFreeHeader *currentFreeEntry = _heapFreeList;
+	/* Index of the lowest slot not yet filled in; all entries walked so far are smaller than 2^nextSlot */
+	uintptr_t nextSlot = 0;
+
+	while (NULL != currentFreeEntry) {
+		uintptr_t currentFreeEntrySize = currentFreeEntry->getSize();
+		uintptr_t slot = MM_Math::floorLog2(currentFreeEntrySize);
+		for (; nextSlot <= slot; nextSlot++) {
+			_sizeClassIndex[nextSlot] = previousFreeEntry;
+		}
+		if (currentFreeEntrySize >= stopSize) {
+			break;
+		}
+		previousFreeEntry = currentFreeEntry;
+		currentFreeEntry = currentFreeEntry->getNext(compressed);
+	}
+
+	/* Remaining slots are larger than anything walked so far */
+	for (; nextSlot < SIZE_CLASS_INDEX_COUNT; nextSlot++) {
+		_sizeClassIndex[nextSlot] = (NULL == currentFreeEntry) ? previousFreeEntry : currentFreeEntry;
+	}
+}
+
+MMINLINE MM_HeapLinkedFreeHeader *
+MM_MemoryPoolAddressOrderedList::findSizeClassIndexEntry(uintptr_t lookupSize)
+{
+	MM_HeapLinkedFreeHeader *freeEntry = _sizeClassIndex[MM_Math::floorLog2(lookupSize)];
+
+	/* Entries below the free list head have been consumed by TLH allocates */
+	if ((NULL == _heapFreeList) || (freeEntry < _heapFreeList)) {
+		freeEntry = NULL;
+	}
+
+	return freeEntry;
+}
+
+void
+MM_MemoryPoolAddressOrderedList::removeSizeClassIndexEntry(MM_HeapLinkedFreeHeader *freeEntry, MM_HeapLinkedFreeHeader *previousFreeEntry)
+{
+	if (_sizeClassIndexEnabled) {
+		for (uintptr_t i = 0; i < SIZE_CLASS_INDEX_COUNT; i++) {
+			if (_sizeClassIndex[i] == freeEntry) {
+				_sizeClassIndex[i] = previousFreeEntry;
+			}
+		}
+	}
+}
+
+void
+MM_MemoryPoolAddressOrderedList::growSizeClassIndexEntry(MM_HeapLinkedFreeHeader *freeEntry, MM_HeapLinkedFreeHeader *previousFreeEntry)
+{
+	if (_sizeClassIndexEnabled) {
+		/* Entries before freeEntry are unchanged, so a walk may still start at its predecessor */
+		for (uintptr_t i = 0; i < SIZE_CLASS_INDEX_COUNT; i++) {
+			if (_sizeClassIndex[i] >= freeEntry) {
+				_sizeClassIndex[i] = previousFreeEntry;
+			}
+		}
+	}
+}
+
+MMINLINE void
+MM_MemoryPoolAddressOrderedList::updateSizeClassIndexEntry(MM_HeapLinkedFreeHeader *oldFreeEntry, MM_HeapLinkedFreeHeader *newFreeEntry)
+{
+	if (_sizeClassIndexEnabled) {
+		for (uintptr_t i = 0; i < SIZE_CLASS_INDEX_COUNT; i++) {
+			if (_sizeClassIndex[i] == oldFreeEntry) {
+				_sizeClassIndex[i] = newFreeEntry;
+			}
+		}
+	}
+}
+
 /****************************************
  * Allocation
  ****************************************
@@ -446,6 +560,7 @@ MM_MemoryPoolAddressOrderedList::internalAllocate(MM_EnvironmentBase *env, uintp
 	uintptr_t recycleEntrySize;
 	uintptr_t walkCount;
 	J9ModronAllocateHint *allocateHintUsed;
+	bool sizeClassIndexUsed;
 	void *addrBase;
 	uintptr_t largestFreeEntry = 0;
 	
@@ -461,6 +576,7 @@ retry:
 	previousFreeEntry = NULL;
 	walkCount = 0;
 	allocateHintUsed = NULL;
+	sizeClassIndexUsed = false;
 	candidateHintSize = 0;
 
 	/* Large object - use a hint if it is available */
@@ -470,6 +586,15 @@ retry:
 		candidateHintSize = allocateHintUsed->size;
 	}
 
+	/* Skip further ahead if the size class index knows every entry up to its slot is too small */
+	if (_sizeClassIndexEnabled) {
+		MM_HeapLinkedFreeHeader *indexEntry = findSizeClassIndexEntry(sizeInBytesRequired);
+		if ((NULL != indexEntry) && (indexEntry > currentFreeEntry)) {
+			currentFreeEntry = indexEntry;
+			sizeClassIndexUsed = true;
+			candidateHintSize = ((uintptr_t)1 << MM_Math::floorLog2(sizeInBytesRequired)) - 1;
+		}
+	}
 
 	while(currentFreeEntry) {
 		if (doesNeedCardAlignment(env, currentFreeEntry)) {
@@ -524,6 +649,9 @@ retry:
 	_allocCount += 1;
 	_allocBytes += sizeInBytesRequired;
 	_allocSearchCount += walkCount;
+	if (sizeClassIndexUsed) {
+		_allocSizeClassIndexCount += 1;
+	}
 
 	/* Determine what to do with the recycled portion of the free entry */
 	recycleEntrySize = currentFreeEntry->getSize() - sizeInBytesRequired;
@@ -534,6 +662,7 @@ retry:
 	if (recycleHeapChunk(recycleEntry, ((uint8_t *)recycleEntry) + recycleEntrySize, previousFreeEntry, currentFreeEntry->getNext(compressed))) {
 		updatePrevCardUnalignedFreeEntry(currentFreeEntry->getNext(compressed), recycleEntry);
 		updateHint(currentFreeEntry, recycleEntry);
+		updateSizeClassIndexEntry(currentFreeEntry, recycleEntry);
 		_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(recycleEntrySize);
 	} else {
 		updatePrevCardUnalignedFreeEntry(currentFreeEntry->getNext(compressed), previousFreeEntry);
@@ -546,6 +675,7 @@ retry:
 
 		/* Removed from the free list - Kill the hint if necessary */
 		removeHint(currentFreeEntry);
+		removeSizeClassIndexEntry(currentFreeEntry, previousFreeEntry);
 	}
 	
 	/* Collector object allocate stats for Survivor are not interesting (_largeObjectCollectorAllocateStats is null for Survivor) */	
@@ -707,6 +837,7 @@ retry:
 		/* Recycle the remaining entry back onto the free list (if applicable) */
 		if (recycleHeapChunk(addrTop, topOfRecycledChunk, NULL, entryNext)) {
 			updatePrevCardUnalignedFreeEntry(entryNext, (MM_HeapLinkedFreeHeader *)addrTop);
+			updateSizeClassIndexEntry(freeEntry, (MM_HeapLinkedFreeHeader *)addrTop);
 			_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(recycleEntrySize);
 		} else {
 			updatePrevCardUnalignedFreeEntry(entryNext, FREE_ENTRY_END);
@@ -822,6 +953,7 @@ MM_MemoryPoolAddressOrderedList::reset(Cause cause)
 	MM_MemoryPool::reset(cause);
 
 	clearHints();
+	clearSizeClassIndex();
 	_heapFreeList = (MM_HeapLinkedFreeHeader *)NULL;
 	_scannableBytes = 0;
 	_nonScannableBytes = 0;
@@ -835,6 +967,17 @@ MM_MemoryPoolAddressOrderedList::reset(Cause cause)
 	resetLargeObjectAllocateStats();
 }
 
+/**
+ * Rebuild the size class index once sweep or compact has rebuilt the free list.
+ */
+void
+MM_MemoryPoolAddressOrderedList::postProcess(MM_EnvironmentBase *env, Cause cause)
+{
+	if (_sizeClassIndexEnabled) {
+		buildSizeClassIndex(env);
+	}
+}
+
 /**
  * As opposed to reset, which will empty out, this will fill out as if everything is free.
  * Returns the freelist entry created at the end of the given region
@@ -924,12 +1067,14 @@ MM_MemoryPoolAddressOrderedList::expandWithRange(MM_EnvironmentBase *env, uintpt
 	}
 
 	/* Find the free entries in the list the appear before/after the range being added */
+	MM_HeapLinkedFreeHeader *previousPreviousFreeEntry = NULL;
 	previousFreeEntry = NULL;
 	nextFreeEntry = _heapFreeList;
 	while(nextFreeEntry) {
 		if(lowAddress < nextFreeEntry)  {
 			break;
 		}
+		previousPreviousFreeEntry = previousFreeEntry;
 		previousFreeEntry = nextFreeEntry;
 		nextFreeEntry = nextFreeEntry->getNext(compressed);
 	}
@@ -940,6 +1085,7 @@ MM_MemoryPoolAddressOrderedList::expandWithRange(MM_EnvironmentBase *env, uintpt
 		if(previousFreeEntry && (lowAddress == (void *) (((uintptr_t)previousFreeEntry) + previousFreeEntry->getSize()))) {
 			_largeObjectAllocateStats->decrementFreeEntrySizeClassStats(previousFreeEntry->getSize());
 			previousFreeEntry->expandSize(expandSize);
+			growSizeClassIndexEntry(previousFreeEntry, previousPreviousFreeEntry);
 
 			/* Update the free list information */
 			_freeMemorySize += expandSize;
@@ -957,6 +1103,7 @@ MM_MemoryPoolAddressOrderedList::expandWithRange(MM_EnvironmentBase *env, uintpt
 
 			newFreeEntry->setNext(nextFreeEntry->getNext(compressed), compressed);
 			newFreeEntry->setSize(expandSize + nextFreeEntry->getSize());
+			growSizeClassIndexEntry(newFreeEntry, previousFreeEntry);
 
 			/* The previous free entry next pointer must be updated */
 			if(previousFreeEntry) {
@@ -985,6 +1132,7 @@ MM_MemoryPoolAddressOrderedList::expandWithRange(MM_EnvironmentBase *env, uintpt
 	assume0((NULL == nextFreeEntry) || (nextFreeEntry > freeEntry));
 	freeEntry->setNext(nextFreeEntry, compressed);
 	freeEntry->setSize(expandSize);
+	growSizeClassIndexEntry(freeEntry, previousFreeEntry);
 
 	/* Insert the free entry into the list (the next entry was handled above) */
 	if(previousFreeEntry) {
@@ -1029,6 +1177,9 @@ MM_MemoryPoolAddressOrderedList::contractWithRange(MM_EnvironmentBase *env, uint
 		return NULL;
 	}
 
+	/* The contracted entry may be referenced by the size class index */
+	clearSizeClassIndex();
+
 	/* Find the free entry that encompasses the range to contract */
 	/* TODO: Could we use hints to find a better starting address?  Are hints still valid? */
 	previousFreeEntry = NULL;
@@ -1122,6 +1273,9 @@ MM_MemoryPoolAddressOrderedList::addFreeEntries(MM_EnvironmentBase *env,
 		currentFreeEntry = currentFreeEntry->getNext(compressed);
 	}
 
+	/* New free memory invalidates the size class index */
+	clearSizeClassIndex();
+
 	/* Find the first free entry, if any, within specified range */
 	MM_HeapLinkedFreeHeader *previousFreeEntry = NULL;
 	currentFreeEntry = _heapFreeList;
@@ -1215,6 +1369,9 @@ MM_MemoryPoolAddressOrderedList::removeFreeEntriesWithinRange(MM_EnvironmentBase
 	retListMemoryCount = 0;
 	retListMemorySize = 0;
 
+	/* Removed entries may be referenced by the size class index */
+	clearSizeClassIndex();
+
 	/* Find the first free entry, if any, within specified range */
 	previousFreeEntry = NULL;
 	currentFreeEntry = _heapFreeList;
@@ -1587,6 +1744,8 @@ MM_MemoryPoolAddressOrderedList::moveHeap(MM_EnvironmentBase *env, void *srcBase
 	bool const compressed = compressObjectReferences();
 	MM_HeapLinkedFreeHeader *currentFreeEntry, *previousFreeEntry;
 
+	clearSizeClassIndex();
+
 	previousFreeEntry = NULL;
 	currentFreeEntry = _heapFreeList;
 	while(currentFreeEntry) {
@@ -1694,6 +1853,8 @@ MM_MemoryPoolAddressOrderedList::recycleHeapChunk(MM_EnvironmentBase *env, void
 		/* inserted freeEntry before _heapFreeList, it might confuse the checking for staled Hint, so clear hints for avoiding the cases.  */
 		clearHints();
 	}
+	/* The recycled chunk may be larger than the entries an index slot claims to precede it */
+	clearSizeClassIndex();
 
 	_largeObjectAllocateStats->incrementFreeEntrySizeClassStats((uintptr_t)top - (uintptr_t)base);
 	_freeMemorySize += (uintptr_t)chunkTop - (uintptr_t)chunkBase;
@@ -1839,11 +2000,11 @@ MM_MemoryPoolAddressOrderedList::appendCollectorLargeAllocateStats()
 }
 
 uintptr_t
-MM_MemoryPoolAddressOrderedList::releaseFreeMemoryPages(MM_EnvironmentBase* env)
+MM_MemoryPoolAddressOrderedList::releaseFreeMemoryPages(MM_EnvironmentBase* env, uintptr_t &retainedBytes)
 {
 	uintptr_t releasedBytes = 0;
 	_heapLock.acquire();
-	releasedBytes = releaseFreeEntryMemoryPages(env, _heapFreeList);
+	releasedBytes = releaseFreeEntryMemoryPages(env, _heapFreeList, retainedBytes);
 	_heapLock.release();
 	return releasedBytes;
 }
@@ -1880,6 +2041,7 @@ MM_MemoryPoolAddressOrderedList::doFreeEntryCardAlignmentUpTo(MM_EnvironmentBase
 				if ((uintptr_t) currentFreeEntry != (uintptr_t) newStartFreeEntry) {
 					fillWithHoles((void *)currentFreeEntry, newStartFreeEntry);
 					updateHint(currentFreeEntry, (MM_HeapLinkedFreeHeader *)newStartFreeEntry);
+					updateSizeClassIndexEntry(currentFreeEntry, (MM_HeapLinkedFreeHeader *)newStartFreeEntry);
 				}
 				if ((uintptr_t) endFreeEntry != (uintptr_t) newEndFreeEntry) {
 					fillWithHoles(newEndFreeEntry, endFreeEntry);
@@ -40,6 +40,7 @@ class MM_ConcurrentSweepScheme;
 #endif /* OMR_GC_CONCURRENT_SWEEP */
 
 #define FREE_ENTRY_END ((MM_HeapLinkedFreeHeader *)OMRPORT_VMEM_MAX_ADDRESS)
+#define SIZE_CLASS_INDEX_COUNT (sizeof(uintptr_t) * 8)
 
 /**
  * @todo Provide class documentation
@@ -60,6 +61,10 @@ private:
 	struct J9ModronAllocateHint* _hintInactive;
 	struct J9ModronAllocateHint _hintStorage[HINT_ELEMENT_COUNT];
 	uintptr_t _hintLru;
+
+	/* Size class index support */
+	bool _sizeClassIndexEnabled; /**< cached GCExtensionsBase::freeListSizeClassIndex */
+	MM_HeapLinkedFreeHeader *_sizeClassIndex[SIZE_CLASS_INDEX_COUNT]; /**< for each k, the free entry preceding the first entry of size >= 2^k (NULL to walk from the list head) */
 	
 	MM_LargeObjectAllocateStats *_largeObjectCollectorAllocateStats;  /**< Same as _largeObjectAllocateStats except specifically for collector allocates */
 
@@ -81,6 +86,25 @@ private:
 	void updateHint(MM_HeapLinkedFreeHeader *oldFreeEntry, MM_HeapLinkedFreeHeader *newFreeEntry);
 	void clearHints();
 	void updateHintsBeyondEntry(MM_HeapLinkedFreeHeader *freeEntry);
+
+	/**
+	 * Rebuild the size class index with a single walk of the free list.
+	 * The walk stops as soon as the largest size class reported by the free entry size class stats is reached.
+	 */
+	void buildSizeClassIndex(MM_EnvironmentBase *env);
+	void clearSizeClassIndex();
+	/**
+	 * Find the free entry from which a walk for lookupSize may safely start.
+	 * @return the free entry all of whose predecessors (and itself) are too small, or NULL to walk from the list head
+	 */
+	MM_HeapLinkedFreeHeader *findSizeClassIndexEntry(uintptr_t lookupSize);
+	void removeSizeClassIndexEntry(MM_HeapLinkedFreeHeader *freeEntry, MM_HeapLinkedFreeHeader *previousFreeEntry);
+	/**
+	 * Keep the size class index valid when freeEntry is added to the list or grows, rather than clearing it.
+	 * @param previousFreeEntry the entry preceding freeEntry in the list, or NULL if freeEntry is the head
+	 */
+	void growSizeClassIndexEntry(MM_HeapLinkedFreeHeader *freeEntry, MM_HeapLinkedFreeHeader *previousFreeEntry);
+	void updateSizeClassIndexEntry(MM_HeapLinkedFreeHeader *oldFreeEntry, MM_HeapLinkedFreeHeader *newFreeEntry);
 	void *internalAllocate(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats);
 	bool internalAllocateTLH(MM_EnvironmentBase *env, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats);
 	uintptr_t getConsumedSizeForTLH(MM_EnvironmentBase *env, MM_HeapLinkedFreeHeader *freeEntry, uintptr_t maximumSizeInBytesRequired);
@@ -133,6 +157,7 @@ public:
 
 	virtual void reset(Cause cause = any);
 	virtual MM_HeapLinkedFreeHeader *rebuildFreeListInRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptor *region, MM_HeapLinkedFreeHeader *previousFreeEntry);
+	virtual void postProcess(MM_EnvironmentBase *env, Cause cause);
 
 #if defined(DEBUG)
 	virtual bool isValidListOrdering();
@@ -186,7 +211,7 @@ public:
 	 */
 	virtual void recalculateMemoryPoolStatistics(MM_EnvironmentBase *env);
 
-	virtual uintptr_t releaseFreeMemoryPages(MM_EnvironmentBase* env);
+	virtual uintptr_t releaseFreeMemoryPages(MM_EnvironmentBase* env, uintptr_t &retainedBytes);
 
 	void setParallelGCAlignment(MM_EnvironmentBase *env, bool alignmentEnabled);
 
@@ -198,6 +223,7 @@ public:
 		bool const compressed = compressObjectReferences();
 		uintptr_t freeEntrySize = ((uintptr_t)addrTop) - ((uintptr_t)addrBase);
 		MM_HeapLinkedFreeHeader::fillWithHoles(addrBase, freeEntrySize, compressed);
+		removeSizeClassIndexEntry((MM_HeapLinkedFreeHeader *)addrBase, previousFreeEntry);
 		if (previousFreeEntry) {
 			previousFreeEntry->setNext(nextFreeEntry, compressed);
 		}else {
@@ -253,6 +279,7 @@ public:
 	MM_MemoryPoolAddressOrderedList(MM_EnvironmentBase *env, uintptr_t minimumFreeEntrySize) :
 		MM_MemoryPoolAddressOrderedListBase(env, minimumFreeEntrySize)
 		,_heapFreeList(NULL)
+		,_sizeClassIndexEnabled(false)
 		,_largeObjectCollectorAllocateStats(NULL)
 		,_firstCardUnalignedFreeEntry(FREE_ENTRY_END)
 		,_prevCardUnalignedFreeEntry(FREE_ENTRY_END)
@@ -265,6 +292,7 @@ public:
 	MM_MemoryPoolAddressOrderedList(MM_EnvironmentBase *env, uintptr_t minimumFreeEntrySize, const char *name) :
 		MM_MemoryPoolAddressOrderedListBase(env, minimumFreeEntrySize, name)
 		,_heapFreeList(NULL)
+		,_sizeClassIndexEnabled(false)
 		,_largeObjectCollectorAllocateStats(NULL)
 		,_firstCardUnalignedFreeEntry(FREE_ENTRY_END)
 		,_prevCardUnalignedFreeEntry(FREE_ENTRY_END)
@@ -187,13 +187,14 @@ MM_MemoryPoolAddressOrderedListBase::abandonMemoryInPool(MM_EnvironmentBase* env
 }
 
 uintptr_t
-MM_MemoryPoolAddressOrderedListBase::releaseFreeEntryMemoryPages(MM_EnvironmentBase* env, MM_HeapLinkedFreeHeader* freeEntry)
+MM_MemoryPoolAddressOrderedListBase::releaseFreeEntryMemoryPages(MM_EnvironmentBase* env, MM_HeapLinkedFreeHeader* freeEntry, uintptr_t &retainedBytes)
 {
 	bool const compressed = compressObjectReferences();
 	uintptr_t releasedMemory = 0;
 	MM_HeapLinkedFreeHeader* currentFreeEntry = freeEntry;
 	uintptr_t pageSize = env->getExtensions()->heap->getPageSize();
 	while (NULL != currentFreeEntry) {
+		uintptr_t decommittedBytes = 0;
 		/* skip entry less than page size */
 		if (pageSize <= currentFreeEntry->getSize()) {
 			uintptr_t addressBase = MM_Math::roundToCeiling(pageSize, (uintptr_t)currentFreeEntry + sizeof(MM_HeapLinkedFreeHeader));
@@ -205,17 +206,23 @@ MM_MemoryPoolAddressOrderedListBase::releaseFreeEntryMemoryPages(MM_EnvironmentB
 				if (0 < _extensions->decommitMinimumFree) {
 					commitPagesCount = totalFreePagesCount * _extensions->decommitMinimumFree / 100;
 				}
+				/* the retained budget stays committed in the lowest free entries, which are allocated from first */
+				uintptr_t retainedPagesCount = MM_Math::roundToCeiling(pageSize, retainedBytes) / pageSize;
+				commitPagesCount = OMR_MIN(totalFreePagesCount, OMR_MAX(commitPagesCount, retainedPagesCount));
 				decommitPagesCount = totalFreePagesCount - commitPagesCount;
 				/* leave commited pages of memory aside header */
 				addressBase += commitPagesCount * pageSize;
 				/* now decommit pages of memory */
 				if (0 < decommitPagesCount) {
 					if (_extensions->heap->decommitMemory((void*)addressBase, decommitPagesCount * pageSize, NULL, currentFreeEntry->afterEnd())) {
-						releasedMemory += decommitPagesCount * pageSize;
+						decommittedBytes = decommitPagesCount * pageSize;
+						releasedMemory += decommittedBytes;
 					}
 				}
 			}
 		}
+		/* what the entry keeps committed counts against the retained budget */
+		retainedBytes -= OMR_MIN(retainedBytes, currentFreeEntry->getSize() - decommittedBytes);
 		currentFreeEntry = currentFreeEntry->getNext(compressed);
 	}
 	return releasedMemory;
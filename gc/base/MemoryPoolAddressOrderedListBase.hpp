@@ -232,7 +232,7 @@ public:
 		return size >= getMinimumFreeEntrySize();
 	}
 
-	uintptr_t releaseFreeEntryMemoryPages(MM_EnvironmentBase* env, MM_HeapLinkedFreeHeader* freeEntry);
+	uintptr_t releaseFreeEntryMemoryPages(MM_EnvironmentBase* env, MM_HeapLinkedFreeHeader* freeEntry, uintptr_t &retainedBytes);
 	/**
 	 * Create a MemoryPoolAddressOrderedList object.
 	 */
@@ -1128,9 +1128,9 @@ MM_MemoryPoolLargeObjects::resetLargeObjectAllocateStats()
 }
 
 uintptr_t
-MM_MemoryPoolLargeObjects::releaseFreeMemoryPages(MM_EnvironmentBase* env)
+MM_MemoryPoolLargeObjects::releaseFreeMemoryPages(MM_EnvironmentBase* env, uintptr_t &retainedBytes)
 {
-	uintptr_t releasedMemory = _memoryPoolSmallObjects->releaseFreeMemoryPages(env);
-	releasedMemory += _memoryPoolLargeObjects->releaseFreeMemoryPages(env);
+	uintptr_t releasedMemory = _memoryPoolSmallObjects->releaseFreeMemoryPages(env, retainedBytes);
+	releasedMemory += _memoryPoolLargeObjects->releaseFreeMemoryPages(env, retainedBytes);
 	return releasedMemory;
 }
@@ -261,7 +261,7 @@ public:
 		return _currentLOARatio;
 	}
 
-	virtual uintptr_t releaseFreeMemoryPages(MM_EnvironmentBase* env);
+	virtual uintptr_t releaseFreeMemoryPages(MM_EnvironmentBase* env, uintptr_t &retainedBytes);
 
 	/**
 	 * Create a MemoryPoolLargeObjects object.
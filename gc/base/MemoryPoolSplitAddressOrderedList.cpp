@@ -1297,14 +1297,14 @@ MM_MemoryPoolSplitAddressOrderedList::removeFreeEntriesWithinRange(MM_Environmen
 }
 
 uintptr_t
-MM_MemoryPoolSplitAddressOrderedList::releaseFreeMemoryPages(MM_EnvironmentBase* env)
+MM_MemoryPoolSplitAddressOrderedList::releaseFreeMemoryPages(MM_EnvironmentBase* env, uintptr_t &retainedBytes)
 {
 	uintptr_t releasedMemory = 0;
 
 	for (uintptr_t i = 0; i < _heapFreeListCount; i++) {
 		_heapFreeLists[i]._lock.acquire();
 		_heapFreeLists[i]._timesLocked += 1;
-		releasedMemory += releaseFreeEntryMemoryPages(env, _heapFreeLists[i]._freeList);
+		releasedMemory += releaseFreeEntryMemoryPages(env, _heapFreeLists[i]._freeList, retainedBytes);
 		_heapFreeLists[i]._lock.release();
 	}
 
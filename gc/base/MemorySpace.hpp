@@ -185,7 +185,7 @@ public:
 
 	static MM_MemorySpace *getMemorySpace(void *memorySpace) { return (MM_MemorySpace *)memorySpace; }
 
-	uintptr_t releaseFreeMemoryPages(MM_EnvironmentBase* env, uintptr_t memoryType);
+	uintptr_t releaseFreeMemoryPages(MM_EnvironmentBase* env, uintptr_t memoryType, uintptr_t retainedBytes = 0);
 
 	/**
 	 * Create a MemorySpace object.
@@ -2017,14 +2017,14 @@ MM_MemorySubSpace::wasContractedThisGC(uintptr_t gcCount)
 }
 
 uintptr_t
-MM_MemorySubSpace::releaseFreeMemoryPages(MM_EnvironmentBase* env)
+MM_MemorySubSpace::releaseFreeMemoryPages(MM_EnvironmentBase* env, uintptr_t &retainedBytes)
 {
 	Assert_MM_unreachable();
 	return 0;
 }
 
 uintptr_t
-MM_MemorySubSpace::releaseFreeMemoryPages(MM_EnvironmentBase* env, uintptr_t memoryType)
+MM_MemorySubSpace::releaseFreeMemoryPages(MM_EnvironmentBase* env, uintptr_t memoryType, uintptr_t &retainedBytes)
 {
 	Assert_MM_unreachable();
 	return 0;
@@ -447,9 +447,9 @@ public:
 	void unlockRegionList();
 	bool wasContractedThisGC(uintptr_t gcCount);
 
-	virtual uintptr_t releaseFreeMemoryPages(MM_EnvironmentBase* env);
+	virtual uintptr_t releaseFreeMemoryPages(MM_EnvironmentBase* env, uintptr_t &retainedBytes);
 
-	virtual uintptr_t releaseFreeMemoryPages(MM_EnvironmentBase* env, uintptr_t memoryType);
+	virtual uintptr_t releaseFreeMemoryPages(MM_EnvironmentBase* env, uintptr_t memoryType, uintptr_t &retainedBytes);
 
 	/**
 	 * Create a MemorySubSpace object.
@@ -458,14 +458,14 @@ MM_MemorySubSpaceFlat::collectorExpand(MM_EnvironmentBase* env, MM_Collector* re
 }
 
 uintptr_t
-MM_MemorySubSpaceFlat::releaseFreeMemoryPages(MM_EnvironmentBase* env)
+MM_MemorySubSpaceFlat::releaseFreeMemoryPages(MM_EnvironmentBase* env, uintptr_t &retainedBytes)
 {
-	return releaseFreeMemoryPages(env, MEMORY_TYPE_OLD);
+	return releaseFreeMemoryPages(env, MEMORY_TYPE_OLD, retainedBytes);
 }
 
 uintptr_t
-MM_MemorySubSpaceFlat::releaseFreeMemoryPages(MM_EnvironmentBase* env, uintptr_t memoryType)
+MM_MemorySubSpaceFlat::releaseFreeMemoryPages(MM_EnvironmentBase* env, uintptr_t memoryType, uintptr_t &retainedBytes)
 {
 	Assert_MM_true_internal(OMR_ARE_ALL_BITS_SET(memoryType, MEMORY_TYPE_OLD));
-	return _memorySubSpace->releaseFreeMemoryPages(env);
+	return _memorySubSpace->releaseFreeMemoryPages(env, retainedBytes);
 }
@@ -323,14 +323,14 @@ MM_MemorySubSpaceGenerational::counterBalanceContract(
 }
 
 uintptr_t
-MM_MemorySubSpaceGenerational::releaseFreeMemoryPages(MM_EnvironmentBase* env, uintptr_t memoryType)
+MM_MemorySubSpaceGenerational::releaseFreeMemoryPages(MM_EnvironmentBase* env, uintptr_t memoryType, uintptr_t &retainedBytes)
 {
 	Assert_MM_true(OMR_ARE_ALL_BITS_SET(memoryType, MEMORY_TYPE_OLD));
 
-	uintptr_t releasedPages = _memorySubSpaceOld->releaseFreeMemoryPages(env);
+	uintptr_t releasedPages = _memorySubSpaceOld->releaseFreeMemoryPages(env, retainedBytes);
 
 	if (OMR_ARE_ALL_BITS_SET(memoryType, MEMORY_TYPE_NEW)) {
-		releasedPages += _memorySubSpaceNew->releaseFreeMemoryPages(env);
+		releasedPages += _memorySubSpaceNew->releaseFreeMemoryPages(env, retainedBytes);
 	}
 
 	return releasedPages;
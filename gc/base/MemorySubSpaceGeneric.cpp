@@ -790,7 +790,7 @@ MM_MemorySubSpaceGeneric::removeTenureRange(MM_EnvironmentBase* env, uintptr_t s
 }
 
 uintptr_t
-MM_MemorySubSpaceGeneric::releaseFreeMemoryPages(MM_EnvironmentBase* env)
+MM_MemorySubSpaceGeneric::releaseFreeMemoryPages(MM_EnvironmentBase* env, uintptr_t &retainedBytes)
 {
-	return _memoryPool->releaseFreeMemoryPages(env);
+	return _memoryPool->releaseFreeMemoryPages(env, retainedBytes);
 }
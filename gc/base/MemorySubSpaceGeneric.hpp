@@ -122,7 +122,7 @@ public:
 
 	virtual bool isActive();
 
-	virtual uintptr_t releaseFreeMemoryPages(MM_EnvironmentBase* env);
+	virtual uintptr_t releaseFreeMemoryPages(MM_EnvironmentBase* env, uintptr_t &retainedBytes);
 
 	/**
 	 * Create a MemorySubSpaceGeneric object
@@ -39,6 +39,7 @@
 #include "ParallelDispatcher.hpp"
 #include "PhysicalSubArena.hpp"
 #include "Scavenger.hpp"
+#include "TLHPrezeroer.hpp"
 
 #if defined(OMR_VALGRIND_MEMCHECK)
 #include "MemcheckWrapper.hpp"
@@ -124,6 +125,20 @@ MM_MemorySubSpaceSemiSpace::allocationRequestFailed(MM_EnvironmentBase *env, MM_
 
 	Assert_MM_mustHaveExclusiveVMAccess(env->getOmrVMThread());
 
+#if defined(OMR_GC_THREAD_LOCAL_HEAP) && defined(OMR_GC_BATCH_CLEAR_TLH)
+	/* Memory zeroed ahead for TLH refreshes is still free nursery memory; let a failed object allocation have it before collecting */
+	MM_TLHPrezeroer *prezeroer = env->getExtensions()->tlhPrezeroer;
+	if ((ALLOCATION_TYPE_TLH != allocationType) && (NULL != prezeroer) && prezeroer->releaseReserve(env)) {
+		allocateDescription->restoreObjects(env);
+		addr = allocateGeneric(env, allocateDescription, allocationType, objectAllocationInterface, _memorySubSpaceAllocate);
+		if (NULL != addr) {
+			Trc_MM_MSSSS_allocationRequestFailed_exit(env->getLanguageVMThread(), allocateDescription->getBytesRequested(), 5, addr);
+			return addr;
+		}
+		allocateDescription->saveObjects(env);
+	}
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) && defined(OMR_GC_BATCH_CLEAR_TLH) */
+
 	reportAllocationFailureStart(env, allocateDescription);
 	allocateDescription->setAllocationType(allocationType);
 	/* we will pass this as the target subspace for the restarted allocation because the subspaces will swap, if the collection is 
@@ -770,9 +785,20 @@ MM_MemorySubSpaceSemiSpace::checkSubSpaceMemoryPostCollectTilt(MM_EnvironmentBas
 				_tiltedAverageBytesFlippedDelta);
 		}
 
+		/* The Cost tenure strategy projects the bytes flipped at the tenure age it chose, which may differ from the
+		 * ages flipped so far, so size survivor space for that projection (unless objects just failed to flip)
+		 */
+		uintptr_t expectedBytesFlipped = _tiltedAverageBytesFlipped;
+		if (extensions->scvTenureStrategyCost && (0 != extensions->scavengerStats._tenureCostAge) && (0 == extensions->scavengerStats._failedFlipCount)) {
+			expectedBytesFlipped = extensions->scavengerStats._tenureCostSurvivorBytes;
+			if (debug) {
+				omrtty_printf("\tcost tenure strategy survivor bytes: %zu (age %zu)\n", expectedBytesFlipped, extensions->scavengerStats._tenureCostAge);
+			}
+		}
+
 		/* Calculate the desired survivor space ratio */
 		double survivorSizeAmplification = 1.04 + extensions->dispatcher->threadCount() / 100.0;
-		double desiredSurvivorSize = (_tiltedAverageBytesFlipped + _tiltedAverageBytesFlippedDelta) * survivorSizeAmplification;
+		double desiredSurvivorSize = (expectedBytesFlipped + _tiltedAverageBytesFlippedDelta) * survivorSizeAmplification;
 
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 		if (_extensions->isConcurrentScavengerEnabled()) {
@@ -1111,9 +1137,11 @@ MM_MemorySubSpaceSemiSpace::mergeLargeObjectAllocateStats(MM_EnvironmentBase *en
 }
 
 uintptr_t
-MM_MemorySubSpaceSemiSpace::releaseFreeMemoryPages(MM_EnvironmentBase* env)
+MM_MemorySubSpaceSemiSpace::releaseFreeMemoryPages(MM_EnvironmentBase* env, uintptr_t &retainedBytes)
 {
-	return _memorySubSpaceAllocate->releaseFreeMemoryPages(env) + _memorySubSpaceSurvivor->releaseFreeMemoryPages(env);
+	uintptr_t releasedBytes = _memorySubSpaceAllocate->releaseFreeMemoryPages(env, retainedBytes);
+	releasedBytes += _memorySubSpaceSurvivor->releaseFreeMemoryPages(env, retainedBytes);
+	return releasedBytes;
 }
 
 #endif /* OMR_GC_MODRON_SCAVENGER */
@@ -171,7 +171,7 @@ public:
 	 */
 	virtual void mergeLargeObjectAllocateStats(MM_EnvironmentBase *env);
 
-	virtual uintptr_t releaseFreeMemoryPages(MM_EnvironmentBase* env);
+	virtual uintptr_t releaseFreeMemoryPages(MM_EnvironmentBase* env, uintptr_t &retainedBytes);
 
 	/**
 	 * Create a MemorySubSpaceSemiSpace object.
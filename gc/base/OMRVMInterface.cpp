@@ -39,6 +39,7 @@
 #include "SublistIterator.hpp"
 #include "SublistSlotIterator.hpp"
 #include "Task.hpp"
+#include "TLHPrezeroer.hpp"
 
 extern "C" {
 
@@ -104,6 +105,13 @@ GC_OMRVMInterface::flushCachesForWalk(OMR_VM *omrVM)
 		MM_EnvironmentBase *envToFlush = MM_EnvironmentBase::getEnvironment(omrVMThread);
 		GC_OMRVMThreadInterface::flushCachesForWalk(envToFlush, envToFlush);
 	}
+
+#if defined(OMR_GC_THREAD_LOCAL_HEAP) && defined(OMR_GC_BATCH_CLEAR_TLH)
+	MM_TLHPrezeroer *prezeroer = MM_GCExtensionsBase::getExtensions(omrVM)->tlhPrezeroer;
+	if (NULL != prezeroer) {
+		prezeroer->flush(NULL);
+	}
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) && defined(OMR_GC_BATCH_CLEAR_TLH) */
 }
 
 /**
@@ -140,6 +148,12 @@ GC_OMRVMInterface::flushCachesForGC(MM_EnvironmentBase *env)
 		GC_OMRVMThreadInterface::flushCachesForGC(env, threadEnv);
 	}
 
+#if defined(OMR_GC_THREAD_LOCAL_HEAP) && defined(OMR_GC_BATCH_CLEAR_TLH)
+	if (NULL != extensions->tlhPrezeroer) {
+		extensions->tlhPrezeroer->flush(env);
+	}
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) && defined(OMR_GC_BATCH_CLEAR_TLH) */
+
 	extensions->bytesAllocatedMost = allocatedBytesMax;
 	extensions->vmThreadAllocatedMost = vmThreadMax;
 }
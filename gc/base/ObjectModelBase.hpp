@@ -813,6 +813,34 @@ public:
 		return _delegate.getHotFieldOffset3(forwardedHeader);
 	}
 
+#if defined(OMR_GC_AUTO_HOT_FIELDS)
+	/**
+	 * Returns an identity shared by all objects with the same layout of reference fields.
+	 * Used to learn hot fields at runtime if scavengerAutoHotFields is enabled. Only required
+	 * from the glue if the build enables OMR_GC_AUTO_HOT_FIELDS.
+	 *
+	 * @param objectPtr pointer to the object
+	 * @return the shape of the object, or 0 if hot fields should not be learned for the object
+	 */
+	MMINLINE uintptr_t
+	getObjectShape(omrobjectptr_t objectPtr)
+	{
+		return _delegate.getObjectShape(objectPtr);
+	}
+
+	/**
+	 * Returns the shape of the object referred to by the forwarded header, see getObjectShape(omrobjectptr_t).
+	 *
+	 * @param forwardedHeader pointer to the MM_ForwardedHeader instance encapsulating the object
+	 * @return the shape of the object, or 0 if hot fields should not be learned for the object
+	 */
+	MMINLINE uintptr_t
+	getObjectShape(MM_ForwardedHeader *forwardedHeader)
+	{
+		return _delegate.getObjectShape(forwardedHeader);
+	}
+#endif /* defined(OMR_GC_AUTO_HOT_FIELDS) */
+
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC) */
 
 #if defined(OMR_GC_MODRON_SCAVENGER)
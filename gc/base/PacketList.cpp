@@ -33,8 +33,14 @@ MM_PacketList::initialize(MM_EnvironmentBase *env)
 	MM_GCExtensionsBase *extensions = env->getExtensions();
 	bool result = true;
 	
-	_sublistCount = extensions->packetListSplit;
-	Assert_MM_true(0 < _sublistCount);
+	_nodeCount = 1;
+	if (extensions->numaAwarePacketLists) {
+		_nodeCount = OMR_MAX(1, extensions->_numaManager.getAffinityLeaderCount());
+	}
+	Assert_MM_true(0 < extensions->packetListSplit);
+	/* every node gets its own group of sublists, each split as finely as the whole list would otherwise be split */
+	_sublistsPerNode = extensions->packetListSplit;
+	_sublistCount = _nodeCount * _sublistsPerNode;
 
 	_sublists = (PacketSublist *)extensions->getForge()->allocate(
 			sizeof(PacketSublist) * _sublistCount,
@@ -59,12 +65,15 @@ bool
 MM_PacketList::reinitializeForRestore(MM_EnvironmentBase *env)
 {
 	MM_GCExtensionsBase *extensions = env->getExtensions();
-	uintptr_t newSublistCount = extensions->packetListSplit;
+	uintptr_t newSublistsPerNode = extensions->packetListSplit;
+	uintptr_t newSublistCount = _nodeCount * newSublistsPerNode;
 	bool result = true;
 
 	Assert_MM_true(0 < newSublistCount);
 
-	if (newSublistCount > _sublistCount) {
+	if (1 < _nodeCount) {
+		/* growing would reassign sublists to other nodes; keep the node-local layout from startup */
+	} else if (newSublistCount > _sublistCount) {
 		PacketSublist *newSublists = (PacketSublist *)extensions->getForge()->allocate(
 				sizeof(PacketSublist) * newSublistCount,
 				OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
@@ -87,10 +96,11 @@ MM_PacketList::reinitializeForRestore(MM_EnvironmentBase *env)
 				extensions->getForge()->free(_sublists);
 				_sublists = newSublists;
 				_sublistCount = newSublistCount;
+				_sublistsPerNode = newSublistsPerNode;
 			}
 		}
 	} else {
-		Assert_MM_true(extensions->packetListSplit == _sublistCount);
+		Assert_MM_true(newSublistsPerNode == _sublistsPerNode);
 	}
 
 	return result;
@@ -111,6 +121,29 @@ MM_PacketList::tearDown(MM_EnvironmentBase *env)
 	}
 }
 
+MM_Packet *
+MM_PacketList::popRemote(MM_EnvironmentBase *env, uintptr_t localNodeBase)
+{
+	MM_Packet *packet = NULL;
+	uintptr_t offset = env->getEnvironmentId() % _sublistsPerNode;
+
+	/* walk the other nodes starting with the next one, so that threads on different nodes spread out their remote accesses */
+	for (uintptr_t node = 1; (NULL == packet) && (node < _nodeCount); node++) {
+		uintptr_t nodeBase = (localNodeBase + (node * _sublistsPerNode)) % _sublistCount;
+		for (uintptr_t i = 0; (NULL == packet) && (i < _sublistsPerNode); i++) {
+			packet = popFromSublist(&_sublists[nodeBase + ((offset + i) % _sublistsPerNode)]);
+		}
+	}
+
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	if (NULL != packet) {
+		env->_markStats._packetsAcquiredRemote += 1;
+	}
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+
+	return packet;
+}
+
 void 
 MM_PacketList::pushList(MM_Packet *head, MM_Packet *tail, uintptr_t count)
 {
@@ -71,6 +71,8 @@ private:
 	PacketSublist *_sublists;	/**< An array of PacketSublist structures which is _sublistCount elements long */
 	
 	uintptr_t _sublistCount; /**< The number of lists (split for parallelism). Must be at least 1 */
+	uintptr_t _nodeCount; /**< The number of NUMA nodes the sublists are grouped by (1 if the lists are not NUMA aware) */
+	uintptr_t _sublistsPerNode; /**< The number of consecutive sublists owned by each NUMA node (_sublistCount / _nodeCount) */
 	volatile uintptr_t _count;  /**< Number of items in the list */
 	
 /* Functionality Section */
@@ -118,8 +120,44 @@ private:
 	MMINLINE uintptr_t
 	getSublistIndex(MM_EnvironmentBase *env)
 	{
-		return env->getEnvironmentId() % _sublistCount;
+		uintptr_t nodeIndex = (1 == _nodeCount) ? 0 : (env->_packetListNumaNode % _nodeCount);
+		return (nodeIndex * _sublistsPerNode) + (env->getEnvironmentId() % _sublistsPerNode);
 	}
+
+	/**
+	 * Pop a packet off of the specified sublist, if it has one.
+	 *
+	 * @param list the sublist to pop from
+	 * @return the packet, or NULL if the sublist was empty
+	 */
+	MMINLINE MM_Packet *
+	popFromSublist(PacketSublist *list)
+	{
+		MM_Packet *packet = NULL;
+		if (NULL != list->_head) {
+			list->_lock.acquire();
+			if (NULL != list->_head) {
+				packet = list->_head;
+				list->_head = packet->_next;
+				decrementCount(1);
+				if (NULL == list->_head) {
+					list->_tail = NULL;
+				} else {
+					list->_head->_previous = NULL;
+				}
+			}
+			list->_lock.release();
+		}
+		return packet;
+	}
+
+	/**
+	 * Pop a packet off of a sublist belonging to another NUMA node than the one the current thread prefers.
+	 *
+	 * @param localNodeBase the index of the first sublist of the current thread's node
+	 * @return the packet, or NULL if all remote sublists were empty
+	 */
+	MM_Packet *popRemote(MM_EnvironmentBase *env, uintptr_t localNodeBase);
 		
 protected:
 	
@@ -186,33 +224,24 @@ public:
 	MMINLINE MM_Packet *pop(MM_EnvironmentBase *env)
 	{
 		uintptr_t index = getSublistIndex(env);
+		uintptr_t localNodeBase = index - (index % _sublistsPerNode);
 		MM_Packet *packet = NULL;
 
-		for (uintptr_t i = 0; i < _sublistCount; i++) {
-			PacketSublist *list = &_sublists[index];
-
-			if (NULL != list->_head) {
-				list->_lock.acquire();
-				if (NULL != list->_head) {
-					packet = list->_head;
-					list->_head = packet->_next;
-					decrementCount(1);
-					if (NULL == list->_head) {
-						list->_tail = NULL;
-					} else {
-						list->_head->_previous = NULL;
-					}		
-				}
-				list->_lock.release();
-
-				if (NULL != packet) {
-					break;
-				}
+		/* prefer packets released by threads running on the same node */
+		for (uintptr_t i = 0; i < _sublistsPerNode; i++) {
+			packet = popFromSublist(&_sublists[index]);
+			if (NULL != packet) {
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+				env->_markStats._packetsAcquiredLocal += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+				return packet;
 			}
-			
-			index = (index + 1) %  _sublistCount;
+			index = localNodeBase + ((index + 1 - localNodeBase) % _sublistsPerNode);
 		}
 
+		if (1 < _nodeCount) {
+			packet = popRemote(env, localNodeBase);
+		}
 		return packet;
 	}
 	
@@ -262,6 +291,8 @@ public:
 		MM_BaseNonVirtual()
 		,_sublists(NULL)
 		,_sublistCount(0)
+		,_nodeCount(1)
+		,_sublistsPerNode(0)
 		,_count(0)
 	{
 		_typeId = __FUNCTION__;
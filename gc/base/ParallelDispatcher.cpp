@@ -38,6 +38,7 @@
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
 #include "Task.hpp"
+#include "WorkStealingDeque.hpp"
 
 #include "ParallelDispatcher.hpp"
 
@@ -77,6 +78,7 @@ dispatcher_thread_proc2(OMRPortLibrary* portLib, void *info)
 	env->setWorkerID(workerID);
 	/* Enviroment initialization specific for GC threads (after worker ID is set) */
 	env->initializeGCThread();
+	dispatcher->bindWorkerToNumaNode(env);
 
 	/* Signal that the thread was created succesfully */
 	workerInfo->workerFlags = WORKER_INFO_FLAG_OK;
@@ -255,6 +257,8 @@ MM_ParallelDispatcher::kill(MM_EnvironmentBase *env)
 		_threadTable = NULL;
 	}
 
+	tearDownWorkStealingDeques(env);
+
 	env->getForge()->free(this);
 }
 
@@ -296,12 +300,98 @@ MM_ParallelDispatcher::initialize(MM_EnvironmentBase *env)
 	}
 	memset(_taskTable, 0, _threadCountMaximum * sizeof(MM_Task *));
 
+	if (!initializeWorkStealingDeques(env)) {
+		goto error_no_memory;
+	}
+
 	return true;
 
 error_no_memory:
 	return false;
 }
 
+bool
+MM_ParallelDispatcher::initializeWorkStealingDeques(MM_EnvironmentBase *env)
+{
+	if (0 == _extensions->workStealingDequeSize) {
+		return true;
+	}
+
+	OMR::GC::Forge *forge = env->getForge();
+	_workStealingDequeTable = (MM_WorkStealingDeque **)forge->allocate(_threadCountMaximum * sizeof(MM_WorkStealingDeque *), OMR::GC::AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
+	if (NULL == _workStealingDequeTable) {
+		return false;
+	}
+	memset(_workStealingDequeTable, 0, _threadCountMaximum * sizeof(MM_WorkStealingDeque *));
+	_workStealingDequeCount = _threadCountMaximum;
+
+	for (uintptr_t index = 0; index < _workStealingDequeCount; index++) {
+		_workStealingDequeTable[index] = MM_WorkStealingDeque::newInstance(env, _extensions->workStealingDequeSize);
+		if (NULL == _workStealingDequeTable[index]) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void
+MM_ParallelDispatcher::tearDownWorkStealingDeques(MM_EnvironmentBase *env)
+{
+	if (NULL != _workStealingDequeTable) {
+		for (uintptr_t index = 0; index < _workStealingDequeCount; index++) {
+			if (NULL != _workStealingDequeTable[index]) {
+				_workStealingDequeTable[index]->kill(env);
+			}
+		}
+		env->getForge()->free(_workStealingDequeTable);
+		_workStealingDequeTable = NULL;
+		_workStealingDequeCount = 0;
+	}
+}
+
+void *
+MM_ParallelDispatcher::stealWork(MM_EnvironmentBase *env)
+{
+	uintptr_t workerID = env->getWorkerID();
+	uintptr_t victimCount = OMR_MIN(_threadCount, _workStealingDequeCount);
+	void *element = NULL;
+
+	for (uintptr_t offset = 1; (NULL == element) && (offset < victimCount); offset++) {
+		MM_WorkStealingDeque *victim = _workStealingDequeTable[(workerID + offset) % victimCount];
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+		env->_workPacketStats.workStealAttempts += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+		element = victim->steal();
+	}
+
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	if (NULL != element) {
+		env->_workPacketStats.workStealSuccesses += 1;
+	}
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+
+	return element;
+}
+
+void
+MM_ParallelDispatcher::bindWorkerToNumaNode(MM_EnvironmentBase *env)
+{
+	MM_NUMAManager *numaManager = &_extensions->_numaManager;
+	uintptr_t nodeCount = 0;
+	J9MemoryNodeDetail const *affinityLeaders = numaManager->getAffinityLeaders(&nodeCount);
+
+	if (_extensions->numaAwarePacketLists && (1 < nodeCount)) {
+		uintptr_t nodeIndex = env->getWorkerID() % nodeCount;
+		env->_packetListNumaNode = nodeIndex;
+		/* simulated nodes have no physical mapping, so only the sublist preference applies to them */
+		if (numaManager->isPhysicalNUMASupported() && numaManager->shouldSetCPUAffinity()) {
+			uintptr_t nodeNumber = affinityLeaders[nodeIndex].j9NodeNumber;
+			env->setNumaAffinity(&nodeNumber, 1);
+		}
+	}
+}
+
 bool
 MM_ParallelDispatcher::startUpThreads()
 {
@@ -39,6 +39,7 @@
 #include "GCExtensionsBase.hpp"
 
 class MM_EnvironmentBase;
+class MM_WorkStealingDeque;
 
 class MM_ParallelDispatcher : public MM_BaseVirtual
 {
@@ -83,6 +84,9 @@ protected:
 	void* _handler_arg;
 	uintptr_t _defaultOSStackSize; /**< default OS stack size */
 
+	MM_WorkStealingDeque **_workStealingDequeTable; /**< Per worker work-stealing deques, indexed by worker ID (NULL if work stealing is disabled) */
+	uintptr_t _workStealingDequeCount; /**< number of entries in _workStealingDequeTable */
+
 #if defined(J9VM_OPT_CRIU_SUPPORT)
 	uintptr_t _poolMaxCapacity;  /**< Size of the dispatcher tables: _taskTable, _statusTable & _threadTable. */
 #endif /* defined(J9VM_OPT_CRIU_SUPPORT) */
@@ -142,6 +146,20 @@ protected:
 	virtual void mainEntryPoint(MM_EnvironmentBase *env);
 
 	bool initialize(MM_EnvironmentBase *env);
+
+	/**
+	 * Allocate one work-stealing deque per thread table entry, if enabled by MM_GCExtensionsBase::workStealingDequeSize.
+	 * @return true on success (or if work stealing is disabled), false on allocation failure
+	 */
+	bool initializeWorkStealingDeques(MM_EnvironmentBase *env);
+	void tearDownWorkStealingDeques(MM_EnvironmentBase *env);
+
+	/**
+	 * Assign a GC thread to a NUMA node, round-robin by worker ID, if MM_GCExtensionsBase::numaAwarePacketLists is set.
+	 * The thread will prefer the work packet sublists of that node and, when physical NUMA is available, is bound to it.
+	 * @param env[in] the GC thread (its worker ID must already be set)
+	 */
+	void bindWorkerToNumaNode(MM_EnvironmentBase *env);
 	
 	virtual void prepareThreadsForTask(MM_EnvironmentBase *env, MM_Task *task, uintptr_t threadCount);
 	void cleanupAfterTask(MM_EnvironmentBase *env);
@@ -218,6 +236,27 @@ public:
 
 	virtual void run(MM_EnvironmentBase *env, MM_Task *task, uintptr_t threadCount = UDATA_MAX);
 
+	/**
+	 * Fetch the work-stealing deque owned by the calling GC thread.  Tasks opt into work stealing by attaching
+	 * this deque to their work stack (see MM_WorkStack::attachWorkStealingDeque()).
+	 * @param env[in] the current GC thread
+	 * @return the deque, or NULL if work stealing is disabled or not available for this thread
+	 */
+	MMINLINE MM_WorkStealingDeque *
+	getWorkStealingDeque(MM_EnvironmentBase *env)
+	{
+		uintptr_t workerID = env->getWorkerID();
+		return (workerID < _workStealingDequeCount) ? _workStealingDequeTable[workerID] : NULL;
+	}
+
+	/**
+	 * Attempt to steal a single work item from the deque of any other GC thread.  Victims are probed
+	 * round-robin starting with the next worker ID so that thieves spread out over the victims.
+	 * @param env[in] the current GC thread
+	 * @return the stolen item, or NULL if no work could be stolen
+	 */
+	void *stealWork(MM_EnvironmentBase *env);
+
 	static MM_ParallelDispatcher *newInstance(MM_EnvironmentBase *env, omrsig_handler_fn handler, void* handler_arg, uintptr_t defaultOSStackSize);
 	virtual void kill(MM_EnvironmentBase *env);
 
@@ -241,6 +280,8 @@ public:
 		,_handler(handler)
 		,_handler_arg(handler_arg)
 		,_defaultOSStackSize(defaultOSStackSize)
+		,_workStealingDequeTable(NULL)
+		,_workStealingDequeCount(0)
 #if defined(J9VM_OPT_CRIU_SUPPORT)
 		,_poolMaxCapacity(0)
 #endif /* defined(J9VM_OPT_CRIU_SUPPORT) */
@@ -80,6 +80,84 @@ public:
 	}
 };
 
+/**
+ * Walks the heap in parallel, reporting the live objects found by each GC thread in batches.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ParallelObjectBatchDoTask : public MM_ParallelTask
+{
+	/*
+	 * Data members
+	 */
+private:
+	OMR_GC_HeapObjectsFunc _function;
+	void *_userData;
+	uintptr_t _walkFlags;
+	uintptr_t _batchSize;
+	OMR_GC_HeapObject *_objects; /**< batchSize objects for each GC thread, indexed by worker ID */
+
+	MM_ParallelHeapWalker *_heapWalker;
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+public:
+	virtual uintptr_t getVMStateID() { return OMRVMSTATE_GC_PARALLEL_OBJECT_DO; };
+
+	virtual void run(MM_EnvironmentBase *env);
+
+	/*
+	 * Create a ParallelObjectBatchDoTask object.
+	 */
+	MM_ParallelObjectBatchDoTask(MM_EnvironmentBase *env, MM_ParallelHeapWalker *heapWalker, OMR_GC_HeapObjectsFunc function, void *userData, uintptr_t walkFlags, uintptr_t batchSize, OMR_GC_HeapObject *objects)
+		: MM_ParallelTask(env, env->getExtensions()->dispatcher)
+		, _function(function)
+		, _userData(userData)
+		, _walkFlags(walkFlags)
+		, _batchSize(batchSize)
+		, _objects(objects)
+		, _heapWalker(heapWalker)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+/**
+ * The batch of objects being collected by one GC thread of a MM_ParallelObjectBatchDoTask.
+ */
+struct MM_ParallelObjectBatch {
+	OMR_GC_HeapObjectsFunc function;
+	void *userData;
+	MM_MarkMap *markMap;
+	GC_ObjectModel *objectModel;
+	OMR_GC_HeapObject *objects;
+	uintptr_t batchSize;
+	uintptr_t count;
+};
+
+/**
+ * Add a live object to the batch of the current GC thread, reporting the batch once it is full.
+ */
+static void
+batchObject(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectptr_t object, void *userData)
+{
+	MM_ParallelObjectBatch *batch = (MM_ParallelObjectBatch *)userData;
+
+	/* the heap was marked before the walk, so any unmarked object is dead */
+	if (batch->markMap->isBitSet(object)) {
+		batch->objects[batch->count].object = object;
+		batch->objects[batch->count].size = batch->objectModel->getConsumedSizeInBytesWithHeader(object);
+		batch->count += 1;
+		if (batch->batchSize == batch->count) {
+			batch->function(omrVMThread, batch->objects, batch->count, batch->userData);
+			batch->count = 0;
+		}
+	}
+}
+
 /**
  * newInstance of Parallel Heap Walker
  */
@@ -162,6 +240,37 @@ MM_ParallelHeapWalker::allObjectsDo(MM_EnvironmentBase *env, MM_HeapWalkerObject
 	}
 }
 
+/**
+ * Mark the heap, then walk through all live objects of the heap on the GC threads and report them
+ * to the provided function in batches of at most batchSize objects.
+ */
+bool
+MM_ParallelHeapWalker::allObjectBatchesDo(MM_EnvironmentBase *env, OMR_GC_HeapObjectsFunc function, void *userData, uintptr_t batchSize, uintptr_t walkFlags)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	uintptr_t threadCount = extensions->dispatcher->threadCountMaximum();
+	OMR_GC_HeapObject *objects = (OMR_GC_HeapObject *)env->getForge()->allocate(threadCount * batchSize * sizeof(OMR_GC_HeapObject), OMR::GC::AllocationCategory::OTHER, OMR_GET_CALLSITE());
+	if (NULL == objects) {
+		return false;
+	}
+
+	GC_OMRVMInterface::flushCachesForWalk(env->getOmrVM());
+	_globalCollector->prepareHeapForWalk(env);
+
+	/* The mark bits now delimit every live object, so regions can be split into chunks for the walk.
+	 * Whatever the collector last recorded about the mark map (postMark() leaves it valid after a global GC)
+	 * is restored afterwards, so the walk doesn't change what the next collection or walk may rely on.
+	 */
+	bool markMapValid = _markMap->isMarkMapValid();
+	_markMap->setMarkMapValid(true);
+	MM_ParallelObjectBatchDoTask objectBatchDoTask(env, this, function, userData, walkFlags, batchSize, objects);
+	extensions->dispatcher->run(env, &objectBatchDoTask);
+	_markMap->setMarkMapValid(markMapValid);
+
+	env->getForge()->free(objects);
+	return true;
+}
+
 /**
  * gets the heap walker and calls the actual objectSlotsDo function
  */
@@ -170,3 +279,25 @@ MM_ParallelObjectDoTask::run(MM_EnvironmentBase *env)
 {
 	_heapWalker->allObjectsDoParallel(env, _function, _userData, _walkFlags);
 }
+
+/**
+ * Walks the heap using a batch owned by the current GC thread, then reports the objects left in the batch.
+ */
+void
+MM_ParallelObjectBatchDoTask::run(MM_EnvironmentBase *env)
+{
+	MM_ParallelObjectBatch batch;
+	batch.function = _function;
+	batch.userData = _userData;
+	batch.markMap = _heapWalker->getMarkMap();
+	batch.objectModel = &env->getExtensions()->objectModel;
+	batch.objects = &_objects[env->getWorkerID() * _batchSize];
+	batch.batchSize = _batchSize;
+	batch.count = 0;
+
+	_heapWalker->allObjectsDoParallel(env, batchObject, &batch, _walkFlags);
+
+	if (0 != batch.count) {
+		_function(env->getOmrVMThread(), batch.objects, batch.count, _userData);
+	}
+}
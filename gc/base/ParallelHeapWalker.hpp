@@ -25,6 +25,7 @@
 
 #include "omr.h"
 #include "omrcfg.h"
+#include "omrgc.h"
 
 #include "HeapWalker.hpp"
 
@@ -61,6 +62,14 @@ public:
 	 */
 	virtual void allObjectsDo(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags, bool parallel, bool prepareHeapForWalk, bool includeDeadObjects);
 
+	/**
+	 * Mark the heap, then walk through all live objects of the heap on the GC threads and report them
+	 * to the provided function in batches of at most batchSize objects. Each GC thread reports its own batches.
+	 * The caller must hold exclusive VM access.
+	 * @return false if the batch buffers could not be allocated, true otherwise
+	 */
+	bool allObjectBatchesDo(MM_EnvironmentBase *env, OMR_GC_HeapObjectsFunc function, void *userData, uintptr_t batchSize, uintptr_t walkFlags);
+
 	MM_MarkMap *getMarkMap() {
 		return _markMap;
 	}
@@ -44,6 +44,7 @@ void
 MM_ParallelMarkTask::run(MM_EnvironmentBase *env)
 {
 	env->_workStack.prepareForWork(env, (MM_WorkPackets *)(_markingScheme->getWorkPackets()));
+	env->_workStack.attachWorkStealingDeque(env, _dispatcher);
 
 	_markingScheme->markLiveObjectsInit(env, _initMarkMap);
 
@@ -100,6 +101,18 @@ MM_ParallelMarkTask::cleanup(MM_EnvironmentBase *env)
 		env->_workPacketStats.workPacketsReleased,
 		env->_workPacketStats.workPacketsExchanged,
 		0/* TODO CRG figure out to get the array split size*/);
+	Trc_MM_ParallelMarkTask_workStealingStats(
+		env->getLanguageVMThread(),
+		(uint32_t)env->getWorkerID(),
+		env->_workPacketStats.workStealAttempts,
+		env->_workPacketStats.workStealSuccesses,
+		env->_workPacketStats.workStealingDonations);
+	Trc_MM_ParallelMarkTask_packetLocalityStats(
+		env->getLanguageVMThread(),
+		(uint32_t)env->getWorkerID(),
+		(uint32_t)env->_packetListNumaNode,
+		env->_markStats._packetsAcquiredLocal,
+		env->_markStats._packetsAcquiredRemote);
 }
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
@@ -32,6 +32,7 @@
 #include "TLHAllocationInterface.hpp"
 
 #include "omrport.h"
+#include "mmomrhook_internal.h"
 #include "ModronAssertions.h"
 
 #include "AllocateDescription.hpp"
@@ -206,9 +207,39 @@ MM_TLHAllocationInterface::allocateObject(MM_EnvironmentBase *env, MM_AllocateDe
 	uintptr_t sizeInBytesAllocated = (_stats.bytesAllocated(false) - _bytesAllocatedBase);
 	env->_oolTraceAllocationBytes += sizeInBytesAllocated;
 	env->_traceAllocationBytes += sizeInBytesAllocated;
+	if ((NULL != result) && (0 != extensions->allocationSamplingInterval)) {
+		sampleAllocation(env, allocDescription, (omrobjectptr_t)result, sizeInBytesAllocated);
+	}
 	return result;
 }
 
+/**
+ * Charge the bytes allocated out of line (including whole TLHs) to the thread's sampling counter, and report
+ * an allocation sample when it crosses the sampling interval. The listener sees the sample through
+ * omrVMThread->_allocationSampleBytes while it walks the allocating thread's stack.
+ */
+void
+MM_TLHAllocationInterface::sampleAllocation(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, omrobjectptr_t object, uintptr_t sizeInBytesAllocated)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	env->_allocationSamplingBytes += sizeInBytesAllocated;
+	if (env->_allocationSamplingBytes >= extensions->allocationSamplingInterval) {
+		OMR_VMThread *omrVMThread = env->getOmrVMThread();
+		uintptr_t sampledBytes = env->_allocationSamplingBytes;
+		env->_allocationSamplingBytes = 0;
+
+		omrVMThread->_allocationSampleBytes = sampledBytes;
+		TRIGGER_J9HOOK_MM_OMR_ALLOCATION_SAMPLE(
+			extensions->omrHookInterface,
+			omrVMThread,
+			object,
+			allocDescription->getBytesRequested(),
+			sampledBytes);
+		omrVMThread->_allocationSampleBytes = 0;
+	}
+}
+
 void *
 MM_TLHAllocationInterface::allocateArray(MM_EnvironmentBase *env, MM_AllocateDescription *allocateDescription, MM_MemorySpace *memorySpace, bool shouldCollectOnFailure)
 {
@@ -288,15 +319,17 @@ MM_TLHAllocationInterface::flushCache(MM_EnvironmentBase *env)
 	}	
 #endif /* OMR_GC_THREAD_LOCAL_HEAP */		
 	
-	extensions->allocationStats.merge(&_stats);
-	_stats.clear();
-	/* Since AllocationStats have been reset, reset the base as well*/
-	_bytesAllocatedBase = 0;
 	_tlhAllocationSupport.flushCache(env);
 
 #if defined(OMR_GC_NON_ZERO_TLH)
 	_tlhAllocationSupportNonZero.flushCache(env);
 #endif /* defined(OMR_GC_NON_ZERO_TLH) */
+
+	/* merge after the TLHs are flushed, so that the memory left in them is accounted for */
+	extensions->allocationStats.merge(&_stats);
+	_stats.clear();
+	/* Since AllocationStats have been reset, reset the base as well*/
+	_bytesAllocatedBase = 0;
 }
 
 void
@@ -92,6 +92,7 @@ protected:
 private:
 	void reconnect(MM_EnvironmentBase *env);
 	void *allocateFromTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool shouldCollectOnFailure);
+	void sampleAllocation(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, omrobjectptr_t object, uintptr_t sizeInBytesAllocated);
 
 	/**
 	 * Create a ThreadLocalHeap object.
@@ -49,6 +49,7 @@
 #include "MemorySubSpace.hpp"
 #include "ObjectAllocationInterface.hpp"
 #include "ObjectHeapIteratorAddressOrderedList.hpp"
+#include "TLHPrezeroer.hpp"
 
 #if defined(OMR_VALGRIND_MEMCHECK)
 #include "MemcheckWrapper.hpp"
@@ -96,6 +97,8 @@ MM_TLHAllocationSupport::clear(MM_EnvironmentBase *env)
 	setAllZeroes();
 
 	_tlh->refreshSize = extensions->tlhInitialSize;
+	_lastRefreshTime = 0;
+	_adaptiveRefreshSize = 0;
 }
 
 void
@@ -110,7 +113,13 @@ MM_TLHAllocationSupport::restart(MM_EnvironmentBase *env)
 	/* Clear current information accumulated */
 	setAllZeroes();
 
-	_tlh->refreshSize = MM_Math::roundToCeiling(extensions->tlhInitialSize, refreshSize / 2);
+	if (extensions->tlhAdaptiveSizing) {
+		/* keep the size learned from the allocation rate, but do not count the collection as time spent allocating */
+		_tlh->refreshSize = refreshSize;
+		_lastRefreshTime = 0;
+	} else {
+		_tlh->refreshSize = MM_Math::roundToCeiling(extensions->tlhInitialSize, refreshSize / 2);
+	}
 }
 
 bool
@@ -147,6 +156,10 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 	uintptr_t usedSize = getUsedSize();
 	stats->_tlhAllocatedUsed += usedSize;
 
+	if (extensions->tlhAdaptiveSizing) {
+		updateAdaptiveRefreshSize(env, usedSize);
+	}
+
 	/* Try to cache the current TLH */
 	if ((NULL != getRealTop()) && (getRemainingSize() >= tlhMinimumSize)) {
 		/* Cache the current TLH because it is bigger than the minimum size */
@@ -199,6 +212,9 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 		/* Try allocating a fresh TLH */
 		MM_AllocationContext *ac = env->getAllocationContext();
 		MM_MemorySpace *memorySpace = _objectAllocationInterface->getOwningEnv()->getMemorySpace();
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+		_prezeroed = false;
+#endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
 
 		if (NULL != ac) {
 			/* ensure that we are allowed to use the AI in this configuration in the Tarok case */
@@ -216,7 +232,12 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 				if (0 != extensions->batchClearTLH) {
 					void *base = getBase();
 					void *top = getTop();
-					OMRZeroMemory(base, (uintptr_t)top - (uintptr_t)base);
+					if (_prezeroed) {
+						stats->_tlhZeroedAheadBytes += (uintptr_t)top - (uintptr_t)base;
+					} else {
+						OMRZeroMemory(base, (uintptr_t)top - (uintptr_t)base);
+						stats->_tlhZeroedOnDemandBytes += (uintptr_t)top - (uintptr_t)base;
+					}
 				}
 			}
 #endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
@@ -256,7 +277,7 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 			 * may not give you the size requested */
 			/* Increase thread hungriness */
 			/* TODO: TLH values (max/min/inc) should be per tlh, or somewhere else? */
-			if (getRefreshSize() < tlhMaximumSize) {
+			if (!extensions->tlhAdaptiveSizing && (getRefreshSize() < tlhMaximumSize)) {
 				setRefreshSize(getRefreshSize() + extensions->tlhIncrementSize);
 			}
 			reserveTLHTopForGC(env);
@@ -306,7 +327,30 @@ MM_TLHAllocationSupport::allocateTLH(MM_EnvironmentBase *env, MM_AllocateDescrip
 
 	Assert_MM_true(_reservedBytesForGC == 0);
 
-	if(memoryPool->allocateTLH(env, allocDescription, getRefreshSize(), addrBase, addrTop)) {
+	bool allocated = false;
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+	/* Zeroed memory is only worth taking for TLHs that would be batch cleared */
+	MM_TLHPrezeroer *prezeroer = _zeroTLH ? env->getExtensions()->tlhPrezeroer : NULL;
+	_prezeroed = false;
+	if (NULL != prezeroer) {
+		_prezeroed = prezeroer->allocateTLH(env, allocDescription, memorySubSpace, memoryPool, getRefreshSize(), addrBase, addrTop);
+		allocated = _prezeroed;
+	}
+#endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
+
+	if (!allocated) {
+		allocated = (NULL != memoryPool->allocateTLH(env, allocDescription, getRefreshSize(), addrBase, addrTop));
+	}
+
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+	if (!allocated && (NULL != prezeroer)) {
+		/* the zeroing thread may hold the last of the pool */
+		_prezeroed = prezeroer->allocateTLH(env, allocDescription, memorySubSpace, memoryPool, getRefreshSize(), addrBase, addrTop);
+		allocated = _prezeroed;
+	}
+#endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
+
+	if (allocated) {
 		setupTLH(env, addrBase, addrTop, memorySubSpace, memoryPool);
 		allocDescription->setMemorySubSpace(memorySubSpace);
 		allocDescription->setObjectFlags(memorySubSpace->getObjectFlags());
@@ -324,12 +368,44 @@ MM_TLHAllocationSupport::flushCache(MM_EnvironmentBase *env)
 		env->getExtensions()->getGlobalCollector()->preAllocCacheFlush(env, getBase(), lastTLHobj);
 	}
 
+	if (NULL != getMemoryPool()) {
+		_objectAllocationInterface->getAllocationStats()->_tlhFlushedBytes += getRemainingSize();
+	}
+
 	/* Since AllocationStats have been reset, reset the base as well*/
 	_abandonedList = NULL;
 	_abandonedListSize = 0;
 	clear(env);
 }
 
+void
+MM_TLHAllocationSupport::updateAdaptiveRefreshSize(MM_EnvironmentBase *env, uintptr_t usedSize)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uint64_t now = omrtime_hires_clock();
+
+	if (0 != _lastRefreshTime) {
+		uint64_t elapsedMicros = omrtime_hires_delta(_lastRefreshTime, now, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		/* bytes the thread would allocate in a refresh interval at the rate seen since the last refresh */
+		uint64_t projectedBytes = ((uint64_t)usedSize * extensions->tlhAdaptiveRefreshInterval) / OMR_MAX(elapsedMicros, 1);
+		uintptr_t sampleSize = (uintptr_t)OMR_MIN(projectedBytes, (uint64_t)extensions->tlhMaximumSize);
+
+		/* average with the previous estimate, so that a single pause (or burst) only moves the size half way */
+		if (0 == _adaptiveRefreshSize) {
+			_adaptiveRefreshSize = sampleSize;
+		} else {
+			_adaptiveRefreshSize = (_adaptiveRefreshSize + sampleSize) / 2;
+		}
+
+		uintptr_t refreshSize = OMR_MAX(_adaptiveRefreshSize, extensions->tlhMinimumSize);
+		refreshSize = MM_Math::roundToCeiling(extensions->getObjectAlignmentInBytes(), refreshSize);
+		setRefreshSize(OMR_MIN(refreshSize, extensions->tlhMaximumSize));
+	}
+
+	_lastRefreshTime = now;
+}
+
 void
 MM_TLHAllocationSupport::setupTLH(MM_EnvironmentBase *env, void *addrBase, void *addrTop, MM_MemorySubSpace *memorySubSpace, MM_MemoryPool *memoryPool)
 {
@@ -84,6 +84,12 @@ private:
 	const bool _zeroTLH; /**< if true this TLH is primary (might be cleared by batchClearTLH), if false this is secondary TLH (and it would not be cleared ever) */
 
 	uintptr_t _reservedBytesForGC; /**< Number of bytes reserved in the TLH by collector. If set, we are guaranteed to have this remaining size available when we flush/clear TLH. */
+
+	uint64_t _lastRefreshTime; /**< hires clock at the last refresh measured for adaptive sizing, 0 if the next refresh starts a new measurement */
+	uintptr_t _adaptiveRefreshSize; /**< smoothed bytes this thread allocates from the TLH in tlhAdaptiveRefreshInterval, 0 until measured */
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+	bool _prezeroed; /**< true if the current TLH was handed out already zeroed by the TLH zeroing thread */
+#endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
 public:
 protected:
 private:
@@ -183,6 +189,15 @@ private:
 	 */
 	void restart(MM_EnvironmentBase *env);
 
+	/**
+	 * Size the next refresh from the rate at which the owning thread allocated from the TLH being retired,
+	 * so that busy threads get large TLHs and idle threads leave little unused memory behind at collections.
+	 * Used instead of the tlhIncrementSize growth if tlhAdaptiveSizing is enabled.
+	 *
+	 * @param usedSize bytes allocated from the TLH since the previous refresh
+	 */
+	void updateAdaptiveRefreshSize(MM_EnvironmentBase *env, uintptr_t usedSize);
+
 	/**
 	 * Reserve part (top) of TLH for GC if collector requires
 	 */
@@ -251,7 +266,12 @@ private:
 		_abandonedList(NULL),
 		_abandonedListSize(0),
 		_zeroTLH(zeroTLH),
-		_reservedBytesForGC(0)
+		_reservedBytesForGC(0),
+		_lastRefreshTime(0),
+		_adaptiveRefreshSize(0)
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+		, _prezeroed(false)
+#endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
 	{};
 
 	/*
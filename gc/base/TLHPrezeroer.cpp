@@ -0,0 +1,448 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+/**
+ * @file
+ * @ingroup GC_Base_Core
+ */
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_THREAD_LOCAL_HEAP) && defined(OMR_GC_BATCH_CLEAR_TLH)
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define OMR_TLH_PREZERO_NON_TEMPORAL
+#endif /* defined(__SSE2__) || defined(_M_X64) */
+#include <string.h>
+
+#include "ModronAssertions.h"
+#include "omr.h"
+#include "omrutil.h"
+
+#include "AllocateDescription.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Math.hpp"
+#include "MemoryPool.hpp"
+#include "MemorySubSpace.hpp"
+#include "ParallelDispatcher.hpp"
+#include "TLHAllocationSupport.hpp"
+#include "TLHPrezeroer.hpp"
+
+typedef struct PrezeroThreadInfo {
+	OMR_VM *omrVM;
+	uintptr_t threadFlags;
+	MM_TLHPrezeroer *prezeroer;
+} PrezeroThreadInfo;
+
+#define PREZERO_THREAD_INFO_FLAG_OK 1
+#define PREZERO_THREAD_INFO_FLAG_FAIL 2
+
+extern "C" {
+
+/**
+ * TLH zeroing thread procedure
+ *
+ * @parm info Address of PrezeroThreadInfo structure
+ * @return return code; always 0
+ */
+static uintptr_t
+prezero_thread_proc2(OMRPortLibrary* portLib, void *info)
+{
+	PrezeroThreadInfo *prezeroThreadInfo = (PrezeroThreadInfo *)info;
+	OMR_VM *omrVM = prezeroThreadInfo->omrVM;
+	MM_TLHPrezeroer *prezeroer = prezeroThreadInfo->prezeroer;
+
+	OMR_VMThread *omrThread = MM_EnvironmentBase::attachVMThread(omrVM, "TLH Prezero Helper", MM_EnvironmentBase::ATTACH_GC_HELPER_THREAD);
+
+	/* Signal that the thread has started (or not); info is not valid beyond this point */
+	omrthread_monitor_t activationMonitor = prezeroer->getActivationMonitor();
+	omrthread_monitor_enter(activationMonitor);
+	prezeroThreadInfo->threadFlags = (NULL != omrThread) ? PREZERO_THREAD_INFO_FLAG_OK : PREZERO_THREAD_INFO_FLAG_FAIL;
+	omrthread_monitor_notify_all(activationMonitor);
+	omrthread_monitor_exit(activationMonitor);
+
+	if (NULL != omrThread) {
+		prezeroer->threadEntryPoint(omrThread);
+	}
+
+	return 0;
+}
+
+/**
+ * TLH zeroing thread procedure
+ *
+ * @parm info Address of PrezeroThreadInfo structure
+ */
+static int J9THREAD_PROC
+prezero_thread_proc(void *info)
+{
+	PrezeroThreadInfo *prezeroThreadInfo = (PrezeroThreadInfo *)info;
+	MM_ParallelDispatcher *dispatcher = MM_GCExtensionsBase::getExtensions(prezeroThreadInfo->omrVM)->dispatcher;
+	OMRPORT_ACCESS_FROM_OMRVM(prezeroThreadInfo->omrVM);
+
+	uintptr_t rc;
+	omrsig_protect(prezero_thread_proc2, info,
+		dispatcher->getSignalHandler(), dispatcher->getSignalHandlerArg(),
+		OMRPORT_SIG_FLAG_SIGALLSYNC | OMRPORT_SIG_FLAG_MAY_CONTINUE_EXECUTION,
+		&rc);
+
+	return 0;
+}
+
+} /* extern "C" */
+
+MM_TLHPrezeroer *
+MM_TLHPrezeroer::newInstance(MM_EnvironmentBase *env)
+{
+	MM_TLHPrezeroer *prezeroer = (MM_TLHPrezeroer *)env->getForge()->allocate(sizeof(MM_TLHPrezeroer), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != prezeroer) {
+		new(prezeroer) MM_TLHPrezeroer(env);
+		if (!prezeroer->initialize(env)) {
+			prezeroer->kill(env);
+			prezeroer = NULL;
+		}
+	}
+	return prezeroer;
+}
+
+void
+MM_TLHPrezeroer::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_TLHPrezeroer::initialize(MM_EnvironmentBase *env)
+{
+	if (!_cacheLock.initialize(env, &_extensions->lnrlOptions, "MM_TLHPrezeroer:_cacheLock")) {
+		return false;
+	}
+
+	if (0 != omrthread_monitor_init_with_name(&_activationMonitor, 0, "MM_TLHPrezeroer::activation")) {
+		return false;
+	}
+
+	/* chunks must be able to hold their cache header and be split into minimum sized TLHs */
+	_chunkSize = OMR_MAX(_chunkSize, _extensions->tlhMinimumSize);
+	_chunkSize = MM_Math::roundToCeiling(_extensions->getObjectAlignmentInBytes(), OMR_MAX(_chunkSize, sizeof(MM_HeapLinkedFreeHeaderTLH)));
+
+	return true;
+}
+
+void
+MM_TLHPrezeroer::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _activationMonitor) {
+		omrthread_monitor_destroy(_activationMonitor);
+		_activationMonitor = NULL;
+	}
+
+	_cacheLock.tearDown();
+}
+
+bool
+MM_TLHPrezeroer::startupThread(MM_GCExtensionsBase *extensions)
+{
+	PrezeroThreadInfo prezeroThreadInfo;
+	prezeroThreadInfo.omrVM = extensions->getOmrVM();
+	prezeroThreadInfo.prezeroer = this;
+	prezeroThreadInfo.threadFlags = 0;
+
+	omrthread_monitor_enter(_activationMonitor);
+	_request = PREZERO_WAIT;
+
+	/* Zeroing ahead only uses cycles the application threads do not need */
+	IDATA threadForkResult = createThreadWithCategory(&_thread, OMR_OS_STACK_SIZE, J9THREAD_PRIORITY_MIN,
+														0, prezero_thread_proc, (void *)&prezeroThreadInfo, J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 == threadForkResult) {
+		do {
+			omrthread_monitor_wait(_activationMonitor);
+		} while (0 == prezeroThreadInfo.threadFlags);
+		_threadStarted = (PREZERO_THREAD_INFO_FLAG_OK == prezeroThreadInfo.threadFlags);
+	}
+	omrthread_monitor_exit(_activationMonitor);
+
+	return _threadStarted;
+}
+
+void
+MM_TLHPrezeroer::shutdownThread(MM_GCExtensionsBase *extensions)
+{
+	omrthread_monitor_enter(_activationMonitor);
+	if (_threadStarted) {
+		_request = PREZERO_SHUTDOWN;
+		omrthread_monitor_notify_all(_activationMonitor);
+		while (_threadStarted) {
+			omrthread_monitor_wait(_activationMonitor);
+		}
+	}
+	omrthread_monitor_exit(_activationMonitor);
+}
+
+void
+MM_TLHPrezeroer::threadEntryPoint(OMR_VMThread *omrThread)
+{
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrThread);
+	PrezeroRequest request = PREZERO_WAIT;
+
+	/* Thread not a mutator so identify its type */
+	env->initializeGCThread();
+	env->setThreadType(TLH_PREZERO_HELPER_THREAD);
+
+	while (PREZERO_SHUTDOWN != request) {
+		omrthread_monitor_enter(_activationMonitor);
+		while (PREZERO_WAIT == (request = _request)) {
+			omrthread_monitor_wait(_activationMonitor);
+		}
+		omrthread_monitor_exit(_activationMonitor);
+
+		if (PREZERO_ZERO == request) {
+			zeroAhead(env);
+
+			/* A request posted while zeroing is dropped; the next refresh that finds the cache low posts it again */
+			omrthread_monitor_enter(_activationMonitor);
+			if (PREZERO_ZERO == _request) {
+				_request = PREZERO_WAIT;
+			}
+			request = _request;
+			omrthread_monitor_exit(_activationMonitor);
+		}
+	}
+
+	MM_EnvironmentBase::detachVMThread(_extensions->getOmrVM(), omrThread, MM_EnvironmentBase::ATTACH_GC_HELPER_THREAD);
+
+	omrthread_monitor_enter(_activationMonitor);
+	_threadStarted = false;
+	_thread = NULL;
+	omrthread_monitor_notify_all(_activationMonitor);
+
+	/* Exit the monitor and terminate the thread */
+	omrthread_exit(_activationMonitor);
+}
+
+void
+MM_TLHPrezeroer::wakeUp()
+{
+	if (PREZERO_WAIT == _request) {
+		omrthread_monitor_enter(_activationMonitor);
+		if (PREZERO_WAIT == _request) {
+			_request = PREZERO_ZERO;
+			omrthread_monitor_notify_all(_activationMonitor);
+		}
+		omrthread_monitor_exit(_activationMonitor);
+	}
+}
+
+uintptr_t
+MM_TLHPrezeroer::getReserveLimit(MM_MemoryPool *memoryPool)
+{
+	/* the cached bytes are still free nursery memory, they are only out of the pool */
+	uintptr_t freeBytes = memoryPool->getActualFreeMemorySize() + _cachedBytes;
+	return OMR_MIN(_maximumBytes, (freeBytes / 100) * _extensions->tlhPrezeroMaximumFreePercent);
+}
+
+void
+MM_TLHPrezeroer::zeroAhead(MM_EnvironmentBase *env)
+{
+	bool const compressed = _extensions->compressObjectReferences();
+	bool done = false;
+
+	/* This thread runs at minimum priority and may be starved by the application threads, so VM access is
+	 * only held while a single chunk is taken and zeroed; a thread requesting exclusive access never waits
+	 * for more than that.
+	 */
+	while (!done && !env->isExclusiveAccessRequestWaiting()) {
+		env->acquireVMAccess();
+
+		_cacheLock.acquire();
+		MM_MemoryPool *memoryPool = _targetPool;
+		MM_MemorySubSpace *memorySubSpace = _targetSubSpace;
+		_cacheLock.release();
+
+		void *addrBase = NULL;
+		void *addrTop = NULL;
+		if ((NULL == memoryPool) || (_cachedBytes >= getReserveLimit(memoryPool))) {
+			done = true;
+		} else {
+			MM_AllocateDescription allocDescription(0, 0, false, true);
+			/* if the pool is exhausted, mutators take the remainder of the nursery from the cache */
+			done = (NULL == memoryPool->allocateTLH(env, &allocDescription, _chunkSize, addrBase, addrTop));
+		}
+
+		if (!done) {
+			uintptr_t size = (uintptr_t)addrTop - (uintptr_t)addrBase;
+			zeroNonTemporal(addrBase, size);
+
+			/* the chunk is formatted as an abandoned TLH, so that it is a hole to anything walking the nursery */
+			MM_HeapLinkedFreeHeaderTLH *chunk = (MM_HeapLinkedFreeHeaderTLH *)addrBase;
+			chunk->setSize(size);
+			chunk->_memoryPool = memoryPool;
+			chunk->_memorySubSpace = memorySubSpace;
+
+			_cacheLock.acquire();
+			/* the pool can not have changed, flushes are done with exclusive access and this thread holds VM access */
+			Assert_MM_true(memoryPool == _targetPool);
+			chunk->setNext(_cache, compressed);
+			_cache = chunk;
+			_cachedBytes += size;
+			_cacheLock.release();
+		}
+
+		env->releaseVMAccess();
+	}
+}
+
+void
+MM_TLHPrezeroer::zeroNonTemporal(void *base, uintptr_t sizeInBytes)
+{
+#if defined(OMR_TLH_PREZERO_NON_TEMPORAL)
+	uint8_t *cursor = (uint8_t *)base;
+	uint8_t *top = cursor + sizeInBytes;
+	uint8_t *alignedCursor = (uint8_t *)MM_Math::roundToCeiling(sizeof(__m128i), (uintptr_t)cursor);
+	uint8_t *alignedTop = (uint8_t *)MM_Math::roundToFloor(sizeof(__m128i), (uintptr_t)top);
+
+	if (alignedCursor < alignedTop) {
+		__m128i zero = _mm_setzero_si128();
+		memset(cursor, 0, alignedCursor - cursor);
+		for (cursor = alignedCursor; cursor < alignedTop; cursor += sizeof(__m128i)) {
+			_mm_stream_si128((__m128i *)cursor, zero);
+		}
+		memset(alignedTop, 0, top - alignedTop);
+		/* streaming stores are weakly ordered, make them visible before the chunk is published */
+		_mm_sfence();
+	} else {
+		memset(base, 0, sizeInBytes);
+	}
+#else /* defined(OMR_TLH_PREZERO_NON_TEMPORAL) */
+	OMRZeroMemory(base, sizeInBytes);
+#endif /* defined(OMR_TLH_PREZERO_NON_TEMPORAL) */
+}
+
+bool
+MM_TLHPrezeroer::allocateTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, MM_MemorySubSpace *memorySubSpace, MM_MemoryPool *memoryPool,
+		uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop)
+{
+	if (MEMORY_TYPE_NEW != memorySubSpace->getTypeFlags()) {
+		return false;
+	}
+
+	bool const compressed = _extensions->compressObjectReferences();
+	bool result = false;
+	bool refill = false;
+
+	_cacheLock.acquire();
+	if (NULL == _targetPool) {
+		/* first refresh after a flush, start zeroing ahead in this pool */
+		_targetPool = memoryPool;
+		_targetSubSpace = memorySubSpace;
+		refill = true;
+	} else if ((memoryPool == _targetPool) && (NULL != _cache)) {
+		MM_HeapLinkedFreeHeaderTLH *chunk = _cache;
+		uintptr_t chunkSize = chunk->getSize();
+		uintptr_t size = MM_Math::roundToCeiling(_extensions->getObjectAlignmentInBytes(), OMR_MAX(maximumSizeInBytesRequired, _extensions->tlhMinimumSize));
+		if (chunkSize >= (size + OMR_MAX(_extensions->tlhMinimumSize, sizeof(MM_HeapLinkedFreeHeaderTLH)))) {
+			/* carve the TLH off the top of the chunk, its header stays in place */
+			addrTop = chunk->afterEnd();
+			addrBase = (void *)((uintptr_t)addrTop - size);
+			chunk->setSize(chunkSize - size);
+		} else {
+			/* hand out the whole chunk, clearing its header */
+			_cache = (MM_HeapLinkedFreeHeaderTLH *)chunk->getNext(compressed);
+			addrBase = (void *)chunk;
+			addrTop = chunk->afterEnd();
+			size = chunkSize;
+			memset(addrBase, 0, sizeof(MM_HeapLinkedFreeHeaderTLH));
+		}
+		_cachedBytes -= size;
+		refill = (_cachedBytes < (getReserveLimit(memoryPool) / 2));
+		result = true;
+	}
+	_cacheLock.release();
+
+	if (refill) {
+		wakeUp();
+	}
+
+	if (result) {
+#if defined(OMR_GC_ALLOCATION_TAX)
+		if (_extensions->payAllocationTax) {
+			allocDescription->setAllocationTaxSize((uint8_t *)addrTop - (uint8_t *)addrBase);
+		}
+#endif /* OMR_GC_ALLOCATION_TAX */
+		allocDescription->setTLHAllocation(true);
+		allocDescription->setNurseryAllocation(true);
+		allocDescription->setMemoryPool(memoryPool);
+	}
+
+	return result;
+}
+
+bool
+MM_TLHPrezeroer::releaseReserve(MM_EnvironmentBase *env)
+{
+	bool const compressed = _extensions->compressObjectReferences();
+	bool released = false;
+
+	_cacheLock.acquire();
+	MM_HeapLinkedFreeHeaderTLH *chunk = _cache;
+	while (NULL != chunk) {
+		MM_HeapLinkedFreeHeaderTLH *next = (MM_HeapLinkedFreeHeaderTLH *)chunk->getNext(compressed);
+		MM_MemoryPool *memoryPool = chunk->_memoryPool;
+		void *addrTop = chunk->afterEnd();
+		if (chunk->getSize() >= memoryPool->getMinimumFreeEntrySize()) {
+			released = memoryPool->recycleHeapChunk(env, (void *)chunk, addrTop) || released;
+		} else {
+			memoryPool->abandonTlhHeapChunk((void *)chunk, addrTop);
+		}
+		chunk = next;
+	}
+	_cache = NULL;
+	_cachedBytes = 0;
+	_cacheLock.release();
+
+	return released;
+}
+
+void
+MM_TLHPrezeroer::flush(MM_EnvironmentBase *env)
+{
+	bool const compressed = _extensions->compressObjectReferences();
+
+	_cacheLock.acquire();
+	MM_HeapLinkedFreeHeaderTLH *chunk = _cache;
+	while (NULL != chunk) {
+		MM_HeapLinkedFreeHeaderTLH *next = (MM_HeapLinkedFreeHeaderTLH *)chunk->getNext(compressed);
+		chunk->_memoryPool->abandonTlhHeapChunk((void *)chunk, chunk->afterEnd());
+		chunk = next;
+	}
+	_cache = NULL;
+	_cachedBytes = 0;
+	_targetPool = NULL;
+	_targetSubSpace = NULL;
+	_cacheLock.release();
+}
+
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) && defined(OMR_GC_BATCH_CLEAR_TLH) */
@@ -0,0 +1,198 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+/**
+ * @file
+ * @ingroup GC_Base_Core
+ */
+
+#if !defined(TLHPREZEROER_HPP_)
+#define TLHPREZEROER_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#if defined(OMR_GC_THREAD_LOCAL_HEAP) && defined(OMR_GC_BATCH_CLEAR_TLH)
+
+#include "omrthread.h"
+
+#include "BaseVirtual.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "LightweightNonReentrantLock.hpp"
+
+class MM_AllocateDescription;
+class MM_HeapLinkedFreeHeaderTLH;
+class MM_MemoryPool;
+class MM_MemorySubSpace;
+struct OMR_VM;
+struct OMR_VMThread;
+
+/**
+ * Background zeroing of nursery memory for batch cleared TLHs.
+ *
+ * With batchClearTLH, each TLH refresh clears the whole TLH on the allocating thread, which shows up as
+ * an allocation latency spike after every scavenge when all threads refresh at once. A low priority helper
+ * thread takes chunks of nursery memory out of the pool that mutators refresh their TLHs from, zeroes them
+ * with streaming stores and keeps them in a cache. Refreshes of zeroed TLHs are served from the cache and
+ * skip the clear. The cache holds at most tlhPrezeroMaximumFreePercent of the free nursery, and is returned to
+ * the heap (as abandoned TLH memory) whenever thread caches are flushed for a collection or a heap walk, or
+ * to the free list when a nursery object allocation fails.
+ * @ingroup GC_Base_Core
+ */
+class MM_TLHPrezeroer : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+public:
+	/**
+	 * Request state of the zeroing thread.
+	 */
+	typedef enum {
+		PREZERO_WAIT = 1, /**< nothing to do, wait for a request */
+		PREZERO_ZERO, /**< zero chunks until the cache is full or the pool is exhausted */
+		PREZERO_SHUTDOWN /**< exit the thread */
+	} PrezeroRequest;
+
+private:
+	MM_GCExtensionsBase *_extensions;
+	MM_LightweightNonReentrantLock _cacheLock; /**< protects the cache and the target pool */
+	MM_HeapLinkedFreeHeaderTLH *_cache; /**< zeroed chunks, shaped like a free list; TLHs are carved off the top of the first chunk */
+	volatile uintptr_t _cachedBytes; /**< bytes in the cache */
+	MM_MemorySubSpace *_targetSubSpace; /**< subspace of the target pool */
+	MM_MemoryPool * volatile _targetPool; /**< nursery pool mutators refresh TLHs from, learned from the first refresh after a flush; NULL until then */
+	uintptr_t _chunkSize; /**< bytes taken from the pool and zeroed at a time */
+	uintptr_t _maximumBytes; /**< the cache is refilled up to this many bytes */
+
+	omrthread_monitor_t _activationMonitor; /**< monitor used to wake up and shut down the zeroing thread */
+	omrthread_t _thread; /**< handle of the zeroing thread */
+	bool _threadStarted; /**< true if the zeroing thread was started and has not exited */
+	volatile PrezeroRequest _request; /**< current request for the zeroing thread */
+
+	/*
+	 * Function members
+	 */
+private:
+	/**
+	 * Ask the zeroing thread to refill the cache, unless it is already at it.
+	 */
+	void wakeUp();
+
+	/**
+	 * Bytes the cache is refilled up to: _maximumBytes, or less when the nursery is nearly full.
+	 * @param memoryPool the target pool
+	 */
+	uintptr_t getReserveLimit(MM_MemoryPool *memoryPool);
+
+	/**
+	 * Take chunks out of the target pool and zero them into the cache until it reaches its reserve limit, the
+	 * pool is exhausted or a thread requests exclusive access. Called by the zeroing thread, which holds VM
+	 * access for one chunk at a time.
+	 */
+	void zeroAhead(MM_EnvironmentBase *env);
+
+	/**
+	 * Zero memory with streaming stores, so that zeroing ahead does not evict the working set of the zeroing
+	 * thread's core. Falls back to OMRZeroMemory where they are not available.
+	 */
+	void zeroNonTemporal(void *base, uintptr_t sizeInBytes);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_TLHPrezeroer *newInstance(MM_EnvironmentBase *env);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Start the zeroing thread.
+	 * @return true if the thread was started
+	 */
+	bool startupThread(MM_GCExtensionsBase *extensions);
+
+	/**
+	 * Ask the zeroing thread to terminate and wait for it to exit.
+	 */
+	void shutdownThread(MM_GCExtensionsBase *extensions);
+
+	/**
+	 * Main loop of the zeroing thread.
+	 * @param omrThread the attached thread
+	 */
+	void threadEntryPoint(OMR_VMThread *omrThread);
+
+	MMINLINE omrthread_monitor_t getActivationMonitor() { return _activationMonitor; }
+
+	/**
+	 * Serve a TLH refresh from zeroed memory.
+	 * The first nursery refresh after a flush selects the pool to zero ahead in and wakes up the zeroing thread.
+	 *
+	 * @param memorySubSpace subspace the TLH is requested from
+	 * @param memoryPool pool the TLH is requested from
+	 * @param maximumSizeInBytesRequired the refresh size of the TLH
+	 * @param[out] addrBase base of the zeroed TLH
+	 * @param[out] addrTop top of the zeroed TLH
+	 * @return true if a zeroed TLH was returned, false if the TLH must be allocated from the pool and cleared
+	 */
+	bool allocateTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, MM_MemorySubSpace *memorySubSpace, MM_MemoryPool *memoryPool,
+			uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop);
+
+	/**
+	 * Give the zeroed chunks back to the free list of their pool, so that an object allocation that failed
+	 * in the nursery can be retried before collecting.
+	 * @note Called with exclusive access.
+	 * @return true if any memory was returned to the free list
+	 */
+	bool releaseReserve(MM_EnvironmentBase *env);
+
+	/**
+	 * Return the zeroed chunks to their pool, and forget the target pool (it may change with the collection).
+	 * @note Called with exclusive access, when the thread caches are flushed. env may be NULL for heap walks.
+	 */
+	void flush(MM_EnvironmentBase *env);
+
+	MM_TLHPrezeroer(MM_EnvironmentBase *env)
+		: MM_BaseVirtual()
+		, _extensions(env->getExtensions())
+		, _cacheLock()
+		, _cache(NULL)
+		, _cachedBytes(0)
+		, _targetSubSpace(NULL)
+		, _targetPool(NULL)
+		, _chunkSize(_extensions->tlhPrezeroChunkSize)
+		, _maximumBytes(_extensions->tlhPrezeroMaximumBytes)
+		, _activationMonitor(NULL)
+		, _thread(NULL)
+		, _threadStarted(false)
+		, _request(PREZERO_WAIT)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) && defined(OMR_GC_BATCH_CLEAR_TLH) */
+
+#endif /* TLHPREZEROER_HPP_ */
@@ -26,12 +26,19 @@
 #include "WorkStack.hpp"
 
 #include "EnvironmentBase.hpp"
+#include "ParallelDispatcher.hpp"
 #include "WorkPackets.hpp"
 #include "Packet.hpp"
 #include "Task.hpp"
 
 #include "ModronAssertions.h"
 
+#if defined(__GNUC__) || defined(__clang__)
+#define WORKSTACK_PREFETCH(address) __builtin_prefetch((const void *)(address), 0, 3)
+#else /* defined(__GNUC__) || defined(__clang__) */
+#define WORKSTACK_PREFETCH(address)
+#endif /* defined(__GNUC__) || defined(__clang__) */
+
 /**
  * Reset stack 
  * 
@@ -71,6 +78,22 @@ MM_WorkStack::prepareForWork(MM_EnvironmentBase *env, MM_WorkPackets *workPacket
 void
 MM_WorkStack::flush(MM_EnvironmentBase *env)
 {
+	if (NULL != _deque) {
+		/* anything left in the deque must be handed back to the shared packets before they are returned */
+		void *element = NULL;
+		while (NULL != (element = _deque->pop())) {
+			pushToOutputPacket(env, element);
+		}
+		_deque = NULL;
+		_dispatcher = NULL;
+		_inputListWaitCount = NULL;
+	}
+	while (0 < _prefetchCount) {
+		/* elements still in the prefetch ring have not been scanned yet */
+		pushToOutputPacket(env, _prefetchRing[_prefetchHead]);
+		_prefetchHead = (_prefetchHead + 1) % _prefetchDepth;
+		_prefetchCount -= 1;
+	}
 	if(NULL != _inputPacket) {
 		_workPackets->putPacket(env, _inputPacket);
 		_inputPacket = NULL;
@@ -86,6 +109,71 @@ MM_WorkStack::flush(MM_EnvironmentBase *env)
 	_workPackets = NULL;
 }
 
+void
+MM_WorkStack::attachWorkStealingDeque(MM_EnvironmentBase *env, MM_ParallelDispatcher *dispatcher)
+{
+	Assert_MM_true(NULL != _workPackets);
+	Assert_MM_true(NULL == _deque);
+
+	_deque = dispatcher->getWorkStealingDeque(env);
+	if (NULL != _deque) {
+		Assert_MM_true(_deque->isEmpty());
+		_dispatcher = dispatcher;
+		_inputListWaitCount = _workPackets->getInputListWaitCountPtr();
+	}
+}
+
+void *
+MM_WorkStack::popPrefetched(MM_EnvironmentBase *env)
+{
+	/* top up the ring with whatever is available without waiting, prefetching each element as it enters */
+	while (_prefetchCount < _prefetchDepth) {
+		void *element = NULL;
+		if ((NULL != _deque) && (NULL != (element = _deque->pop()))) {
+			/* split array pairs never enter the deque, so an element taken from it is never followed by a tag */
+		} else {
+			if ((NULL == _inputPacket) || (NULL == (element = _inputPacket->pop(env)))) {
+				element = popNoWaitFailed(env);
+			}
+			if (NULL == element) {
+				break;
+			}
+			if (((uintptr_t)peek(env)) & PACKET_ARRAY_SPLIT_TAG) {
+				/* the scanner pops the tag of a split array right behind the array (@see popSplitTag()), so it can't wait in the ring */
+				env->_markStats._prefetchRingMisses += 1;
+				return element;
+			}
+		}
+		WORKSTACK_PREFETCH(element);
+		_prefetchRing[(_prefetchHead + _prefetchCount) % _prefetchDepth] = element;
+		_prefetchCount += 1;
+	}
+
+	if (0 == _prefetchCount) {
+		/* nothing in flight: wait for more work (or for all work to complete) */
+		void *result = pop(env);
+		if (NULL != result) {
+			env->_markStats._prefetchRingMisses += 1;
+		}
+		return result;
+	}
+
+	if ((NULL != _deque) && (0 != *_inputListWaitCount) && (_minimumDonationSize <= _deque->getSize())) {
+		donateDequeWork(env);
+	}
+
+	/* only an element which had a full ring of other prefetches issued behind it counts as a hit */
+	if (_prefetchCount == _prefetchDepth) {
+		env->_markStats._prefetchRingHits += 1;
+	} else {
+		env->_markStats._prefetchRingMisses += 1;
+	}
+	void *result = _prefetchRing[_prefetchHead];
+	_prefetchHead = (_prefetchHead + 1) % _prefetchDepth;
+	_prefetchCount -= 1;
+	return result;
+}
+
 /**
  * Push to a deferred packet.
  * 
@@ -177,6 +265,26 @@ MM_WorkStack::peek(MM_EnvironmentBase *env)
 	return NULL;
 }
 
+/**
+ * Pop the tag of a split array from the input packet.
+ *
+ * A split array is pushed together with its tag as a pair, which only ever goes to a packet,
+ * while other elements may have been pushed to the work-stealing deque since the array was
+ * popped. The tag is therefore read from the input packet directly rather than with pop(),
+ * which would drain the deque first.
+ *
+ * @return the tag, or NULL if the top of the input packet is not a split array tag
+ */
+void *
+MM_WorkStack::popSplitTag(MM_EnvironmentBase *env)
+{
+	if ((NULL != _inputPacket) && (((uintptr_t)_inputPacket->peek(env)) & PACKET_ARRAY_SPLIT_TAG)) {
+		return _inputPacket->pop(env);
+	}
+
+	return NULL;
+}
+
 /*
  * Pop a reference from input packet in case if it can be done for current packet (empty or does not exist)
  * 
@@ -211,6 +319,14 @@ MM_WorkStack::popFailed(MM_EnvironmentBase *env)
 		}
 	}
 
+	if (NULL != _dispatcher) {
+		/* Try to take work from another thread's deque before blocking */
+		void *result = _dispatcher->stealWork(env);
+		if (NULL != result) {
+			return result;
+		}
+	}
+
 	/* Nothing is immediately available, wait for an input packet to arrive */
 	_inputPacket = _workPackets->getInputPacket(env);
 	if(NULL != _inputPacket) {
@@ -224,6 +340,18 @@ MM_WorkStack::popFailed(MM_EnvironmentBase *env)
 
 void MM_WorkStack::pushFailed(MM_EnvironmentBase *env, void *element)
 {
+	if (pushToOutputPacket(env, element)) {
+		_pushCount++;
+	}
+}
+
+bool
+MM_WorkStack::pushToOutputPacket(MM_EnvironmentBase *env, void *element)
+{
+	if ((NULL != _outputPacket) && _outputPacket->push(env, element)) {
+		return true;
+	}
+
 	if(_outputPacket) {
 		/* The output packet is full - move it to the input list */
 		_workPackets->putOutputPacket(env, _outputPacket);
@@ -233,11 +361,28 @@ void MM_WorkStack::pushFailed(MM_EnvironmentBase *env, void *element)
 	_outputPacket = _workPackets->getOutputPacket(env);
 	if (NULL == _outputPacket) {
 		_workPackets->overflowItem(env, element, OVERFLOW_TYPE_WORKSTACK);
-	} else {
-		/* Output packets must guarantee at least 2 free entries */
-		_outputPacket->push(env, element);
-		_pushCount++;
+		return false;
+	}
+
+	/* Output packets must guarantee at least 2 free entries */
+	_outputPacket->push(env, element);
+	return true;
+}
+
+void
+MM_WorkStack::donateDequeWork(MM_EnvironmentBase *env)
+{
+	/* Take the oldest entries (closest to the roots, so likely the largest sub-graphs) from our own deque */
+	uintptr_t toDonate = (_deque->getSize() + 1) / 2;
+	void *element = NULL;
+	while ((0 < toDonate) && (NULL != (element = _deque->steal()))) {
+		pushToOutputPacket(env, element);
+		toDonate -= 1;
 	}
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	env->_workPacketStats.workStealingDonations += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+	flushOutputPacket(env);
 }
 
 void MM_WorkStack::pushFailed(MM_EnvironmentBase *env, void *element1, void *element2)
@@ -33,8 +33,10 @@
 
 #include "BaseNonVirtual.hpp"
 #include "Packet.hpp"
+#include "WorkStealingDeque.hpp"
 
 class MM_EnvironmentBase;
+class MM_ParallelDispatcher;
 class MM_WorkPackets;
 
 /**
@@ -45,10 +47,22 @@ class MM_WorkStack : public MM_BaseNonVirtual
 {
 /* data members */
 private:
+	enum {
+		_minimumDonationSize = 8, /**< Smallest deque population worth splitting with waiting threads */
+		_maximumPrefetchDepth = 32 /**< Upper bound on the number of objects held in the prefetch ring */
+	};
+
 	MM_WorkPackets *_workPackets;
 	MM_Packet *_inputPacket;
 	MM_Packet *_outputPacket;
 	MM_Packet *_deferredPacket;
+	MM_WorkStealingDeque *_deque; /**< Thread private work-stealing deque used in front of the output packet (NULL if work stealing is not in use) */
+	MM_ParallelDispatcher *_dispatcher; /**< Dispatcher owning the deques this stack may steal from (NULL if work stealing is not in use) */
+	volatile uintptr_t *_inputListWaitCount; /**< Number of threads waiting for input packets, used to decide when to donate deque work */
+	void *_prefetchRing[_maximumPrefetchDepth]; /**< FIFO of popped elements whose memory has been prefetched but which have not been returned by popPrefetched() yet */
+	uintptr_t _prefetchDepth; /**< Number of ring entries in use (0 if prefetching is disabled) */
+	uintptr_t _prefetchHead; /**< Index of the oldest element in the prefetch ring */
+	uintptr_t _prefetchCount; /**< Number of elements currently held in the prefetch ring */
 	
 	uintptr_t 		_pushCount;
 
@@ -85,6 +99,21 @@ private:
 	 */
 	void *popNoWaitFailed(MM_EnvironmentBase *env);
 
+	/**
+	 * Push an element directly to the output packet, bypassing the work-stealing deque.
+	 * @param env[in] The thread which owns the work stack
+	 * @param element[in] The element to push
+	 * @return true if the element was pushed to a packet, false if it was handed to the overflow handler
+	 */
+	bool pushToOutputPacket(MM_EnvironmentBase *env, void *element);
+
+	/**
+	 * Move the oldest half of the work-stealing deque into a shared output packet so that threads
+	 * waiting for input packets can pick it up.
+	 * @param env[in] The thread which owns the work stack
+	 */
+	void donateDequeWork(MM_EnvironmentBase *env);
+
 public:
 	void reset(MM_EnvironmentBase *env, MM_WorkPackets *workPackets);
 	/**
@@ -95,6 +124,48 @@ public:
 	void prepareForWork(MM_EnvironmentBase *env, MM_WorkPackets *workPackets);
 	void flush(MM_EnvironmentBase *env);
 
+	/**
+	 * Set the depth of the prefetch ring used by popPrefetched().
+	 * @param depth[in] The number of elements to keep in flight (capped at _maximumPrefetchDepth), 0 to disable the ring
+	 */
+	MMINLINE void setPrefetchDepth(uintptr_t depth)
+	{
+		_prefetchDepth = (depth < _maximumPrefetchDepth) ? depth : _maximumPrefetchDepth;
+		_prefetchHead = 0;
+		_prefetchCount = 0;
+	}
+
+	/**
+	 * Pop an element through the prefetch ring.  Elements that are immediately available are moved into
+	 * the ring (and their memory prefetched) as they are popped, and the oldest element of the ring is returned,
+	 * so that by the time an element is returned its cache lines have had a chance to arrive.  If the ring is
+	 * empty the call waits for work like pop().
+	 * The caller must scan each returned element before calling again: an element followed by a
+	 * PACKET_ARRAY_SPLIT_TAG is returned straight away so that its tag remains on top of the input packet,
+	 * from where the caller takes it with popSplitTag().
+	 * @param env[in] The thread which owns the work stack
+	 * @return Object reference or NULL all packets processed (in which case the ring is empty)
+	 */
+	void *popPrefetched(MM_EnvironmentBase *env);
+
+	/**
+	 * Back this work stack with the calling thread's work-stealing deque from the given dispatcher, if the
+	 * dispatcher has deques enabled.  Pushed elements are kept in the deque (where other threads may steal
+	 * them) until it fills, and an empty stack steals from other threads before waiting for input packets.
+	 * The deque is drained back to the work packets and detached by flush().
+	 * @param env[in] The thread which owns the work stack
+	 * @param dispatcher[in] The dispatcher running the current task
+	 */
+	void attachWorkStealingDeque(MM_EnvironmentBase *env, MM_ParallelDispatcher *dispatcher);
+
+	/**
+	 * Return back true if the work stack is backed by a work-stealing deque
+	 */
+	MMINLINE bool workStealingDequeAttached()
+	{
+		return (NULL != _deque);
+	}
+
 	/**
 	 * Immediately flush the output packet back to the shared pool so that it can be processed 
 	 * by another thread.
@@ -104,6 +175,7 @@ public:
 
 	void pushDefer(MM_EnvironmentBase *env, void *element);
 	void *peek(MM_EnvironmentBase *env);
+	void *popSplitTag(MM_EnvironmentBase *env);
 	
 	/* Following 2 functions are intended to allow a caller to count how
 	 * many slots have been pushed to a thread's workstack between 2 points 
@@ -143,7 +215,7 @@ public:
 	 */
 	MMINLINE void push(MM_EnvironmentBase *env, void *element)
 	{
-		if(_outputPacket && (_outputPacket->push(env, element))) {
+		if (((NULL != _deque) && _deque->push(element)) || (_outputPacket && (_outputPacket->push(env, element)))) {
 			_pushCount++;
 		} else {
 			pushFailed(env, element);
@@ -158,6 +230,7 @@ public:
 	 */
 	MMINLINE void push(MM_EnvironmentBase *env, void *element1, void *element2)
 	{
+		/* element pairs must be popped together, so they are never split across the work-stealing deque */
 		if(_outputPacket && (_outputPacket->push(env, element1, element2))) {
 			_pushCount += 2;
 		} else {
@@ -180,7 +253,12 @@ public:
 	{
 		void *result;
 
-		if((NULL != _inputPacket) && (NULL != (result = _inputPacket->pop(env)))) {
+		if ((NULL != _deque) && (NULL != (result = _deque->pop()))) {
+			if ((0 != *_inputListWaitCount) && (_minimumDonationSize <= _deque->getSize())) {
+				donateDequeWork(env);
+			}
+			return result;
+		} else if((NULL != _inputPacket) && (NULL != (result = _inputPacket->pop(env)))) {
 			return result;
 		} else {
 			return popFailed(env);
@@ -202,7 +280,9 @@ public:
 	{
 		void *result;
 
-		if((NULL != _inputPacket) && (NULL != (result = _inputPacket->pop(env)))) {
+		if ((NULL != _deque) && (NULL != (result = _deque->pop()))) {
+			return result;
+		} else if((NULL != _inputPacket) && (NULL != (result = _inputPacket->pop(env)))) {
 			return result;
 		} else {
 			return popNoWaitFailed(env);
@@ -231,7 +311,13 @@ public:
 		_workPackets(NULL),
 		_inputPacket(NULL),
 		_outputPacket(NULL),
-		_deferredPacket(NULL)
+		_deferredPacket(NULL),
+		_deque(NULL),
+		_dispatcher(NULL),
+		_inputListWaitCount(NULL),
+		_prefetchDepth(0),
+		_prefetchHead(0),
+		_prefetchCount(0)
 	{
 		_typeId = __FUNCTION__;
 	};
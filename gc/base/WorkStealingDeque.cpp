@@ -0,0 +1,84 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#include "omrcfg.h"
+
+#include "WorkStealingDeque.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "Forge.hpp"
+
+/**
+ * Allocate and initialize a new instance of the receiver.
+ * @param capacity the minimum number of items the deque must hold (rounded up to a power of two)
+ * @return a new instance of the receiver, or NULL on failure.
+ */
+MM_WorkStealingDeque *
+MM_WorkStealingDeque::newInstance(MM_EnvironmentBase *env, uintptr_t capacity)
+{
+	MM_WorkStealingDeque *deque = (MM_WorkStealingDeque *)env->getForge()->allocate(sizeof(MM_WorkStealingDeque), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != deque) {
+		new(deque) MM_WorkStealingDeque();
+		if (!deque->initialize(env, capacity)) {
+			deque->kill(env);
+			deque = NULL;
+		}
+	}
+	return deque;
+}
+
+/**
+ * Free the receiver and all associated resources.
+ */
+void
+MM_WorkStealingDeque::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_WorkStealingDeque::initialize(MM_EnvironmentBase *env, uintptr_t capacity)
+{
+	_capacity = 1;
+	while (_capacity < capacity) {
+		_capacity <<= 1;
+	}
+	_mask = _capacity - 1;
+
+	_buffer = (void * volatile *)env->getForge()->allocate(_capacity * sizeof(void *), OMR::GC::AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
+	return NULL != _buffer;
+}
+
+void
+MM_WorkStealingDeque::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _buffer) {
+		env->getForge()->free((void *)_buffer);
+		_buffer = NULL;
+	}
+}
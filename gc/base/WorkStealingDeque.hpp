@@ -0,0 +1,183 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(WORKSTEALINGDEQUE_HPP_)
+#define WORKSTEALINGDEQUE_HPP_
+
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#include "AtomicOperations.hpp"
+#include "BaseNonVirtual.hpp"
+
+class MM_EnvironmentBase;
+
+/**
+ * Bounded Chase-Lev work-stealing deque of opaque work items.
+ *
+ * The owning thread pushes and pops at the bottom of the deque without taking any lock, while any
+ * other thread may steal the oldest item from the top with a single compare-and-swap.  Only the
+ * last remaining item is contended between the owner and thieves.  The capacity is fixed at
+ * creation time; a failed push must be handled by the caller (typically by spilling into a shared
+ * work packet).
+ * @ingroup GC_Base
+ */
+class MM_WorkStealingDeque : public MM_BaseNonVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	void * volatile *_buffer; /**< circular buffer of work items, _capacity entries */
+	uintptr_t _capacity; /**< number of entries in _buffer (always a power of two) */
+	uintptr_t _mask; /**< _capacity - 1, used to wrap indices into _buffer */
+	volatile uintptr_t _top; /**< index of the oldest item, advanced by stealing threads (and by the owner for the last item) */
+	volatile uintptr_t _bottom; /**< index of the next free slot, only modified by the owning thread */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	bool initialize(MM_EnvironmentBase *env, uintptr_t capacity);
+	void tearDown(MM_EnvironmentBase *env);
+
+protected:
+public:
+	static MM_WorkStealingDeque *newInstance(MM_EnvironmentBase *env, uintptr_t capacity);
+	void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Push an item onto the bottom of the deque.  May only be called by the owning thread.
+	 * @param element[in] the item to push
+	 * @return true if the item was pushed, false if the deque is full
+	 */
+	MMINLINE bool
+	push(void *element)
+	{
+		uintptr_t bottom = _bottom;
+		/* a stale read of _top can only make the deque appear fuller than it is */
+		if ((bottom - _top) >= _capacity) {
+			return false;
+		}
+		_buffer[bottom & _mask] = element;
+		/* the item must be visible before thieves can observe the new bottom */
+		MM_AtomicOperations::writeBarrier();
+		_bottom = bottom + 1;
+		return true;
+	}
+
+	/**
+	 * Pop the most recently pushed item from the bottom of the deque.  May only be called by the owning thread.
+	 * @return the item, or NULL if the deque is empty (or the last item was lost to a thief)
+	 */
+	MMINLINE void *
+	pop()
+	{
+		uintptr_t bottom = _bottom;
+		if (bottom == _top) {
+			return NULL;
+		}
+
+		bottom -= 1;
+		_bottom = bottom;
+		/* publish the reservation before looking at _top, so that a thief cannot take the same item */
+		MM_AtomicOperations::readWriteBarrier();
+		uintptr_t top = _top;
+
+		void *result = NULL;
+		if ((intptr_t)(bottom - top) > 0) {
+			/* more than one item remaining - no conflict with thieves possible */
+			result = _buffer[bottom & _mask];
+		} else {
+			if (top == bottom) {
+				/* last item - race against thieves for it */
+				result = _buffer[bottom & _mask];
+				if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+					result = NULL;
+				}
+			}
+			/* the deque is now empty; restore the canonical empty state (bottom == top) */
+			_bottom = bottom + 1;
+		}
+		return result;
+	}
+
+	/**
+	 * Steal the oldest item from the top of the deque.  May be called by any thread.
+	 * @return the item, or NULL if the deque was empty or the race for the item was lost
+	 */
+	MMINLINE void *
+	steal()
+	{
+		uintptr_t top = _top;
+		/* _top must be read before _bottom to observe a consistent (possibly stale) range */
+		MM_AtomicOperations::readWriteBarrier();
+		uintptr_t bottom = _bottom;
+
+		void *result = NULL;
+		if ((intptr_t)(bottom - top) > 0) {
+			result = _buffer[top & _mask];
+			if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+				result = NULL;
+			}
+		}
+		return result;
+	}
+
+	/**
+	 * Answer an approximation of the number of items in the deque.  Exact only when called by the owner
+	 * while no thieves are active.
+	 */
+	MMINLINE uintptr_t
+	getSize()
+	{
+		intptr_t size = (intptr_t)(_bottom - _top);
+		return (size > 0) ? (uintptr_t)size : 0;
+	}
+
+	MMINLINE bool isEmpty() { return 0 == getSize(); }
+	MMINLINE uintptr_t getCapacity() { return _capacity; }
+
+	/**
+	 * Create a WorkStealingDeque object.
+	 */
+	MM_WorkStealingDeque() :
+		MM_BaseNonVirtual()
+		,_buffer(NULL)
+		,_capacity(0)
+		,_mask(0)
+		,_top(0)
+		,_bottom(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* WORKSTEALINGDEQUE_HPP_ */
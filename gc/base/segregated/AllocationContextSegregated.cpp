@@ -29,6 +29,7 @@
 #include "AtomicOperations.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
+#include "HeapLinkedFreeHeader.hpp"
 #include "HeapRegionDescriptorSegregated.hpp"
 #include "MemoryPoolAggregatedCellList.hpp"
 #include "ModronAssertions.h"
@@ -62,6 +63,7 @@ bool
 MM_AllocationContextSegregated::initialize(MM_EnvironmentBase *env)
 {
 	memset(&_perContextSmallFullRegions[0], 0, sizeof(_perContextSmallFullRegions));
+	memset(&_magazineDepot[0], 0, sizeof(_magazineDepot));
 
 	if (!MM_AllocationContext::initialize(env)) {
 		return false;
@@ -82,6 +84,9 @@ MM_AllocationContextSegregated::initialize(MM_EnvironmentBase *env)
 		if (NULL == _perContextSmallFullRegions[i]) {
 			return false;
 		}
+		if (!_magazineDepotLock[i].initialize(env, &env->getExtensions()->lnrlOptions, "MM_AllocationContextSegregated:_magazineDepotLock[]")) {
+			return false;
+		}
 	}
 
 	/* the arraylet allocation lock needs to be acquired before arraylet full region queue can be accessed, no concurrent access should be possible */
@@ -111,6 +116,7 @@ MM_AllocationContextSegregated::tearDown(MM_EnvironmentBase *env)
 			_perContextSmallFullRegions[i]->kill(env);
 			_perContextSmallFullRegions[i] = NULL;
 		}
+		_magazineDepotLock[i].tearDown();
 	}
 
 	if (NULL != _perContextArrayletFullRegions) {
@@ -148,6 +154,81 @@ MM_AllocationContextSegregated::flushArraylet(MM_EnvironmentBase *env)
 	_arrayletRegion = NULL;
 }
 
+void
+MM_AllocationContextSegregated::pushMagazines(MM_EnvironmentBase *env, uintptr_t sizeClass, uintptr_t *cells, uintptr_t cellsSize, uintptr_t magazineSize)
+{
+	bool const compressed = env->compressObjectReferences();
+	MM_HeapLinkedFreeHeader *first = NULL;
+	MM_HeapLinkedFreeHeader *last = NULL;
+
+	/* link the magazines up outside of the lock, so the depot is held only to splice them in */
+	while (0 != cellsSize) {
+		uintptr_t size = OMR_MIN(cellsSize, magazineSize);
+		MM_HeapLinkedFreeHeader *magazine = MM_HeapLinkedFreeHeader::getHeapLinkedFreeHeader(cells);
+		magazine->setSize(size);
+		if (NULL == last) {
+			first = magazine;
+		} else {
+			last->setNext(magazine, compressed);
+		}
+		last = magazine;
+		cells = (uintptr_t *)((uintptr_t)cells + size);
+		cellsSize -= size;
+	}
+
+	if (NULL != first) {
+		_magazineDepotLock[sizeClass].acquire();
+		last->setNext(_magazineDepot[sizeClass], compressed);
+		_magazineDepot[sizeClass] = first;
+		_magazineDepotLock[sizeClass].release();
+	}
+}
+
+uintptr_t *
+MM_AllocationContextSegregated::popMagazine(MM_EnvironmentBase *env, uintptr_t sizeClass, uintptr_t *magazineSize)
+{
+	MM_HeapLinkedFreeHeader *magazine = NULL;
+
+	/* racy peek, to keep threads off the lock while the depot is empty */
+	if (NULL != _magazineDepot[sizeClass]) {
+		_magazineDepotLock[sizeClass].acquire();
+		magazine = _magazineDepot[sizeClass];
+		if (NULL != magazine) {
+			_magazineDepot[sizeClass] = magazine->getNext(env->compressObjectReferences());
+		}
+		_magazineDepotLock[sizeClass].release();
+	}
+
+	if (NULL != magazine) {
+		*magazineSize = magazine->getSize();
+	}
+	return (uintptr_t *)magazine;
+}
+
+uintptr_t
+MM_AllocationContextSegregated::getMagazineDepotBytes(MM_EnvironmentBase *env)
+{
+	bool const compressed = env->compressObjectReferences();
+	uintptr_t depotBytes = 0;
+
+	for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+		_magazineDepotLock[sizeClass].acquire();
+		for (MM_HeapLinkedFreeHeader *magazine = _magazineDepot[sizeClass]; NULL != magazine; magazine = magazine->getNext(compressed)) {
+			depotBytes += magazine->getSize();
+		}
+		_magazineDepotLock[sizeClass].release();
+	}
+	return depotBytes;
+}
+
+void
+MM_AllocationContextSegregated::flushMagazineDepot(MM_EnvironmentBase *env, uintptr_t sizeClass)
+{
+	_magazineDepotLock[sizeClass].acquire();
+	_magazineDepot[sizeClass] = NULL;
+	_magazineDepotLock[sizeClass].release();
+}
+
 void
 MM_AllocationContextSegregated::flush(MM_EnvironmentBase *env)
 {
@@ -155,6 +236,7 @@ MM_AllocationContextSegregated::flush(MM_EnvironmentBase *env)
 
 	/* flush the per-context small full regions to sweep regions */
 	for (int32_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+		flushMagazineDepot(env, sizeClass);
 		flushSmall(env, sizeClass);
 		_regionPool->getSmallSweepRegions(sizeClass)->enqueue(_perContextSmallFullRegions[sizeClass]);
 	}
@@ -268,6 +350,22 @@ MM_AllocationContextSegregated::preAllocateSmall(MM_EnvironmentBase *env, uintpt
 	MM_SegregatedAllocationInterface* segregatedAllocationInterface = (MM_SegregatedAllocationInterface*)env->_objectAllocationInterface;
 	uintptr_t replenishSize = segregatedAllocationInterface->getReplenishSize(env, sizeInBytesRequired);
 	uintptr_t preAllocatedBytes = 0;
+	uintptr_t magazineCount = 1;
+
+	if (segregatedAllocationInterface->cachedAllocationsEnabled(env)) {
+		/* Magazine layer: the thread's spare magazine is loaded without any locking, and a full magazine left in the
+		 * depot by another thread's refill costs one short depot lock, so the region is only touched once per batch.
+		 */
+		if (segregatedAllocationInterface->loadSpareMagazine(env, sizeInBytesRequired)) {
+			return (uintptr_t *) segregatedAllocationInterface->allocateFromCache(env, sizeInBytesRequired);
+		}
+		uintptr_t *magazine = popMagazine(env, sizeClass, &preAllocatedBytes);
+		if (NULL != magazine) {
+			segregatedAllocationInterface->loadMagazine(env, sizeInBytesRequired, magazine, preAllocatedBytes);
+			return (uintptr_t *) segregatedAllocationInterface->allocateFromCache(env, sizeInBytesRequired);
+		}
+		magazineCount = OMR_MAX(1, env->getExtensions()->allocationCacheMagazineCount);
+	}
 
 	while (!done) {
 
@@ -275,13 +373,24 @@ MM_AllocationContextSegregated::preAllocateSmall(MM_EnvironmentBase *env, uintpt
 		MM_HeapRegionDescriptorSegregated *region = _smallRegions[sizeClass];
 		if (NULL != region) {
 			MM_MemoryPoolAggregatedCellList *memoryPoolACL = region->getMemoryPoolACL();
-			uintptr_t* cellList = memoryPoolACL->preAllocateCells(env, sizeClasses->getCellSize(sizeClass), replenishSize, &preAllocatedBytes);
+			uintptr_t cellSize = sizeClasses->getCellSize(sizeClass);
+			uintptr_t* cellList = memoryPoolACL->preAllocateCells(env, cellSize, replenishSize * magazineCount, &preAllocatedBytes);
 			if (NULL != cellList) {
 				Assert_MM_true(preAllocatedBytes > 0);
 				if (shouldPreMarkSmallCells(env)) {
 					_markingScheme->preMarkSmallCells(env, region, cellList, preAllocatedBytes);
 				}
-				segregatedAllocationInterface->replenishCache(env, sizeInBytesRequired, cellList, preAllocatedBytes);
+				/* Split the batch: the first magazine replenishes the cache, the next becomes the thread's spare and the rest go to the depot */
+				uintptr_t magazineSize = OMR_MAX(cellSize, (replenishSize / cellSize) * cellSize);
+				uintptr_t cacheSize = OMR_MIN(preAllocatedBytes, magazineSize);
+				uintptr_t *remainder = (uintptr_t *)((uintptr_t)cellList + cacheSize);
+				uintptr_t remainderSize = preAllocatedBytes - cacheSize;
+				if (0 != remainderSize) {
+					uintptr_t spareSize = OMR_MIN(remainderSize, magazineSize);
+					segregatedAllocationInterface->setSpareMagazine(env, sizeInBytesRequired, remainder, spareSize);
+					pushMagazines(env, sizeClass, (uintptr_t *)((uintptr_t)remainder + spareSize), remainderSize - spareSize, magazineSize);
+				}
+				segregatedAllocationInterface->replenishCache(env, sizeInBytesRequired, cellList, cacheSize);
 				result = (uintptr_t *) segregatedAllocationInterface->allocateFromCache(env, sizeInBytesRequired);
 				done = true;
 			}
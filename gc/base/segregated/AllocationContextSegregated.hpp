@@ -32,10 +32,12 @@
 #include "AllocationContext.hpp"
 #include "EnvironmentBase.hpp"
 #include "HeapRegionDescriptorSegregated.hpp"
+#include "LightweightNonReentrantLock.hpp"
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 
 class MM_GlobalAllocationManagerSegregated;
+class MM_HeapLinkedFreeHeader;
 class MM_HeapRegionDescriptorSegregated;
 class MM_HeapRegionQueue;
 class MM_HeapRegionDescriptorSegregated;
@@ -62,6 +64,9 @@ private:
 	MM_HeapRegionQueue *_perContextArrayletFullRegions; /**< Per-context Arraylet regions that have been allocated into during this GC cycle. */
 	MM_HeapRegionQueue *_perContextLargeFullRegions; /**< Per-context Large object regions that have been allocated into during this GC cycle. */
 
+	MM_HeapLinkedFreeHeader *_magazineDepot[OMR_SIZECLASSES_NUM_SMALL+1]; /**< Full magazines (pre-marked runs of cells, linked as free chunks) carved by refills of the threads sharing this context */
+	MM_LightweightNonReentrantLock _magazineDepotLock[OMR_SIZECLASSES_NUM_SMALL+1]; /**< Protects _magazineDepot, held only to push or pop a magazine */
+
 /* Methods */
 public:
 	static MM_AllocationContextSegregated *newInstance(MM_EnvironmentBase *env, MM_GlobalAllocationManagerSegregated *gam, MM_RegionPoolSegregated *regionPool);
@@ -79,6 +84,11 @@ public:
 	 */
 	void returnFullRegionsToRegionPool(MM_EnvironmentBase *env);
 
+	/**
+	 * @return the bytes held in the magazines of the depot, over all size classes
+	 */
+	uintptr_t getMagazineDepotBytes(MM_EnvironmentBase *env);
+
 	/**
 	 * Acquire exclusive access to the allocation context by setting its count field to 1.
 	 * Since another thread may be trying to do this at the same time, it must be done with
@@ -207,6 +217,22 @@ protected:
 	bool tryAllocateFromRegionPool(MM_EnvironmentBase *env, uintptr_t sizeClass);
 
 private:
+	/**
+	 * Push a run of pre-marked cells to the depot, as magazines of at most magazineSize bytes.
+	 */
+	void pushMagazines(MM_EnvironmentBase *env, uintptr_t sizeClass, uintptr_t *cells, uintptr_t cellsSize, uintptr_t magazineSize);
+
+	/**
+	 * Pop a full magazine from the depot.
+	 * @param magazineSize[out] The total size of the cells in the magazine
+	 * @return the first cell of the magazine, or NULL if the depot is empty
+	 */
+	uintptr_t *popMagazine(MM_EnvironmentBase *env, uintptr_t sizeClass, uintptr_t *magazineSize);
+
+	/**
+	 * Drop the magazines left in the depot. They are walkable holes already and are reclaimed by sweep.
+	 */
+	void flushMagazineDepot(MM_EnvironmentBase *env, uintptr_t sizeClass);
 
 };
 
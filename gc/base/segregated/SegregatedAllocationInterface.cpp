@@ -35,6 +35,7 @@
 #include "MemorySubSpace.hpp"
 #include "SizeClasses.hpp"
 #include "ObjectHeapIteratorSegregated.hpp"
+#include "SegregatedAllocationTracker.hpp"
 
 #include "SegregatedAllocationInterface.hpp"
 
@@ -149,6 +150,8 @@ MM_SegregatedAllocationInterface::allocateObject(MM_EnvironmentBase *env, MM_All
 	uintptr_t sizeInBytes = allocateDescription->getBytesRequested();
 	/* Record the memory space from which the allocation takes place in the AD */
 	allocateDescription->setMemorySpace(memorySpace);
+	/* Allocations inlined from the cache by a JIT bypass this count */
+	env->_allocationTracker->recordRequestSize(sizeInBytes);
 	
 	if (shouldCollectOnFailure) {
 		allocateDescription->setObjectFlags(memorySpace->getDefaultMemorySubSpace()->getObjectFlags());
@@ -251,21 +254,31 @@ MM_SegregatedAllocationInterface::allocateArrayletLeaf(MM_EnvironmentBase *env,
 void
 MM_SegregatedAllocationInterface::flushCache(MM_EnvironmentBase *env)
 {
-	bool const compressed = env->compressObjectReferences();
-	/* make the current caches walkable */
+	/* make the current caches and spare magazines walkable */
 	for (uintptr_t sizeClass = 0; sizeClass < OMR_SIZECLASSES_NUM_SMALL+1; sizeClass++) {
-		if (_allocationCache[sizeClass].current < _allocationCache[sizeClass].top) {
-			MM_HeapLinkedFreeHeader *chunk = MM_HeapLinkedFreeHeader::getHeapLinkedFreeHeader(_allocationCache[sizeClass].current);
-			chunk->setSize((uintptr_t)_allocationCache[sizeClass].top - (uintptr_t)_allocationCache[sizeClass].current);
-			/* next pointer value is irrelevant, it just needs to be low bit tagged, to make it non-object */
-			chunk->setNext(NULL, compressed);
-		}
+		makeCacheWalkable(env, &_allocationCache[sizeClass]);
+		makeCacheWalkable(env, &_spareMagazines[sizeClass]);
 	}
 	memset(_allocationCache, 0, sizeof(LanguageSegregatedAllocationCache));
+	memset(_spareMagazines, 0, sizeof(_spareMagazines));
 	env->getExtensions()->allocationStats.merge(&_stats);
 	_stats.clear();
 }
 
+/**
+ * Turn the unallocated remainder of a cache into a hole so the heap can be walked.
+ */
+void
+MM_SegregatedAllocationInterface::makeCacheWalkable(MM_EnvironmentBase *env, LanguageSegregatedAllocationCacheEntryStruct *cache)
+{
+	if (cache->current < cache->top) {
+		MM_HeapLinkedFreeHeader *chunk = MM_HeapLinkedFreeHeader::getHeapLinkedFreeHeader(cache->current);
+		chunk->setSize((uintptr_t)cache->top - (uintptr_t)cache->current);
+		/* next pointer value is irrelevant, it just needs to be low bit tagged, to make it non-object */
+		chunk->setNext(NULL, env->compressObjectReferences());
+	}
+}
+
 /**
  * This will be called periodically (typically every GC cycle) so the cache can adjust its hungriness
  * based on its usage for the current period.
@@ -340,6 +353,61 @@ MM_SegregatedAllocationInterface::replenishCache(MM_EnvironmentBase* env, uintpt
 	}
 }
 
+void
+MM_SegregatedAllocationInterface::setSpareMagazine(MM_EnvironmentBase* env, uintptr_t sizeInBytes, void *magazineMemory, uintptr_t magazineSize)
+{
+	uintptr_t sizeClass = _sizeClasses->getSizeClass(sizeInBytes);
+
+	Assert_MM_true(_spareMagazines[sizeClass].current == _spareMagazines[sizeClass].top);
+	_spareMagazines[sizeClass].current = (uintptr_t *)magazineMemory;
+	_spareMagazines[sizeClass].top = (uintptr_t *)((uintptr_t)magazineMemory + magazineSize);
+}
+
+bool
+MM_SegregatedAllocationInterface::loadSpareMagazine(MM_EnvironmentBase* env, uintptr_t sizeInBytes)
+{
+	uintptr_t sizeClass = _sizeClasses->getSizeClass(sizeInBytes);
+	uintptr_t *magazine = _spareMagazines[sizeClass].current;
+	uintptr_t magazineSize = (uintptr_t)_spareMagazines[sizeClass].top - (uintptr_t)magazine;
+	bool result = false;
+
+	if (0 != magazineSize) {
+		_spareMagazines[sizeClass].current = NULL;
+		_spareMagazines[sizeClass].top = NULL;
+		loadMagazine(env, sizeInBytes, magazine, magazineSize);
+		result = true;
+	}
+	return result;
+}
+
+void
+MM_SegregatedAllocationInterface::loadMagazine(MM_EnvironmentBase* env, uintptr_t sizeInBytes, void *magazineMemory, uintptr_t magazineSize)
+{
+	replenishCache(env, sizeInBytes, magazineMemory, magazineSize);
+	_allocationCacheStats.magazineLoadsTotal[_sizeClasses->getSizeClass(sizeInBytes)] += 1;
+}
+
+uintptr_t
+MM_SegregatedAllocationInterface::getSpareMagazineBytes()
+{
+	uintptr_t spareBytes = 0;
+	for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+		spareBytes += (uintptr_t)_spareMagazines[sizeClass].top - (uintptr_t)_spareMagazines[sizeClass].current;
+	}
+	return spareBytes;
+}
+
+void
+MM_SegregatedAllocationInterface::getReplenishCounts(uint64_t *replenishes, uint64_t *magazineLoads)
+{
+	*replenishes = 0;
+	*magazineLoads = 0;
+	for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+		*replenishes += _allocationCacheStats.replenishesTotal[sizeClass];
+		*magazineLoads += _allocationCacheStats.magazineLoadsTotal[sizeClass];
+	}
+}
+
 uintptr_t
 MM_SegregatedAllocationInterface::getReplenishSize(MM_EnvironmentBase* env, uintptr_t sizeInBytes)
 {
@@ -39,6 +39,7 @@ typedef struct SegregatedAllocationCacheStats {
 	uint64_t replenishesTotal[OMR_SIZECLASSES_NUM_SMALL + 1]; /**< The amount of times the cache has been replenished since the cache has existed (per size class). */
 	uint64_t bytesPreAllocatedSinceRestart[OMR_SIZECLASSES_NUM_SMALL + 1]; /**< The count of cells pre-allocated since the cache was last flushed. */
 	uint64_t replenishesSinceRestart[OMR_SIZECLASSES_NUM_SMALL + 1]; /**< The amount of times the cache has been replenished since the cache was last flushed. */
+	uint64_t magazineLoadsTotal[OMR_SIZECLASSES_NUM_SMALL + 1]; /**< The amount of replenishes served by a spare or depot magazine rather than a region refill (per size class). */
 } SegregatedAllocationCacheStats;
 
 class MM_SegregatedAllocationInterface : public MM_ObjectAllocationInterface 
@@ -58,6 +59,7 @@ private:
 	bool _cachedAllocationsEnabled; /**< Are cached allocations enabled? */
 	
 	uintptr_t *_allocationCacheBases[OMR_SIZECLASSES_NUM_SMALL + 1]; /**< The Base of each current cache (per size class). */
+	LanguageSegregatedAllocationCacheEntryStruct _spareMagazines[OMR_SIZECLASSES_NUM_SMALL + 1]; /**< Cells carved with the last refill, loaded without locking once the current cache runs dry (per size class). */
 
 	/*
 	 * Function members
@@ -90,6 +92,40 @@ public:
 	void* allocateFromCache(MM_EnvironmentBase* env, uintptr_t sizeInBytes);
 	void replenishCache(MM_EnvironmentBase* env, uintptr_t sizeInBytes, void *cacheMemory, uintptr_t cacheSize);
 	uintptr_t getReplenishSize(MM_EnvironmentBase* env, uintptr_t sizeInBytes);
+
+	/**
+	 * Keep cells carved alongside a refill as the spare magazine of their size class. The spare must be empty.
+	 * @param sizeInBytes The size in bytes of a single cell
+	 * @param magazineMemory The first cell of the magazine
+	 * @param magazineSize The total size of allocatable memory contained in magazineMemory
+	 */
+	void setSpareMagazine(MM_EnvironmentBase* env, uintptr_t sizeInBytes, void *magazineMemory, uintptr_t magazineSize);
+
+	/**
+	 * Replenish the (empty) cache of the given size class from its spare magazine, if there is one.
+	 * @return true if the cache was replenished
+	 */
+	bool loadSpareMagazine(MM_EnvironmentBase* env, uintptr_t sizeInBytes);
+
+	/**
+	 * Replenish the (empty) cache of the given size class from a magazine taken off the allocation context depot.
+	 * @param sizeInBytes The size in bytes of a single cell
+	 * @param magazineMemory The first cell of the magazine
+	 * @param magazineSize The total size of allocatable memory contained in magazineMemory
+	 */
+	void loadMagazine(MM_EnvironmentBase* env, uintptr_t sizeInBytes, void *magazineMemory, uintptr_t magazineSize);
+
+	/**
+	 * @return the bytes held in spare magazines, carved but not yet loaded into a cache
+	 */
+	uintptr_t getSpareMagazineBytes();
+
+	/**
+	 * Count the cache replenishes since the cache has existed, over all size classes.
+	 * @param replenishes[out] All replenishes
+	 * @param magazineLoads[out] The replenishes served by a spare or depot magazine, the others took a region refill
+	 */
+	void getReplenishCounts(uint64_t *replenishes, uint64_t *magazineLoads);
 	
 	virtual void enableCachedAllocations(MM_EnvironmentBase *env);
 	virtual void disableCachedAllocations(MM_EnvironmentBase *env);
@@ -106,9 +142,11 @@ protected:
 	{
 		_typeId = __FUNCTION__;
 		memset(_allocationCacheBases, 0, sizeof(_allocationCacheBases));
+		memset(_spareMagazines, 0, sizeof(_spareMagazines));
 	};
 	
 private:
+	void makeCacheWalkable(MM_EnvironmentBase *env, LanguageSegregatedAllocationCacheEntryStruct *cache);
 	void updateFrequentObjectsStats(MM_EnvironmentBase *env, uintptr_t sizeClass);
 	
 };
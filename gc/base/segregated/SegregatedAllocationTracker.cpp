@@ -23,6 +23,8 @@
 #include "omrcomp.h"
 #include "omrport.h"
 
+#include <string.h>
+
 #include "AtomicOperations.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
@@ -60,6 +62,15 @@ MM_SegregatedAllocationTracker::initialize(MM_EnvironmentBase *env, uintptr_t vo
 	_flushThreshold = flushThreshold;
 	_globalBytesInUse = globalBytesInUse;
 	updateAllocationTrackerThreshold(env);
+
+	if (env->getExtensions()->sizeClassProfiling) {
+		uintptr_t histogramSize = sizeof(uint64_t) * OMR_SIZECLASSES_PROFILE_BUCKETS;
+		_requestSizeHistogram = (uint64_t *)env->getForge()->allocate(histogramSize, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == _requestSizeHistogram) {
+			return false;
+		}
+		memset(_requestSizeHistogram, 0, histogramSize);
+	}
 	return true;
 }
 
@@ -71,6 +82,22 @@ MM_SegregatedAllocationTracker::tearDown(MM_EnvironmentBase *env)
 	 */
 	flushBytes();
 	updateAllocationTrackerThreshold(env);
+
+	if (NULL != _requestSizeHistogram) {
+		flushRequestSizes(env);
+		env->getForge()->free(_requestSizeHistogram);
+		_requestSizeHistogram = NULL;
+	}
+}
+
+void
+MM_SegregatedAllocationTracker::flushRequestSizes(MM_EnvironmentBase *env)
+{
+	MM_SizeClasses *sizeClasses = env->getExtensions()->defaultSizeClasses;
+	if ((NULL != _requestSizeHistogram) && (NULL != sizeClasses)) {
+		sizeClasses->mergeRequestSizeHistogram(env, _requestSizeHistogram);
+		memset(_requestSizeHistogram, 0, sizeof(uint64_t) * OMR_SIZECLASSES_PROFILE_BUCKETS);
+	}
 }
 
 void
@@ -25,6 +25,8 @@
 
 #include "omrcomp.h"
 
+#include "SizeClasses.hpp"
+
 #if defined(OMR_GC_SEGREGATED_HEAP)
 
 class MM_EnvironmentBase;
@@ -37,6 +39,7 @@ private:
 	intptr_t _bytesAllocated; /**< A negative amount indicates this tracker has freed more bytes than allocated. */
 	uintptr_t _flushThreshold; /**< If |bytesAllocated| > this threshold, we'll flush the bytes allocated to the pool. */
 	volatile uintptr_t *_globalBytesInUse; /**< The memory pool accumulator to flush bytes to */
+	uint64_t *_requestSizeHistogram; /**< Allocation requests per size class profile bucket, NULL unless size class profiling */
 
 public:
 	static MM_SegregatedAllocationTracker* newInstance(MM_EnvironmentBase *env, volatile uintptr_t *globalBytesInUse, uintptr_t flushThreshold);
@@ -48,6 +51,22 @@ public:
 	void addBytesAllocated(MM_EnvironmentBase* env, uintptr_t bytesAllocated);
 	void addBytesFreed(MM_EnvironmentBase* env, uintptr_t bytesFreed);
 	intptr_t getUnflushedBytesAllocated(MM_EnvironmentBase* env) { return _bytesAllocated; }
+
+	/**
+	 * Count an allocation request in the size class profile, if profiling.
+	 */
+	MMINLINE void
+	recordRequestSize(uintptr_t sizeInBytes)
+	{
+		if (NULL != _requestSizeHistogram) {
+			_requestSizeHistogram[MM_SizeClasses::getProfileBucket(sizeInBytes)] += 1;
+		}
+	}
+
+	/**
+	 * Move the request sizes counted so far into the size class profile; done when the thread exits.
+	 */
+	void flushRequestSizes(MM_EnvironmentBase *env);
 	
 protected:
 	virtual bool initialize(MM_EnvironmentBase *env, uintptr_t volatile *globalBytesInUse, uintptr_t flushThreshold);
@@ -58,6 +77,7 @@ private:
 		_bytesAllocated(0)
 		,_flushThreshold(0)
 		,_globalBytesInUse(NULL)
+		,_requestSizeHistogram(NULL)
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -21,7 +21,14 @@
  *******************************************************************************/
 #include "SizeClasses.hpp"
 
+#include <stdlib.h>
+#include <string.h>
+
+#include "omrport.h"
+
+#include "AtomicOperations.hpp"
 #include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 
@@ -61,7 +68,16 @@ MM_SizeClasses::initialize(MM_EnvironmentBase *env)
 	_smallNumCells = sizeClasses->smallNumCells;
 	_sizeClassIndex = sizeClasses->sizeClassIndex;
 	
-	memcpy(_smallCellSizes, initialCellSizes, sizeof(initialCellSizes));
+	memset((void *)_requestSizeHistogram, 0, sizeof(_requestSizeHistogram));
+
+	const char *table = env->getExtensions()->sizeClassTable;
+	if (NULL == table) {
+		memcpy(_smallCellSizes, initialCellSizes, sizeof(initialCellSizes));
+	} else if (!parseCellSizes(table, _smallCellSizes)) {
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		omrtty_err_printf("Invalid size class table: %s\n", table);
+		return false;
+	}
 	
 	_sizeClassIndex[0] = 0;
 	_smallNumCells[0] = 0;
@@ -79,7 +95,188 @@ MM_SizeClasses::initialize(MM_EnvironmentBase *env)
 void
 MM_SizeClasses::tearDown(MM_EnvironmentBase *envModron)
 {
-	
+	/* all threads, and so all allocation trackers, are gone by the time the configuration releases the size classes */
+	if (envModron->getExtensions()->sizeClassProfiling) {
+		reportProfile(envModron);
+	}
+}
+
+void
+MM_SizeClasses::mergeRequestSizeHistogram(MM_EnvironmentBase *env, uint64_t *histogram)
+{
+	for (uintptr_t bucket = 0; bucket < OMR_SIZECLASSES_PROFILE_BUCKETS; bucket++) {
+		if (0 != histogram[bucket]) {
+			MM_AtomicOperations::addU64(&_requestSizeHistogram[bucket], histogram[bucket]);
+		}
+	}
+}
+
+void
+MM_SizeClasses::getRequestSizeHistogram(uint64_t *histogram)
+{
+	for (uintptr_t bucket = 0; bucket < OMR_SIZECLASSES_PROFILE_BUCKETS; bucket++) {
+		histogram[bucket] = _requestSizeHistogram[bucket];
+	}
+}
+
+bool
+MM_SizeClasses::parseCellSizes(const char *table, uintptr_t *cellSizes)
+{
+	const char *cursor = table;
+
+	cellSizes[0] = 0;
+	for (uintptr_t szClass = OMR_SIZECLASSES_MIN_SMALL; szClass <= OMR_SIZECLASSES_MAX_SMALL; szClass++) {
+		char *end = NULL;
+		uintptr_t cellSize = (uintptr_t)strtoul(cursor, &end, 10);
+		if ((end == cursor)
+			|| (cellSize <= cellSizes[szClass - 1])
+			|| (cellSize < (2 * sizeof(uintptr_t)))
+			|| (0 != (cellSize % OMR_SIZECLASSES_PROFILE_GRANULE))
+		) {
+			return false;
+		}
+		cellSizes[szClass] = cellSize;
+		cursor = end;
+		if (szClass < OMR_SIZECLASSES_MAX_SMALL) {
+			if (',' != *cursor) {
+				return false;
+			}
+			cursor += 1;
+		}
+	}
+
+	/* every small request must have a cell to round up to */
+	return ('\0' == *cursor) && (OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES == cellSizes[OMR_SIZECLASSES_MAX_SMALL]);
+}
+
+void
+MM_SizeClasses::formatCellSizes(MM_EnvironmentBase *env, char *buffer, uintptr_t bufferSize, uintptr_t *cellSizes)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uintptr_t length = 0;
+
+	buffer[0] = '\0';
+	for (uintptr_t szClass = OMR_SIZECLASSES_MIN_SMALL; (szClass <= OMR_SIZECLASSES_MAX_SMALL) && (length < bufferSize); szClass++) {
+		length += omrstr_printf(buffer + length, bufferSize - length, "%s%zu", (OMR_SIZECLASSES_MIN_SMALL == szClass) ? "" : ",", cellSizes[szClass]);
+	}
+}
+
+uint64_t
+MM_SizeClasses::fitCellSizes(MM_EnvironmentBase *env, uint64_t *histogram, uintptr_t *cellSizes)
+{
+	/* Dynamic program over cell sizes in granules: waste[k][j] is the least rounding waste of the requests
+	 * up to j granules served by k ascending cells, the largest being j granules. Cells are at least two
+	 * granules so a free cell always holds a hole header.
+	 */
+	const uintptr_t granules = OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES / OMR_SIZECLASSES_PROFILE_GRANULE;
+	const uintptr_t columns = granules + 1;
+	const uintptr_t rows = OMR_SIZECLASSES_NUM_SMALL + 1;
+	uint64_t *counts = (uint64_t *)env->getForge()->allocate(sizeof(uint64_t) * columns * 2, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	uint64_t *waste = (uint64_t *)env->getForge()->allocate(sizeof(uint64_t) * rows * columns, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	uintptr_t *previous = (uintptr_t *)env->getForge()->allocate(sizeof(uintptr_t) * rows * columns, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	uint64_t result = U_64_MAX;
+
+	if ((NULL != counts) && (NULL != waste) && (NULL != previous)) {
+		/* prefix sums of request counts and of requested granules, so the waste of a cell serving the
+		 * buckets (i, j] is j * (count[j] - count[i]) - (granules[j] - granules[i])
+		 */
+		uint64_t *granuleCounts = counts + columns;
+		/* zero sized requests need no cell and are left out */
+		counts[0] = 0;
+		granuleCounts[0] = 0;
+		for (uintptr_t bucket = 1; bucket <= granules; bucket++) {
+			counts[bucket] = counts[bucket - 1] + histogram[bucket];
+			granuleCounts[bucket] = granuleCounts[bucket - 1] + (histogram[bucket] * bucket);
+		}
+
+		for (uintptr_t i = 0; i < (rows * columns); i++) {
+			waste[i] = U_64_MAX;
+		}
+		for (uintptr_t j = 2; j <= granules; j++) {
+			waste[columns + j] = (j * counts[j]) - granuleCounts[j];
+			previous[columns + j] = 0;
+		}
+		for (uintptr_t k = 2; k < rows; k++) {
+			for (uintptr_t j = k + 1; j <= granules; j++) {
+				for (uintptr_t i = k; i < j; i++) {
+					uint64_t prior = waste[((k - 1) * columns) + i];
+					if (U_64_MAX != prior) {
+						uint64_t candidate = prior + (j * (counts[j] - counts[i])) - (granuleCounts[j] - granuleCounts[i]);
+						if (candidate < waste[(k * columns) + j]) {
+							waste[(k * columns) + j] = candidate;
+							previous[(k * columns) + j] = i;
+						}
+					}
+				}
+			}
+		}
+
+		result = waste[((rows - 1) * columns) + granules] * OMR_SIZECLASSES_PROFILE_GRANULE;
+		cellSizes[0] = 0;
+		uintptr_t j = granules;
+		for (uintptr_t k = rows - 1; k > 0; k--) {
+			cellSizes[k] = j * OMR_SIZECLASSES_PROFILE_GRANULE;
+			j = previous[(k * columns) + j];
+		}
+	}
+
+	if (NULL != counts) {
+		env->getForge()->free(counts);
+	}
+	if (NULL != waste) {
+		env->getForge()->free(waste);
+	}
+	if (NULL != previous) {
+		env->getForge()->free(previous);
+	}
+	return result;
+}
+
+uint64_t
+MM_SizeClasses::getRoundingWaste(uint64_t *histogram, uintptr_t *cellSizes)
+{
+	uint64_t result = 0;
+	uintptr_t szClass = OMR_SIZECLASSES_MIN_SMALL;
+
+	for (uintptr_t bucket = 1; bucket < (OMR_SIZECLASSES_PROFILE_BUCKETS - 1); bucket++) {
+		uintptr_t requestSize = bucket * OMR_SIZECLASSES_PROFILE_GRANULE;
+		while (cellSizes[szClass] < requestSize) {
+			szClass += 1;
+		}
+		result += histogram[bucket] * (cellSizes[szClass] - requestSize);
+	}
+	return result;
+}
+
+void
+MM_SizeClasses::reportProfile(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uint64_t histogram[OMR_SIZECLASSES_PROFILE_BUCKETS];
+	uintptr_t fittedCellSizes[OMR_SIZECLASSES_NUM_SMALL + 1];
+	char table[OMR_SIZECLASSES_TABLE_LENGTH];
+	uint64_t smallRequests = 0;
+	uint64_t requestedBytes = 0;
+
+	getRequestSizeHistogram(histogram);
+	for (uintptr_t bucket = 0; bucket < (OMR_SIZECLASSES_PROFILE_BUCKETS - 1); bucket++) {
+		smallRequests += histogram[bucket];
+		requestedBytes += histogram[bucket] * bucket * OMR_SIZECLASSES_PROFILE_GRANULE;
+	}
+
+	omrtty_printf("Size class profile: %llu small requests, %llu large requests\n", smallRequests, histogram[OMR_SIZECLASSES_PROFILE_BUCKETS - 1]);
+	if (0 != requestedBytes) {
+		uint64_t currentWaste = getRoundingWaste(histogram, _smallCellSizes);
+		uint64_t fittedWaste = fitCellSizes(env, histogram, fittedCellSizes);
+		omrtty_printf("  internal fragmentation: current table %.2f%%", (100.0 * currentWaste) / (double)(requestedBytes + currentWaste));
+		if (U_64_MAX != fittedWaste) {
+			omrtty_printf(", fitted table %.2f%%\n", (100.0 * fittedWaste) / (double)(requestedBytes + fittedWaste));
+			formatCellSizes(env, table, sizeof(table), fittedCellSizes);
+			omrtty_printf("  sizeClassTable=%s\n", table);
+		} else {
+			omrtty_printf("\n");
+		}
+	}
 }
 
 #endif /* OMR_GC_SEGREGATED_HEAP */
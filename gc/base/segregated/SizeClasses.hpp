@@ -31,6 +31,13 @@
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 
+/* Request sizes are profiled in buckets of this many bytes, which is also the alignment of fitted cell sizes */
+#define OMR_SIZECLASSES_PROFILE_GRANULE 8
+/* One bucket per granule up to the largest small size, plus a final bucket counting large requests */
+#define OMR_SIZECLASSES_PROFILE_BUCKETS ((OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES / OMR_SIZECLASSES_PROFILE_GRANULE) + 2)
+/* Room for a table of small cell sizes, as written for the sizeClassTable option, and its terminator */
+#define OMR_SIZECLASSES_TABLE_LENGTH (OMR_SIZECLASSES_NUM_SMALL * 21)
+
 class MM_EnvironmentBase;
 
 class MM_SizeClasses : public MM_BaseVirtual
@@ -42,6 +49,7 @@ private:
 	uintptr_t* _smallCellSizes; /**< Array mapping size classes to the cell size of that size class. The array actually lives in the J9JavaVM. */
 	uintptr_t* _smallNumCells; /**< Array mapping size classes to the number of cells on a region of that size class. The array actually lives in the J9JavaVM. */
 	uintptr_t* _sizeClassIndex; /**< maps size request to size classes. The array actually lives in the OMR vm. */
+	volatile uint64_t _requestSizeHistogram[OMR_SIZECLASSES_PROFILE_BUCKETS]; /**< Request sizes merged from the allocation trackers of exited threads when profiling */
 	
 /* Methods */
 public:
@@ -72,7 +80,66 @@ public:
 		}
 		return _sizeClassIndex[sizeInBytes / sizeof(uintptr_t)];
 	}
-	
+
+	/**
+	 * Map a request size to its profile histogram bucket.
+	 */
+	static MMINLINE uintptr_t getProfileBucket(uintptr_t sizeInBytes)
+	{
+		if (sizeInBytes > OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES) {
+			return OMR_SIZECLASSES_PROFILE_BUCKETS - 1;
+		}
+		return (sizeInBytes + OMR_SIZECLASSES_PROFILE_GRANULE - 1) / OMR_SIZECLASSES_PROFILE_GRANULE;
+	}
+
+	/**
+	 * Add a thread's request size histogram to the profile.
+	 */
+	void mergeRequestSizeHistogram(MM_EnvironmentBase *env, uint64_t *histogram);
+
+	/**
+	 * Copy the request sizes profiled so far.
+	 * @param histogram[out] request counts per profile bucket
+	 */
+	void getRequestSizeHistogram(uint64_t *histogram);
+
+	/**
+	 * Parse a table of small cell sizes, as written by reportProfile().
+	 * The table must list OMR_SIZECLASSES_NUM_SMALL ascending sizes separated by commas, each a multiple of
+	 * OMR_SIZECLASSES_PROFILE_GRANULE and at least two slots in size, the last being OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES.
+	 * @param table the text of the table
+	 * @param cellSizes[out] the cell sizes, indexed by size class
+	 * @return true if the table is valid
+	 */
+	static bool parseCellSizes(const char *table, uintptr_t *cellSizes);
+
+	/**
+	 * Write a table of small cell sizes in the form accepted by parseCellSizes().
+	 * @param buffer[out] the text of the table
+	 * @param bufferSize bytes available in buffer, OMR_SIZECLASSES_TABLE_LENGTH holds any table
+	 * @param cellSizes the cell sizes, indexed by size class
+	 */
+	static void formatCellSizes(MM_EnvironmentBase *env, char *buffer, uintptr_t bufferSize, uintptr_t *cellSizes);
+
+	/**
+	 * Fit the small cell sizes to a request size histogram, minimizing the bytes lost to rounding requests up to their cell.
+	 * @param histogram request counts per profile bucket
+	 * @param cellSizes[out] the fitted cell sizes, indexed by size class
+	 * @return the bytes lost to rounding with the fitted sizes, or U_64_MAX if the fit could not be done
+	 */
+	static uint64_t fitCellSizes(MM_EnvironmentBase *env, uint64_t *histogram, uintptr_t *cellSizes);
+
+	/**
+	 * @return the bytes lost to rounding the requests of a histogram up to the given cell sizes
+	 */
+	static uint64_t getRoundingWaste(uint64_t *histogram, uintptr_t *cellSizes);
+
+	/**
+	 * Report the profiled request sizes: the internal fragmentation of the current table and of a fitted one,
+	 * and the fitted table in the form accepted by the sizeClassTable option.
+	 */
+	void reportProfile(MM_EnvironmentBase *env);
+
 protected:
 	bool initialize(MM_EnvironmentBase *env);
 	virtual void tearDown(MM_EnvironmentBase *env);
@@ -81,7 +148,6 @@ protected:
 		_typeId = __FUNCTION__;
 	};
 	
-private:
 };
 
 #endif /* OMR_GC_SEGREGATED_HEAP */
@@ -442,12 +442,14 @@ MM_CompactScheme::createSubAreaTable(MM_EnvironmentStandard *env, bool singleThr
 
 				_subAreaTable[i].freeChunk = (omrobjectptr_t)p;
 				_subAreaTable[i].memoryPool = memorySubSpace->getMemoryPool(p);
+				_subAreaTable[i].fragmentedBytes = 0;
 				_subAreaTable[i].state = state;
 				_subAreaTable[i++].currentAction = SubAreaEntry::none;
 			}
 			_subAreaTable[i].freeChunk = (omrobjectptr_t)highAddress;
 			_subAreaTable[i].memoryPool = NULL;
 			_subAreaTable[i].firstObject = (omrobjectptr_t)highAddress;
+			_subAreaTable[i].fragmentedBytes = 0;
 			_subAreaTable[i].state = SubAreaEntry::end_segment;
 			_subAreaTable[i++].currentAction = SubAreaEntry::none;
 		}
@@ -464,10 +466,11 @@ void
 MM_CompactScheme::setRealLimitsSubAreas(MM_EnvironmentStandard *env)
 {
 	/* multi threaded pass to find real regions limits - where an object is found */
-	for (uintptr_t i = 1; _subAreaTable[i].state != SubAreaEntry::end_heap; i++) {
-		/* i=1 because first region starts with heapAlloc thus we don't need to find its first object */
+	for (uintptr_t i = 0; _subAreaTable[i].state != SubAreaEntry::end_heap; i++) {
+		/* the first sub area of a region starts with the region base thus we don't need to find its first object */
+		bool firstInRegion = (0 == i) || (SubAreaEntry::end_segment == _subAreaTable[i - 1].state);
 		if ((SubAreaEntry::end_segment == _subAreaTable[i].state)
-		|| (SubAreaEntry::end_segment == _subAreaTable[i - 1].state)
+		|| (firstInRegion && !_incrementalCompaction)
 		) {
 			/* skip the end_segment and its successor */
 			continue;
@@ -479,10 +482,67 @@ MM_CompactScheme::setRealLimitsSubAreas(MM_EnvironmentStandard *env)
 			MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, start, end);
 			omrobjectptr_t objectPtr = markedObjectIterator.nextObject();
 
-			_subAreaTable[i].firstObject = objectPtr;
-			Assert_MM_true(objectPtr == 0 || _markMap->isBitSet(objectPtr));
+			if (!firstInRegion) {
+				_subAreaTable[i].firstObject = objectPtr;
+				Assert_MM_true(objectPtr == 0 || _markMap->isBitSet(objectPtr));
+			}
+
+			if (_incrementalCompaction && (NULL != objectPtr)) {
+				/* Free bytes between the first and the last live object are what compacting this sub area recovers */
+				uintptr_t firstLive = (uintptr_t)objectPtr;
+				uintptr_t lastLiveEnd = firstLive;
+				uintptr_t liveBytes = 0;
+				do {
+					uintptr_t objectSize = _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+					liveBytes += objectSize;
+					lastLiveEnd = (uintptr_t)objectPtr + objectSize;
+				} while (NULL != (objectPtr = markedObjectIterator.nextObject()));
+				_subAreaTable[i].fragmentedBytes = lastLiveEnd - firstLive - liveBytes;
+				env->_compactStats._incrementLiveBytes += liveBytes;
+			}
+		}
+	}
+}
+
+void
+MM_CompactScheme::selectIncrementSubAreas(MM_EnvironmentStandard *env)
+{
+	uintptr_t incrementSubAreas = _extensions->compactIncrementSubAreas;
+	uintptr_t bestStart = 0;
+	uintptr_t bestEnd = 0;
+	uintptr_t bestFragmentedBytes = 0;
+	uintptr_t windowStart = 0;
+	uintptr_t windowFragmentedBytes = 0;
+
+	/* slide a window of adjacent sub areas over each region, never spanning a region end */
+	for (uintptr_t i = 0; _subAreaTable[i].state != SubAreaEntry::end_heap; i++) {
+		if (SubAreaEntry::end_segment == _subAreaTable[i].state) {
+			windowStart = i + 1;
+			windowFragmentedBytes = 0;
+			continue;
+		}
+		windowFragmentedBytes += _subAreaTable[i].fragmentedBytes;
+		if ((i + 1 - windowStart) > incrementSubAreas) {
+			windowFragmentedBytes -= _subAreaTable[windowStart].fragmentedBytes;
+			windowStart += 1;
+		}
+		if (windowFragmentedBytes > bestFragmentedBytes) {
+			bestFragmentedBytes = windowFragmentedBytes;
+			bestStart = windowStart;
+			bestEnd = i + 1;
+		}
+	}
+
+	/* Objects outside the window stay where they are; their references are still fixed up */
+	for (uintptr_t i = 0; _subAreaTable[i].state != SubAreaEntry::end_heap; i++) {
+		if ((SubAreaEntry::init == _subAreaTable[i].state) && ((i < bestStart) || (i >= bestEnd))) {
+			_subAreaTable[i].state = SubAreaEntry::fixup_only;
 		}
 	}
+
+	env->_compactStats._incrementSubAreas = bestEnd - bestStart;
+	env->_compactStats._incrementFragmentedBytes = bestFragmentedBytes;
+	Trc_MM_CompactScheme_selectIncrementSubAreas(env->getLanguageVMThread(), bestEnd - bestStart, _subAreaTable[bestStart].freeChunk, _subAreaTable[bestEnd].freeChunk, bestFragmentedBytes);
 }
 
 /**
@@ -493,6 +553,10 @@ MM_CompactScheme::removeNullSubAreas(MM_EnvironmentStandard *env)
 {
 	/*single threaded pass to eliminate null sub areas */
 	if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
+		if (_incrementalCompaction) {
+			selectIncrementSubAreas(env);
+		}
+
 		_compactFrom = (omrobjectptr_t)_heap->getHeapTop();
 		_compactTo   = (omrobjectptr_t)_heap->getHeapBase();
 		uintptr_t j = 0;
@@ -500,6 +564,7 @@ MM_CompactScheme::removeNullSubAreas(MM_EnvironmentStandard *env)
 			if (NULL != _subAreaTable[i].firstObject) {
 				_subAreaTable[j].firstObject = _subAreaTable[i].firstObject;
 				_subAreaTable[j].memoryPool = _subAreaTable[i].memoryPool;
+				_subAreaTable[j].fragmentedBytes = _subAreaTable[i].fragmentedBytes;
 				_subAreaTable[j].state = _subAreaTable[i].state;
 				if ((j > 0) && (_subAreaTable[j-1].state == SubAreaEntry::init)) {
 					_compactFrom = (_compactFrom < _subAreaTable[j-1].firstObject) ? _compactFrom : _subAreaTable[j-1].firstObject;
@@ -550,6 +615,17 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 	uintptr_t fixupObjectsCount = 0;
 	bool singleThreaded = false;
 
+	/* We force a single sub area compaction if:
+	 *  o the compaction is aggressive. We use a single sub area per segment to avoid potentially having
+	 *    multiple holes created per segment, thereby fragmenting the space. This will result in
+	 *    singlethreaded compaction per segment, and so should only be done in extreme OOM situations.
+	 *  o no worker GC threads, unless compacting incrementally which needs sub areas to choose from
+	 */
+	bool incrementalRequested = (0 != _extensions->compactIncrementSubAreas);
+	if (aggressive || (!incrementalRequested && (1 == env->_currentTask->getThreadCount())) || (_extensions->usingSATBBarrier())) {
+		singleThreaded = true;
+	}
+
 	if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
 		/* Do any necessary initialization */
 		/* TODO: Perhaps the task dispatch should occur internally within so that the initialization doesn't need to be
@@ -563,17 +639,10 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 		/* Reset largestFreeEntry of all subSpaces at beginning of compaction */
 		_extensions->heap->resetLargestFreeEntry();
 
-		env->_currentTask->releaseSynchronizedGCThreads(env);
-	}
+		/* A single sub area per region leaves no window to choose, so only compact incrementally with multiple sub areas */
+		_incrementalCompaction = incrementalRequested && !singleThreaded;
 
-	/* We force a single sub area compaction if:
-	 *  o the compaction is aggressive. We use a single sub area per segment to avoid potentially having
-	 *    multiple holes created per segment, thereby fragmenting the space. This will result in
-	 *    singlethreaded compaction per segment, and so should only be done in extreme OOM situations.
-	 *  o no worker GC threads
-	 */
-	if (aggressive || (1 == env->_currentTask->getThreadCount())  || (_extensions->usingSATBBarrier())) {
-		singleThreaded = true;
+		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
 
 	env->_compactStats._setupStartTime = omrtime_hires_clock();
@@ -713,6 +782,22 @@ void MM_CompactScheme::rebuildFreelist(MM_EnvironmentStandard *env)
 
 				currentFreeBase = NULL;
 				currentFreeSize = 0;
+
+				if (SubAreaEntry::fixup_only == subAreaTable[i].state) {
+					/* Nothing moved in a fixup_only sub area, so its free entries are the gaps between marked objects */
+					omrobjectptr_t end = pageStart(pageIndex(subAreaTable[i + 1].firstObject));
+					MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, (uintptr_t *)subAreaTable[i].firstObject, (uintptr_t *)end);
+					omrobjectptr_t objectPtr = NULL;
+					currentFreeBase = (void *)subAreaTable[i].firstObject;
+					while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+						if ((void *)objectPtr > currentFreeBase) {
+							currentFreeSize = (uintptr_t)objectPtr - (uintptr_t)currentFreeBase;
+							addFreeEntry(env, memorySubSpace, poolState, currentFreeBase, currentFreeSize);
+						}
+						currentFreeBase = (void *)((uintptr_t)objectPtr + _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr));
+					}
+					currentFreeSize = 0;
+				}
 			}
         } while (subAreaTable[i++].state != SubAreaEntry::end_segment);
 
@@ -1386,10 +1471,13 @@ MM_CompactScheme::fixupSubArea(MM_EnvironmentStandard *env, omrobjectptr_t first
 	if (markedOnly) {
 		finish = pageStart(pageIndex(finish));
 		MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, (uintptr_t *)firstObject, (uintptr_t *)finish);
-		omrobjectptr_t objectPtr = NULL;
-		while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
-			objectCount++;
-			fixupObject.fixupObject(env, objectPtr);
+		omrobjectptr_t objects[J9MODRON_HMI_BATCH_SIZE];
+		uintptr_t batchCount = 0;
+		while (0 != (batchCount = markedObjectIterator.nextObjects(objects, J9MODRON_HMI_BATCH_SIZE))) {
+			objectCount += batchCount;
+			for (uintptr_t i = 0; i < batchCount; i++) {
+				fixupObject.fixupObject(env, objects[i]);
+			}
 		}
 	} else {
 		GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, firstObject, finish, false);
@@ -1417,7 +1505,7 @@ MM_CompactScheme::rebuildMarkbits(MM_EnvironmentStandard *env)
 		intptr_t i;
         for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
         	/* We only have to rebuild the markbits for sub areas which contain moved objects */
-        	if (subAreaTable->state != SubAreaEntry::fixup_only) {
+        	if (subAreaTable[i].state != SubAreaEntry::fixup_only) {
 	        	if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::rebuilding_mark_bits)) {
 	        		rebuildMarkbitsInSubArea(env, region, subAreaTable, i);
 				}
@@ -1492,7 +1580,7 @@ MM_CompactScheme::parallelFixHeapForWalk(MM_EnvironmentBase *env)
         	if (subAreaTable[i].state == SubAreaEntry::fixup_only) {
 	        	if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::fixing_heap_for_walk)) {
 	        		omrobjectptr_t start = subAreaTable[i].firstObject;
-					omrobjectptr_t end   = subAreaTable[i].firstObject;
+					omrobjectptr_t end   = subAreaTable[i + 1].firstObject;
 					omrobjectptr_t alignedEnd = pageStart(pageIndex(end));
 
 					GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, start, end, false);
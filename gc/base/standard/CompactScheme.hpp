@@ -90,6 +90,7 @@ private:
 		MM_MemoryPool *memoryPool;
 		omrobjectptr_t firstObject;
 		omrobjectptr_t freeChunk;
+		uintptr_t fragmentedBytes; /**< free bytes below the last live object of the sub area, only measured for incremental compaction */
 		volatile uintptr_t state;
 		volatile uintptr_t currentAction; /**< record the status of the subarea for parallelization */
         
@@ -137,6 +138,7 @@ protected:
 	SubAreaEntry           *_subAreaTable;  /**< Reference to the subAreaTable which is shared data from the SweepHeapSectioning */
 	omrobjectptr_t         _compactFrom;
 	omrobjectptr_t         _compactTo;
+	bool                   _incrementalCompaction; /**< true if the current compaction evacuates only the most fragmented window of sub areas */
 	MM_CompactDelegate     _delegate;
 
 public:
@@ -167,6 +169,14 @@ protected:
 	 * @param env[in] the current thread
 	 */
 	void setRealLimitsSubAreas(MM_EnvironmentStandard *env);
+	/**
+	 * Choose the window of adjacent sub areas with the most fragmented bytes, up to compactIncrementSubAreas
+	 * long, and mark all other sub areas fixup_only. Called single threaded before null sub areas are removed.
+	 * Only the copy work is bounded: objects in fixup_only sub areas are still visited to fix up their references.
+	 *
+	 * @param env[in] the main thread
+	 */
+	void selectIncrementSubAreas(MM_EnvironmentStandard *env);
 	void removeNullSubAreas(MM_EnvironmentStandard *env);
 	void completeSubAreaTable(MM_EnvironmentStandard *env);
 
@@ -335,6 +345,7 @@ public:
 		, _markMap(markingScheme->getMarkMap())
 		, _subAreaTableSize(0)
 		, _subAreaTable(NULL)
+		, _incrementalCompaction(false)
 		, _delegate()
 	{
 		_typeId = __FUNCTION__;
@@ -482,6 +482,12 @@ MM_ConcurrentCardTable::initialize(MM_EnvironmentBase *env, MM_Heap *heap)
 			(*mmPrivateHooks)->J9HookRegisterWithCallSite(mmPrivateHooks, J9HOOK_MM_PRIVATE_CACHE_REFRESHED, tlhRefreshed, OMR_GET_CALLSITE(), (void *)this);
 		}
 	
+		if (_extensions->cardTableSummary) {
+			if (!initializeSummaryTable(env, heap)) {
+				return false;
+			}
+		}
+
 		/* Set default card cleaning masks used by getNextDirtycard */
 		_concurrentCardCleanMask = CONCURRENT_CARD_CLEAN_MASK;
 		_finalCardCleanMask = FINAL_CARD_CLEAN_MASK;
@@ -597,6 +603,7 @@ MM_ConcurrentCardTable::dirtyCardsInRange(MM_EnvironmentBase *env, void *heapBas
 		/* If card not already dirty then dirty it */
 		if (*baseCard != (Card)CARD_DIRTY) {
 			*baseCard = (Card)CARD_DIRTY;
+			dirtySummaryForCard(baseCard);
 		}
 		baseCard += 1;
 	}
@@ -900,6 +907,7 @@ MM_ConcurrentCardTable::cleanCards(MM_EnvironmentBase *env, bool isMutator, uint
 	 * counts will be accurate enough for use currently made of them.
 	 */
  	incConcurrentCleanedCards(cardsCleaned, currentCleaningPhase);
+	_cardTableStats.flushCleanRunHistogram(&env->_cardCleaningStats);
 
 	/* If we ran out of cards to clean ...*/
 	if (NULL == nextDirtyCard) {
@@ -954,6 +962,7 @@ MM_ConcurrentCardTable::cleanSingleCard(MM_EnvironmentBase *env, Card *card, uin
 		if (env->isExclusiveAccessRequestWaiting()) {
 			/* Re-dirty the card as we did not finish cleaning it ... */
 			*card = (Card)CARD_DIRTY;
+			dirtySummaryForCard(card);
 			/* ...and get out now */
 			return false;
 		}
@@ -1000,6 +1009,7 @@ MM_ConcurrentCardTable::cleanSingleCard(MM_EnvironmentBase *env, Card *card, uin
 	 */
 	if (rememberedObjectsFound && (env->getExtensions()->isScavengerRememberedSetInOverflowState())) {
 		*card = (Card)CARD_DIRTY;
+		dirtySummaryForCard(card);
 	}
 
 	return true;
@@ -1025,6 +1035,19 @@ MM_ConcurrentCardTable::initializeFinalCardCleaning(MM_EnvironmentBase *env)
 	_lastCardInPhase = _lastCard;
 }
 
+void
+MM_ConcurrentCardTable::completeFinalCardCleaning(MM_EnvironmentBase *env)
+{
+	if (isSummaryTableEnabled()) {
+		/* The mutators are stopped, so this is the only point at which a summary card can be reset without
+		 * racing a thread dirtying one of its cards. Cards re-dirtied by final cleaning keep their summary.
+		 */
+		for (CleaningRange *range = _cleaningRanges; range < _lastCleaningRange; range++) {
+			clearSummaryForRange(range->baseCard, range->topCard);
+		}
+	}
+}
+
 /**
  * Do final card cleaning.
  *
@@ -1100,6 +1123,7 @@ MM_ConcurrentCardTable::finalCleanCards(MM_EnvironmentBase *env, uintptr_t *byte
 	 * First update number of dirty cards cleaned
 	 */
 	incFinalCleanedCards(cards, phase2);
+	_cardTableStats.flushCleanRunHistogram(&env->_cardCleaningStats);
 
 	/* ..tell caller how many bytes we traced */
 	*bytesTraced = traceCount;
@@ -1627,29 +1651,13 @@ MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask,
 
 		for (currentCard = firstCard; currentCard < lastCardToClean; currentCard++) {
 
-			/* Are we are on an uintptr_t boundary? If so scan the card table a uintptr_t
-	 		 * at a time until we find a slot which is non-zero or the end of card table
-	 		 * found. This is based on the premise that the card table will be mostly
-	 		 * empty and scanning an uintptr_t at a time will reduce the time taken to
-	 		 * scan the card table.
-	 		 */
-			if (((Card)CARD_CLEAN == *currentCard) && (0 == (uintptr_t)currentCard % sizeof(uintptr_t))) {
-				uintptr_t *nextSlot = (uintptr_t *)currentCard;
-				/* Last card may be in middle of a slot so only scan up to an including last
-				 * complete slots worth of cards; then go card at a time
-				 **/
-				uintptr_t *lastSlot = (uintptr_t *)MM_Math::roundToFloor(sizeof(uintptr_t), (uintptr_t)lastCardToClean);
-				while ((nextSlot < lastSlot) && (SLOT_ALL_CLEAN == *nextSlot)) {
-					nextSlot += 1;
-				}
-				/*
-			     * Either end of scan or a slot which contains a dirty card found. Reset scan ptr
-				 */
-				currentCard = (Card *)nextSlot;
-
-				if (currentCard >= lastCardToClean) {
-					break;
-				}
+			/* Skip any run of clean cards. This is based on the premise that the card
+			 * table will be mostly empty, so the run is compared a vector of cards at a time
+			 * (or skipped a summary card at a time).
+			 */
+			currentCard = findUncleanCard(currentCard, lastCardToClean);
+			if (currentCard >= lastCardToClean) {
+				break;
 			}
 
 			/* Have we found a card of interest yet ? */
@@ -1678,7 +1686,8 @@ MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask,
 											  							  (uintptr_t)currentCard)) {
 					break;
 				}
-				
+
+				env->_cardCleaningStats.recordCleanRun((uintptr_t)(nextDirtyCard - firstCard));
 				return nextDirtyCard;
 			}
 		} /* of currentCard < lastCardToClean */
@@ -380,6 +380,13 @@ public:
 	 * Called by STW to do any necessary initialization prior to final card cleaning.
 	 */
 	virtual void initializeFinalCardCleaning(MM_EnvironmentBase *env);
+	/**
+	 * Complete final card cleaning.
+	 *
+	 * Called by STW once final card cleaning has cleaned every card in the cleaning ranges,
+	 * to reset the summary cards of those ranges.
+	 */
+	void completeFinalCardCleaning(MM_EnvironmentBase *env);
 	/**
 	 * Do final card cleaning.
 	 *
@@ -358,28 +358,15 @@ MM_ConcurrentCardTableForWC::prepareCardTableChunk(MM_EnvironmentBase *env, Card
 				endCard = prepareAddress + currentPrepareSize;
 				
 				for (Card *currentCard = firstCard; currentCard < endCard; currentCard++) {
-					/* Are we are on an uintptr_t boundary ?. If so scan the card table a uintptr_t
-					 * at a time until we find a slot which is non-zero or the end of card table
-					 * found. This is based on the premise that the card table will be mostly
-					 * empty and scanning an uintptr_t at a time will reduce the time taken to
-					 * scan the card table.
+					/* Skip any run of clean cards. This is based on the premise that the card
+					 * table will be mostly empty, so the run is compared a vector of cards at a time
+					 * (or skipped a summary card at a time).
 					 */
-					if (((Card)CARD_CLEAN == *currentCard) &&
-						((uintptr_t)currentCard % sizeof(uintptr_t) == 0)) {
-						 uintptr_t *nextSlot= (uintptr_t *)currentCard;
-						while ( ((Card *)nextSlot < endCard) && (*nextSlot == SLOT_ALL_CLEAN) ) {
-							nextSlot++;
-						}
-						
-						/*
-						 * Either end of scan or a slot which contains a dirty card found. Reset scan ptr
-						 */
-						currentCard= (Card *)nextSlot; 
+					currentCard = findUncleanCard(currentCard, endCard);
 
-						/* End of card table reached ? */
-						if (currentCard >= endCard) {
-							break; 
-						}  
+					/* End of card table reached ? */
+					if (currentCard >= endCard) {
+						break;
 					}
 
 					if (MARK_DIRTY_CARD_SAFE == action) {
@@ -45,6 +45,7 @@
 #include "ConcurrentGC.hpp"
 #include "ConcurrentCompleteTracingTask.hpp"
 #include "ConcurrentClearNewMarkBitsTask.hpp"
+#include "ConcurrentMarkTask.hpp"
 #include "ConcurrentSafepointCallback.hpp"
 #include "ConcurrentScanRememberedSetTask.hpp"
 #if defined(OMR_GC_CONCURRENT_SWEEP)
@@ -194,7 +195,8 @@ MM_ConcurrentGC::reportConcurrentKickoff(MM_EnvironmentBase *env)
 		_stats.getKickoffThreshold(),
 		_stats.getRemainingFree(),
 		_stats.getKickoffReason(),
-		_languageKickoffReason
+		_languageKickoffReason,
+		&_stats
 	);
 }
 
@@ -423,6 +425,18 @@ MM_ConcurrentGC::initialize(MM_EnvironmentBase *env)
 		_callback->registerCallback(env, signalThreadsToActivateWriteBarrierAsyncEventHandler, this);
 	}
 
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	if (_extensions->isConcurrentScavengerEnabled()) {
+		/* The concurrent scavenger runs its own concurrent phase on the dispatcher threads */
+		_extensions->concurrentMarkDedicatedThreads = 0;
+	}
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+
+	if (isDedicatedMarkEnabled()) {
+		/* A single concurrent helper drives the dedicated mark threads */
+		_conHelperThreads = 1;
+	}
+
 	if (_conHelperThreads > 0) {
 		/* Get storage for concurrent helper thread table */
 		_conHelpersTable = (omrthread_t *)env->getForge()->allocate(_conHelperThreads * sizeof(omrthread_t), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
@@ -633,7 +647,8 @@ MM_ConcurrentGC::resetConcurrentParameters(MM_EnvironmentBase *env)
 	_stats.reset();
 
 	_initSetupDone = false;
-	_alloc2ConHelperTraceRate = 0;
+	/* Start from the helper tracing predicted by the pacer, so mutators are not taxed for it before the first tuning interval */
+	_alloc2ConHelperTraceRate = _extensions->concurrentPacing ? _pacer.getConHelperTraceRate() : 0;
 	_lastConHelperTraceSizeCount = 0;
 	_lastAverageAlloc2TraceRate = 0;
 	_maxAverageAlloc2TraceRate = 0;
@@ -834,23 +849,29 @@ MM_ConcurrentGC::conHelperEntryPoint(OMR_VMThread *omrThread, uintptr_t workerID
 
 		reportConcurrentBackgroundThreadActivated(env);
 
-		spinLimiter.reset();
-
-		/* perform trace work */
-		while ((CONCURRENT_HELPER_MARK == request)
-				&& _markingScheme->getWorkPackets()->inputPacketAvailable(env)
-				&& spinLimiter.spin()) {
-			sizeTraced = localMark(env, sizeToTrace);
-			if (sizeTraced > 0) {
-				_stats.incConHelperTraceSizeCount(sizeTraced);
-				totalScanned += sizeTraced;
-				spinLimiter.reset();
-			}
+		if (isDedicatedMarkEnabled()) {
+			/* Marking is done by the dedicated threads, this helper being one of them */
+			totalScanned = dispatchDedicatedMark(env);
 			request = getConHelperRequest(env);
-		}
+		} else {
+			spinLimiter.reset();
+
+			/* perform trace work */
+			while ((CONCURRENT_HELPER_MARK == request)
+					&& _markingScheme->getWorkPackets()->inputPacketAvailable(env)
+					&& spinLimiter.spin()) {
+				sizeTraced = localMark(env, sizeToTrace);
+				if (sizeTraced > 0) {
+					_stats.incConHelperTraceSizeCount(sizeTraced);
+					totalScanned += sizeTraced;
+					spinLimiter.reset();
+				}
+				request = getConHelperRequest(env);
+			}
 
-		/* Collector specific Con Helper Work */
-		conHelperDoWorkInternal(env, &request, &spinLimiter, &totalScanned);
+			/* Collector specific Con Helper Work */
+			conHelperDoWorkInternal(env, &request, &spinLimiter, &totalScanned);
+		}
 
 		if (CONCURRENT_HELPER_MARK == request) {
 			request = switchConHelperRequest(CONCURRENT_HELPER_MARK, CONCURRENT_HELPER_WAIT);
@@ -871,6 +892,105 @@ MM_ConcurrentGC::conHelperEntryPoint(OMR_VMThread *omrThread, uintptr_t workerID
 	shutdownAndExitConHelperThread(omrThread);
 }
 
+/**
+ * As many dispatcher threads are used for dedicated concurrent marking as there are CPUs in the budget,
+ * up to concurrentMarkDedicatedThreads.
+ *
+ * @return the number of dedicated concurrent mark threads to dispatch
+ */
+uintptr_t
+MM_ConcurrentGC::dedicatedMarkThreadCount()
+{
+	uintptr_t budgetThreads = (uintptr_t)_dedicatedMarkCPUs;
+	if ((float)budgetThreads < _dedicatedMarkCPUs) {
+		budgetThreads += 1;
+	}
+	uintptr_t threadCount = OMR_MIN(_extensions->concurrentMarkDedicatedThreads, _dispatcher->threadCountMaximum());
+	return OMR_MAX(OMR_MIN(threadCount, budgetThreads), 1);
+}
+
+/**
+ * Run the dedicated concurrent mark threads until they run out of work, a collection is requested
+ * or the concurrent helpers are suspended. Each thread is held to an equal share of the CPU budget.
+ *
+ * @return the number of bytes traced and cleaned
+ */
+uintptr_t
+MM_ConcurrentGC::dispatchDedicatedMark(MM_EnvironmentBase *env)
+{
+	uintptr_t threadCount = dedicatedMarkThreadCount();
+	uintptr_t tracedBefore = _stats.getConHelperTraced();
+
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uint64_t startTime = omrtime_hires_clock();
+
+	_stats.setDedicatedMark(threadCount, _dedicatedMarkCPUs);
+	MM_ConcurrentMarkTask markTask(env, _dispatcher, this, _dedicatedMarkCPUs / (float)threadCount);
+	_dispatcher->run(env, &markTask, threadCount);
+	_stats.incDedicatedMarkElapsedTime(omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS));
+
+	return _stats.getConHelperTraced() - tracedBefore;
+}
+
+/**
+ * Mark, and clean cards once tracing is done, on a dedicated concurrent mark thread.
+ * Any CPU used beyond this thread's share of the budget is slept off between quanta.
+ *
+ * @param threadCPUShare - the share of one CPU this thread may use
+ */
+void
+MM_ConcurrentGC::dedicatedMark(MM_EnvironmentBase *env, float threadCPUShare)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	omrthread_t osThread = env->getOmrVMThread()->_os_thread;
+	int64_t startCPUTime = omrthread_get_self_cpu_time(osThread);
+	uint64_t startTime = omrtime_hires_clock();
+	MM_SpinLimiter spinLimiter(env);
+	ConHelperRequest request = getConHelperRequest(env);
+
+	while (CONCURRENT_HELPER_MARK == request) {
+		uintptr_t sizeTraced = 0;
+		bool workFound = true;
+
+		if (_markingScheme->getWorkPackets()->inputPacketAvailable(env)) {
+			sizeTraced = localMark(env, _tuningUpdateInterval);
+			if (sizeTraced > 0) {
+				_stats.incConHelperTraceSizeCount(sizeTraced);
+			}
+		} else {
+			workFound = dedicatedMarkDoWorkInternal(env, &sizeTraced);
+		}
+
+		if (sizeTraced > 0) {
+			spinLimiter.reset();
+		} else if (!workFound && !spinLimiter.spin()) {
+			break;
+		}
+
+		if ((threadCPUShare < 1.0f) && (0 <= startCPUTime)) {
+			int64_t cpuMicros = (omrthread_get_self_cpu_time(osThread) - startCPUTime) / 1000;
+			int64_t elapsedMicros = (int64_t)omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+			/* Sleep a millisecond at a time so as not to hold up a collection */
+			int64_t excessMicros = (int64_t)(cpuMicros / threadCPUShare) - elapsedMicros;
+			while ((1000 <= excessMicros) && !env->isExclusiveAccessRequestWaiting()) {
+				omrthread_sleep(1);
+				excessMicros -= 1000;
+			}
+		}
+
+		request = getConHelperRequest(env);
+	}
+
+	if (0 <= startCPUTime) {
+		int64_t cpuTime = omrthread_get_self_cpu_time(osThread) - startCPUTime;
+		if (0 < cpuTime) {
+			uint64_t cpuMicros = (uint64_t)cpuTime / 1000;
+			_stats.incDedicatedMarkCPUTime(cpuMicros);
+			MM_AtomicOperations::addU64(&_extensions->concurrentMarkDedicatedCPUTime, cpuMicros);
+		}
+	}
+}
+
 /**
  * Shutdown and exit a concurrent helper
  * Detach a concurrent helper. Notify _conHelpersActivationMonitor if this is
@@ -923,6 +1043,17 @@ MM_ConcurrentGC::initializeConcurrentHelpers(MM_GCExtensionsBase *extensions)
 
 	uint32_t conHelperThreadCount = 0;
 	ConHelperThreadInfo conHelperThreadInfo;
+	uintptr_t conHelperPriority = J9THREAD_PRIORITY_MIN;
+
+	if (isDedicatedMarkEnabled()) {
+		OMRPORT_ACCESS_FROM_OMRVM(extensions->getOmrVM());
+		/* The bound CPU count already honours any cgroup CPU quota */
+		uintptr_t availableCPUs = OMR_MAX(omrsysinfo_get_number_CPUs_by_type(OMRPORT_CPU_BOUND), 1);
+		uintptr_t budget = OMR_MAX(OMR_MIN(_extensions->concurrentMarkCPUBudget, 100), 1);
+		_dedicatedMarkCPUs = (float)(availableCPUs * budget) / 100.0f;
+		/* The helper marks alongside the threads it dispatches, so it runs at their priority and is held to the budget instead */
+		conHelperPriority = J9THREAD_PRIORITY_NORMAL;
+	}
 
 	/* Attach the concurrent helper thread threads */
 	conHelperThreadInfo.omrVM = extensions->getOmrVM();
@@ -935,7 +1066,7 @@ MM_ConcurrentGC::initializeConcurrentHelpers(MM_GCExtensionsBase *extensions)
 		conHelperThreadInfo.threadID = conHelperThreadCount;
 		conHelperThreadInfo.collector = this;
 
-		IDATA threadForkResult = createThreadWithCategory(&(_conHelpersTable[conHelperThreadCount]), OMR_OS_STACK_SIZE, J9THREAD_PRIORITY_MIN,
+		IDATA threadForkResult = createThreadWithCategory(&(_conHelpersTable[conHelperThreadCount]), OMR_OS_STACK_SIZE, conHelperPriority,
 															0, con_helper_thread_proc, (void *)&conHelperThreadInfo, J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
 
 		if (threadForkResult != 0) {
@@ -1172,6 +1303,34 @@ MM_ConcurrentGC::calculateTraceSize(MM_EnvironmentBase *env, MM_AllocateDescript
 	return sizeToTrace;
 }
 
+/**
+ * Record that there is no more concurrent tracing to do in this cycle, for the pacer to learn how
+ * much free space the cycle completed with.
+ */
+void
+MM_ConcurrentGC::recordTracingExhausted(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription)
+{
+	if (_pacer.isCyclePaced()) {
+		_pacer.tracingExhausted(taxableFreeSpace(env, allocDescription));
+	}
+}
+
+/**
+ * Apply the pacing predicted from recent cycles to a kickoff threshold.
+ *
+ * @param kickoffThreshold the kickoff threshold predicted from the trace target and the normal trace rate
+ * @return the kickoff threshold to use for the next cycle
+ */
+uintptr_t
+MM_ConcurrentGC::paceKickoffThreshold(uintptr_t kickoffThreshold)
+{
+	if (_extensions->concurrentPacing) {
+		_stats.setPacing(_pacer.getKickoffScale(), _pacer.getConHelperTraceRate(), _pacer.getAllocationRate(), _pacer.getMarkRate(), kickoffThreshold);
+		kickoffThreshold = _pacer.paceKickoffThreshold(kickoffThreshold);
+	}
+	return kickoffThreshold;
+}
+
 /**
  * Determine if its time to do periodical tuning.
  * Has the free space reduced by the _tuningUpdateInterval from the last time
@@ -1431,6 +1590,7 @@ MM_ConcurrentGC::concurrentMark(MM_EnvironmentBase *env, MM_MemorySubSpace *subs
 
 	/* Sanity check on allocation size and .. */
 	assume0(allocationSize > 0);
+	_pacer.recordAllocation(allocationSize);
 	/* .. we must not mark anything if WB not yet active */
 #if 0	/* TODO 90354: Find a way to reestablish this assertion */
 	Assert_MM_true((_stats.getExecutionMode() < CONCURRENT_ROOT_TRACING1) || (((J9VMThread *)env->getLanguageVMThread())->privateFlags & J9_PRIVATE_FLAGS_CONCURRENT_MARK_ACTIVE));
@@ -1466,8 +1626,9 @@ MM_ConcurrentGC::concurrentMark(MM_EnvironmentBase *env, MM_MemorySubSpace *subs
 
 			case CONCURRENT_TRACE_ONLY:
 			case CONCURRENT_CLEAN_TRACE:
-				sizeToTrace = calculateTraceSize(env, allocDescription);
-				if (sizeToTrace > 0) {
+				/* Mutators pay no tracing tax with dedicated mark threads, but still scan their own stack and switch modes */
+				sizeToTrace = isDedicatedMarkEnabled() ? 0 : calculateTraceSize(env, allocDescription);
+				if ((sizeToTrace > 0) || isDedicatedMarkEnabled()) {
 					sizeTraced = doConcurrentTrace(env, allocDescription, sizeToTrace, subspace, threadAtSafePoint);
 				}
 
@@ -1630,23 +1791,15 @@ MM_ConcurrentGC::forceKickoff(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpa
 }
 
 /**
- * Decide if we have reached the kickoff threshold for concurrent mark.
- *
- * @note This is a potential GC point.
+ * Determine how much "taxable" free space remains to be allocated before the old area is exhausted.
  *
- * @return TRUE if concurrent KO threshold reached; FALSE  otherwise
+ * @return the number of bytes which can be allocated before the old area is exhausted
  */
-bool
-MM_ConcurrentGC::timeToKickoffConcurrent(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription)
+uintptr_t
+MM_ConcurrentGC::taxableFreeSpace(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription)
 {
 	uintptr_t remainingFree = 0;
 
-	/* If -Xgc:noConcurrentMarkKO specified then we never kickoff concurrent mark */
-	if (!_extensions->concurrentKickoffEnabled) {
-		return false;
-	}
-
-	/* Determine how much "taxable" free space remains to be allocated. */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	if(_extensions->scavengerEnabled) {
 		remainingFree = potentialFreeSpace(env, allocDescription);
@@ -1663,6 +1816,27 @@ MM_ConcurrentGC::timeToKickoffConcurrent(MM_EnvironmentBase *env, MM_AllocateDes
 		remainingFree = targetPool->getApproximateFreeMemorySize();
 	}
 
+	return remainingFree;
+}
+
+/**
+ * Decide if we have reached the kickoff threshold for concurrent mark.
+ *
+ * @note This is a potential GC point.
+ *
+ * @return TRUE if concurrent KO threshold reached; FALSE  otherwise
+ */
+bool
+MM_ConcurrentGC::timeToKickoffConcurrent(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription)
+{
+	/* If -Xgc:noConcurrentMarkKO specified then we never kickoff concurrent mark */
+	if (!_extensions->concurrentKickoffEnabled) {
+		return false;
+	}
+
+	/* Determine how much "taxable" free space remains to be allocated. */
+	uintptr_t remainingFree = taxableFreeSpace(env, allocDescription);
+
 	/* If we are already out of storage no point even starting concurrent */
 	if (0 == remainingFree) {
 		return false;
@@ -1676,6 +1850,13 @@ MM_ConcurrentGC::timeToKickoffConcurrent(MM_EnvironmentBase *env, MM_AllocateDes
 
 		if (_stats.switchExecutionMode(CONCURRENT_OFF, CONCURRENT_INIT_RUNNING)) {
 			_stats.setRemainingFree(remainingFree);
+			/* Externally forced cycles say nothing about how well the threshold was paced */
+			if (_extensions->concurrentPacing && !_forcedKickoff) {
+				_pacer.kickoff(env, remainingFree);
+			}
+			if (isDedicatedMarkEnabled()) {
+				_stats.setDedicatedMark(dedicatedMarkThreadCount(), _dedicatedMarkCPUs);
+			}
 			/* Set kickoff reason if it is not set yet */
 			_stats.setKickoffReason(KICKOFF_THRESHOLD_REACHED);
 			if (LANGUAGE_DEFINED_REASON != _stats.getKickoffReason()) {
@@ -2120,6 +2301,17 @@ MM_ConcurrentGC::internalPostCollect(MM_EnvironmentBase *env, MM_MemorySubSpace
 	 /* Reset concurrent work stack overflow flags for next cycle */
 	clearWorkStackOverflow();
 
+	/* Learn the pacing of the cycle before it is re-tuned. Explicit collections abort the cycle,
+	 * so they say nothing about how well it was paced.
+	 */
+	if (CONCURRENT_OFF < _stats.getExecutionModeAtGC()) {
+		if ((NULL == env->_cycleState) || env->_cycleState->_gcCode.isExplicitGC()) {
+			_pacer.cycleDiscarded();
+		} else {
+			_pacer.cycleEnd(env, &_stats, _stats.getExecutionModeAtGC(), _kickoffThresholdBuffer);
+		}
+	}
+
 	/* Re tune for next concurrent cycle if we have had a heap resize or we got far enough
 	 * last time. We only re-tune on a system GC in the event of a heap resize.
 	 */
@@ -34,6 +34,7 @@
 #include "ConcurrentMarkPhaseStats.hpp"
 #include "Collector.hpp"
 #include "CollectorLanguageInterface.hpp"
+#include "ConcurrentGCPacer.hpp"
 #include "ConcurrentGCStats.hpp"
 #include "CycleState.hpp"
 #include "EnvironmentStandard.hpp"
@@ -166,6 +167,7 @@ private:
 	float _alloc2ConHelperTraceRate;
 
 	bool _forcedKickoff;	/**< Kickoff forced externally flag */
+	float _dedicatedMarkCPUs; /**< number of CPUs the dedicated concurrent mark threads may use, from concurrentMarkCPUBudget */
 
 	uintptr_t _languageKickoffReason;
 
@@ -224,6 +226,7 @@ protected:
 	MM_ConcurrentSafepointCallback *_callback;
 	MM_ConcurrentGCStats _stats;
 	MM_ConcurrentMarkPhaseStats _concurrentPhaseStats;
+	MM_ConcurrentGCPacer _pacer; /**< predicts the kickoff threshold and helper tracing from recent cycles, used if concurrentPacing */
 
 	/*
 	 * Function members
@@ -241,12 +244,16 @@ private:
 	void updateTuningStatistics(MM_EnvironmentBase *env);
 
 	void conHelperEntryPoint(OMR_VMThread *omrThread, uintptr_t workerID);
+	uintptr_t dedicatedMarkThreadCount();
+	uintptr_t dispatchDedicatedMark(MM_EnvironmentBase *env);
+	void dedicatedMark(MM_EnvironmentBase *env, float threadCPUShare);
 	void shutdownAndExitConHelperThread(OMR_VMThread *omrThread);
 
 	bool initializeConcurrentHelpers(MM_GCExtensionsBase *extensions);
 	void shutdownConHelperThreads(MM_GCExtensionsBase *extensions);
 	bool timeToKickoffConcurrent(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription);
 
+	uintptr_t taxableFreeSpace(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription);
 	void reportConcurrentKickoff(MM_EnvironmentBase *env);
 	void reportConcurrentAborted(MM_EnvironmentBase *env, CollectionAbortReason reason);
 	void reportConcurrentCollectionEnd(MM_EnvironmentBase *env, uint64_t duration);
@@ -292,8 +299,22 @@ protected:
 	 */
 	ConHelperRequest getConHelperRequest(MM_EnvironmentBase *env);
 	virtual void conHelperDoWorkInternal(MM_EnvironmentBase *env, ConHelperRequest *request, MM_SpinLimiter *spinLimiter, uintptr_t *totalScanned) {};
+
+	/**
+	 * Do one quantum of collector specific work (card cleaning) on a dedicated concurrent mark thread
+	 * when there is nothing left to trace.
+	 *
+	 * @param sizeTraced[out] - the number of bytes traced
+	 * @return true if there was work to do; false otherwise
+	 */
+	virtual bool dedicatedMarkDoWorkInternal(MM_EnvironmentBase *env, uintptr_t *sizeTraced) { return false; };
 	void resumeConHelperThreads(MM_EnvironmentBase *env);
 
+	/**
+	 * @return true if concurrent marking is done by dedicated dispatcher threads rather than taxed mutators
+	 */
+	MMINLINE bool isDedicatedMarkEnabled() { return (0 != _extensions->concurrentMarkDedicatedThreads); };
+
 	virtual uintptr_t doConcurrentTrace(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, uintptr_t sizeToTrace, MM_MemorySubSpace *subspace, bool tlhAllocation) = 0;
 	void concurrentMark(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace,  MM_AllocateDescription *allocDescription);
 
@@ -313,6 +334,8 @@ protected:
 	virtual void updateTuningStatisticsInternal(MM_EnvironmentBase *env) {};
 
 	bool tracingRateDropped(MM_EnvironmentBase *env);
+	void recordTracingExhausted(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription);
+	uintptr_t paceKickoffThreshold(uintptr_t kickoffThreshold);
 	bool periodicalTuningNeeded(MM_EnvironmentBase *env, uintptr_t freeSize);
 	void periodicalTuning(MM_EnvironmentBase *env, uintptr_t freeSize);
 
@@ -491,6 +514,7 @@ public:
 		,_lastConHelperTraceSizeCount(0)
 		,_alloc2ConHelperTraceRate(0)
 		,_forcedKickoff(false)
+		,_dedicatedMarkCPUs(0.0f)
 		,_languageKickoffReason(NO_LANGUAGE_KICKOFF_REASON)
 		,_initRanges(NULL)
 		,_allocToInitRate(0)
@@ -510,6 +534,7 @@ public:
 		,_callback(NULL)
 		,_stats()
 		,_concurrentPhaseStats()
+		,_pacer()
 		{
 			_typeId = __FUNCTION__;
 		}
@@ -521,6 +546,7 @@ public:
 	friend uintptr_t con_helper_thread_proc2(OMRPortLibrary* portLib, void *info);
 	friend class MM_ConcurrentOverflow;
 	friend class MM_ConcurrentCardTableForWC;
+	friend class MM_ConcurrentMarkTask;
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 	friend class MM_ConcurrentSweepScheme;
 #endif /* OMR_GC_CONCURRENT_SWEEP */
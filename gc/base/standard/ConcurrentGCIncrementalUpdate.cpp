@@ -485,6 +485,8 @@ MM_ConcurrentGCIncrementalUpdate::finalConcurrentPrecollect(MM_EnvironmentBase *
 		overflow = (overflowCount != _stats.getConcurrentWorkStackOverflowCount());
 	} while (overflow);
 
+	((MM_ConcurrentCardTable *)_cardTable)->completeFinalCardCleaning(env);
+
 	/* reset overflow flag */
 	_markingScheme->getWorkPackets()->clearOverflowFlag();
 
@@ -618,6 +620,9 @@ MM_ConcurrentGCIncrementalUpdate::tuneToHeap(MM_EnvironmentBase *env)
 	 */
 	uintptr_t kickoffThreshold = (_stats.getInitWorkRequired() / _allocToInitRate) + (_traceTargetPass1 / _allocToTraceRateNormal) + (_traceTargetPass2 / (_allocToTraceRateNormal * _allocToTraceRateCardCleanPass2Boost));
 
+	/* Move the KO point by as much as recent cycles predict is needed to complete marking just before exhaustion */
+	kickoffThreshold = paceKickoffThreshold(kickoffThreshold);
+
 	/* Determine card cleaning thresholds */
 	uintptr_t cardCleaningThreshold = ((uintptr_t)((float)kickoffThreshold / _cardCleaningThresholdFactor));
 
@@ -830,6 +835,10 @@ MM_ConcurrentGCIncrementalUpdate::kickoffCardCleaning(MM_EnvironmentBase *env, C
 	if (_stats.switchExecutionMode(CONCURRENT_TRACE_ONLY, CONCURRENT_CLEAN_TRACE)) {
 		_stats.setCardCleaningReason(reason);
 		_concurrentDelegate.cardCleaningStarted(env);
+		if (isDedicatedMarkEnabled()) {
+			/* No mutator will clean cards, so get the dedicated mark threads going if they are parked */
+			resumeConHelperThreads(env);
+		}
 	}
 }
 
@@ -1051,6 +1060,7 @@ MM_ConcurrentGCIncrementalUpdate::doConcurrentTrace(MM_EnvironmentBase *env, MM_
 				* point before paying allocation tax.
 				*/
 				subspace->setAllocateAtSafePointOnly(env, true);
+				recordTracingExhausted(env, allocDescription);
 			}
 		}
 
@@ -1136,9 +1146,7 @@ MM_ConcurrentGCIncrementalUpdate::localMark(MM_EnvironmentBase *env, uintptr_t s
 	}
 
 	/* Pop the top of the work packet if its a partially processed array tag */
-	if (((uintptr_t)((omrobjectptr_t)env->_workStack.peek(env))) & PACKET_ARRAY_SPLIT_TAG) {
-		env->_workStack.popNoWait(env);
-	}
+	env->_workStack.popSplitTag(env);
 
 	/* STW collection should not occur while localMark is working */
 	Assert_MM_true(gcCount == _extensions->globalGCStats.gcCount);
@@ -1386,6 +1394,29 @@ MM_ConcurrentGCIncrementalUpdate::conHelperDoWorkInternal(MM_EnvironmentBase *en
 	}
 }
 
+bool
+MM_ConcurrentGCIncrementalUpdate::dedicatedMarkDoWorkInternal(MM_EnvironmentBase *env, uintptr_t *sizeTraced)
+{
+	/* Mutators do not trace with dedicated mark threads, so card cleaning is started here once tracing runs dry */
+	if ((CONCURRENT_TRACE_ONLY == _stats.getExecutionMode())
+			&& _stats.isRootTracingComplete()
+			&& _markingScheme->getWorkPackets()->tracingExhausted()) {
+		kickoffCardCleaning(env, TRACING_COMPLETED);
+	}
+
+	if ((CONCURRENT_CLEAN_TRACE != _stats.getExecutionMode())
+			|| !_cardTable->isCardCleaningStarted()
+			|| _cardTable->isCardCleaningComplete()) {
+		return false;
+	}
+
+	if (cleanCards(env, false, _conHelperCleanSize, sizeTraced, false) && (*sizeTraced > 0)) {
+		_stats.incConHelperCardCleanCount(*sizeTraced);
+	}
+
+	return true;
+}
+
 void
 MM_ConcurrentGCIncrementalUpdate::internalPostCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace)
 {
@@ -158,6 +158,7 @@ protected:
 	virtual uintptr_t doConcurrentTrace(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, uintptr_t sizeToTrace, MM_MemorySubSpace *subspace, bool tlhAllocation);
 	virtual uintptr_t localMark(MM_EnvironmentBase *env, uintptr_t sizeToTrace);
 	virtual void conHelperDoWorkInternal(MM_EnvironmentBase *env, ConHelperRequest *request, MM_SpinLimiter *spinLimiter, uintptr_t *totalScanned);
+	virtual bool dedicatedMarkDoWorkInternal(MM_EnvironmentBase *env, uintptr_t *sizeTraced);
 
 	virtual uint32_t numberOfInitRanages(MM_MemorySubSpace *subspace);
 	virtual void determineInitWorkInternal(MM_EnvironmentBase *env, uint32_t initIndex);
@@ -0,0 +1,147 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#include "omrcfg.h"
+#include "omrport.h"
+
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+
+#include "ConcurrentGCPacer.hpp"
+
+#include "ConcurrentGCStats.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Math.hpp"
+
+void
+MM_ConcurrentGCPacer::kickoff(MM_EnvironmentBase *env, uintptr_t remainingFree)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	_kickoffFree = remainingFree;
+	_exhaustedFree = 0;
+	_tracingExhausted = false;
+	_allocatedBytes = 0;
+	_cycleScale = _kickoffScale;
+	/* set last, it enables recordAllocation() */
+	_kickoffTime = omrtime_hires_clock();
+}
+
+void
+MM_ConcurrentGCPacer::tracingExhausted(uintptr_t remainingFree)
+{
+	if ((0 != _kickoffTime) && !_tracingExhausted) {
+		_exhaustedFree = remainingFree;
+		_tracingExhausted = true;
+	}
+}
+
+void
+MM_ConcurrentGCPacer::cycleEnd(MM_EnvironmentBase *env, MM_ConcurrentGCStats *stats, uintptr_t executionModeAtGC, uintptr_t kickoffThresholdBuffer)
+{
+	/* Only cycles kicked off by the threshold with a known amount of free space can be learned from */
+	if ((0 == _kickoffTime) || (0 == _kickoffFree) || ((uintptr_t)-1 == _kickoffFree)) {
+		_kickoffTime = 0;
+		return;
+	}
+
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	uintptr_t markedBytes = stats->getTotalTraced();
+	float ratio = CONCURRENT_PACING_MAX_STEP;
+
+	if (_tracingExhausted) {
+		/* Marking completed; it should have used all of the window except the buffer it was meant to complete with */
+		uintptr_t usedFree = MM_Math::saturatingSubtract(_kickoffFree, _exhaustedFree);
+		ratio = ((float)usedFree + (float)kickoffThresholdBuffer) / (float)_kickoffFree;
+	} else if ((CONCURRENT_TRACE_ONLY <= executionModeAtGC) && (0 < markedBytes) && (0 < _allocatedBytes)) {
+		/* Free space ran out with tracing left for the collection. Assuming the same rates, the window
+		 * had to grow by the part of the work left over.
+		 */
+		uintptr_t leftoverBytes = stats->getCompleteTracingCount() + stats->getFinalTraceCount() + stats->getFinalCardCleanCount();
+		float markedFraction = (float)markedBytes / ((float)markedBytes + (float)leftoverBytes);
+		ratio = (((float)_allocatedBytes / markedFraction) + (float)kickoffThresholdBuffer) / (float)_kickoffFree;
+		ratio = OMR_MAX(ratio, 1.0f);
+	}
+	/* else the cycle was aborted before it got to tracing, so it was kicked off far too late */
+
+	ratio = OMR_MIN(ratio, CONCURRENT_PACING_MAX_STEP);
+	ratio = OMR_MAX(ratio, 1.0f / CONCURRENT_PACING_MAX_STEP);
+
+	CycleHistory *cycle = &_history[_nextHistory];
+	cycle->allocatedBytes = _allocatedBytes;
+	cycle->markedBytes = markedBytes;
+	cycle->conHelperMarkedBytes = stats->getConHelperTraced();
+	cycle->elapsedMillis = omrtime_hires_delta(_kickoffTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MILLISECONDS);
+	cycle->idealScale = _cycleScale * ratio;
+
+	_nextHistory = (_nextHistory + 1) % CONCURRENT_PACING_MAX_HISTORY;
+	if (_historyCount < CONCURRENT_PACING_MAX_HISTORY) {
+		_historyCount += 1;
+	}
+	_kickoffTime = 0;
+
+	uintptr_t historySize = OMR_MAX(extensions->concurrentPacingHistory, 1);
+	predict(OMR_MIN(historySize, CONCURRENT_PACING_MAX_HISTORY));
+}
+
+/**
+ * Predict the pacing of the next cycle from the most recent cycles.
+ * @param historySize the number of cycles to model
+ */
+void
+MM_ConcurrentGCPacer::predict(uintptr_t historySize)
+{
+	uintptr_t cycles = OMR_MIN(historySize, _historyCount);
+	float idealScaleSum = 0.0f;
+	uint64_t allocatedBytes = 0;
+	uint64_t markedBytes = 0;
+	uint64_t conHelperMarkedBytes = 0;
+	uint64_t elapsedMillis = 0;
+
+	uintptr_t index = _nextHistory;
+	for (uintptr_t i = 0; i < cycles; i++) {
+		index = (0 == index) ? (CONCURRENT_PACING_MAX_HISTORY - 1) : (index - 1);
+		CycleHistory *cycle = &_history[index];
+		idealScaleSum += cycle->idealScale;
+		allocatedBytes += cycle->allocatedBytes;
+		markedBytes += cycle->markedBytes;
+		conHelperMarkedBytes += cycle->conHelperMarkedBytes;
+		elapsedMillis += cycle->elapsedMillis;
+	}
+
+	if (0 < cycles) {
+		float kickoffScale = idealScaleSum / (float)cycles;
+		kickoffScale = OMR_MIN(kickoffScale, CONCURRENT_PACING_MAX_SCALE);
+		_kickoffScale = OMR_MAX(kickoffScale, CONCURRENT_PACING_MIN_SCALE);
+	}
+	if (0 < elapsedMillis) {
+		_allocationRate = (uintptr_t)(allocatedBytes / elapsedMillis);
+		_markRate = (uintptr_t)(markedBytes / elapsedMillis);
+	}
+	if (0 < allocatedBytes) {
+		_conHelperTraceRate = (float)conHelperMarkedBytes / (float)allocatedBytes;
+	}
+}
+
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
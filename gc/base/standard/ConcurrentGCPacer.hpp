@@ -0,0 +1,162 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(CONCURRENTGCPACER_HPP_)
+#define CONCURRENTGCPACER_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+
+#include "AtomicOperations.hpp"
+#include "BaseNonVirtual.hpp"
+
+class MM_ConcurrentGCStats;
+class MM_EnvironmentBase;
+
+#define CONCURRENT_PACING_MAX_HISTORY 8 /**< most concurrent cycles the pacer models */
+#define CONCURRENT_PACING_MIN_SCALE ((float)0.5) /**< lowest kickoff scale, relative to the unpaced kickoff threshold */
+#define CONCURRENT_PACING_MAX_SCALE ((float)4.0) /**< highest kickoff scale, relative to the unpaced kickoff threshold */
+#define CONCURRENT_PACING_MAX_STEP ((float)2.0) /**< most one cycle may move its ideal scale away from the scale it ran with */
+
+/**
+ * Predictive pacing of concurrent mark.
+ * Models the mutator allocation rate and the concurrent mark rate over the last few concurrent cycles
+ * and from them derives how far the kickoff threshold has to be moved so that marking completes just
+ * before the taxable free space is exhausted, and how much of the tracing the background helper
+ * threads can be expected to do so that mutators are not taxed for it.
+ * All sizes are in the units of the allocation tax, i.e. taxable free bytes.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ConcurrentGCPacer : public MM_BaseNonVirtual
+{
+private:
+	struct CycleHistory {
+		uintptr_t allocatedBytes; /**< taxable bytes allocated from kickoff to the collection */
+		uintptr_t markedBytes; /**< bytes traced and cleaned concurrently */
+		uintptr_t conHelperMarkedBytes; /**< part of markedBytes traced and cleaned by concurrent helper threads */
+		uint64_t elapsedMillis; /**< time from kickoff to the collection */
+		float idealScale; /**< kickoff scale with which the cycle would have completed just before exhaustion */
+	};
+
+	CycleHistory _history[CONCURRENT_PACING_MAX_HISTORY]; /**< ring of the most recent concurrent cycles */
+	uintptr_t _historyCount; /**< number of valid entries in _history */
+	uintptr_t _nextHistory; /**< index in _history the next cycle is recorded at */
+
+	uint64_t _kickoffTime; /**< time the current cycle was kicked off, 0 if no cycle is being paced */
+	uintptr_t _kickoffFree; /**< taxable free bytes when the current cycle was kicked off */
+	uintptr_t _exhaustedFree; /**< taxable free bytes when tracing was exhausted in the current cycle */
+	bool _tracingExhausted; /**< true if tracing was exhausted in the current cycle */
+	volatile uintptr_t _allocatedBytes; /**< taxable bytes allocated since the current cycle was kicked off */
+	float _cycleScale; /**< kickoff scale the current cycle was kicked off with */
+
+	float _kickoffScale; /**< predicted kickoff scale for the next cycle */
+	float _conHelperTraceRate; /**< predicted bytes marked by concurrent helpers per taxable byte allocated */
+	uintptr_t _allocationRate; /**< predicted taxable bytes allocated per millisecond during concurrent mark */
+	uintptr_t _markRate; /**< predicted bytes marked concurrently per millisecond */
+
+	void predict(uintptr_t historySize);
+
+public:
+	/**
+	 * Record the kickoff of a concurrent cycle.
+	 * @param remainingFree taxable free bytes at kickoff
+	 */
+	void kickoff(MM_EnvironmentBase *env, uintptr_t remainingFree);
+
+	/**
+	 * Record taxable bytes allocated during the current concurrent cycle. Called by every taxed allocation.
+	 */
+	MMINLINE void recordAllocation(uintptr_t bytes)
+	{
+		if (0 != _kickoffTime) {
+			MM_AtomicOperations::add(&_allocatedBytes, bytes);
+		}
+	}
+
+	/**
+	 * Record that there is no more concurrent tracing to do in the current cycle.
+	 * @param remainingFree taxable free bytes left when tracing was exhausted
+	 */
+	void tracingExhausted(uintptr_t remainingFree);
+
+	/**
+	 * Learn from a concurrent cycle which ended in a collection, and predict the pacing of the next one.
+	 * Called single threaded at the end of the collection, before the concurrent statistics are reset.
+	 * @param stats statistics of the concurrent cycle
+	 * @param executionModeAtGC the concurrent execution mode when the collection started
+	 * @param kickoffThresholdBuffer free bytes the cycle was meant to complete with
+	 */
+	void cycleEnd(MM_EnvironmentBase *env, MM_ConcurrentGCStats *stats, uintptr_t executionModeAtGC, uintptr_t kickoffThresholdBuffer);
+
+	/**
+	 * @return true if the current cycle was kicked off by the threshold and is being learned from
+	 */
+	MMINLINE bool isCyclePaced() { return 0 != _kickoffTime; }
+
+	/**
+	 * Forget the current cycle without learning from it, e.g. on an explicit collection.
+	 */
+	MMINLINE void cycleDiscarded() { _kickoffTime = 0; }
+
+	/**
+	 * @param kickoffThreshold kickoff threshold predicted from the trace target and the normal tax rate
+	 * @return the kickoff threshold to use for the next cycle
+	 */
+	MMINLINE uintptr_t paceKickoffThreshold(uintptr_t kickoffThreshold) { return (uintptr_t)((float)kickoffThreshold * _kickoffScale); }
+
+	MMINLINE float getKickoffScale() { return _kickoffScale; }
+	MMINLINE float getConHelperTraceRate() { return _conHelperTraceRate; }
+	MMINLINE uintptr_t getAllocationRate() { return _allocationRate; }
+	MMINLINE uintptr_t getMarkRate() { return _markRate; }
+	MMINLINE uintptr_t getHistoryCount() { return _historyCount; }
+
+	MM_ConcurrentGCPacer()
+		: MM_BaseNonVirtual()
+		, _historyCount(0)
+		, _nextHistory(0)
+		, _kickoffTime(0)
+		, _kickoffFree(0)
+		, _exhaustedFree(0)
+		, _tracingExhausted(false)
+		, _allocatedBytes(0)
+		, _cycleScale(1.0f)
+		, _kickoffScale(1.0f)
+		, _conHelperTraceRate(0.0f)
+		, _allocationRate(0)
+		, _markRate(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+
+#endif /* CONCURRENTGCPACER_HPP_ */
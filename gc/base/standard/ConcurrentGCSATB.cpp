@@ -46,7 +46,9 @@
 #include "OMRVMInterface.hpp"
 #include "ParallelDispatcher.hpp"
 #include "RememberedSetSATB.hpp"
+#include "SpinLimiter.hpp"
 #include "WorkPacketsConcurrent.hpp"
+#include "WorkPacketsSATB.hpp"
 
 /**
  * Create new instance of ConcurrentGCSATB object.
@@ -148,6 +150,9 @@ MM_ConcurrentGCSATB::localMark(MM_EnvironmentBase *env, uintptr_t sizeToTrace)
 	omrobjectptr_t objectPtr = NULL;
 	uintptr_t gcCount = _extensions->globalGCStats.gcCount;
 
+	/* Take all full barrier packets published by mutators since the last look */
+	((MM_WorkPacketsSATB *)_markingScheme->getWorkPackets())->moveFullBarrierPackets(env);
+
 	env->_workStack.reset(env, _markingScheme->getWorkPackets());
 	Assert_MM_true(NULL == env->_cycleState);
 	Assert_MM_true(CONCURRENT_OFF < _stats.getExecutionMode());
@@ -179,9 +184,7 @@ MM_ConcurrentGCSATB::localMark(MM_EnvironmentBase *env, uintptr_t sizeToTrace)
 	}
 
 	/* Pop the top of the work packet if its a partially processed array tag */
-	if (((uintptr_t)((omrobjectptr_t)env->_workStack.peek(env))) & PACKET_ARRAY_SPLIT_TAG) {
-		env->_workStack.popNoWait(env);
-	}
+	env->_workStack.popSplitTag(env);
 
 	/* STW collection should not occur while localMark is working */
 	Assert_MM_true(gcCount == _extensions->globalGCStats.gcCount);
@@ -192,6 +195,47 @@ MM_ConcurrentGCSATB::localMark(MM_EnvironmentBase *env, uintptr_t sizeToTrace)
 	return sizeTraced;
 }
 
+void
+MM_ConcurrentGCSATB::conHelperDoWorkInternal(MM_EnvironmentBase *env, ConHelperRequest *request, MM_SpinLimiter *spinLimiter, uintptr_t *totalScanned)
+{
+	MM_WorkPacketsSATB *packets = (MM_WorkPacketsSATB *)_markingScheme->getWorkPackets();
+
+	spinLimiter->reset();
+
+	/* Barrier packets published after the helper ran out of input are traced here, a batch at a time */
+	while ((CONCURRENT_HELPER_MARK == *request)
+			&& (packets->fullBarrierPacketsAvailable() || packets->inputPacketAvailable(env))
+			&& spinLimiter->spin()) {
+		uintptr_t sizeTraced = localMark(env, _conHelperCleanSize);
+		if (sizeTraced > 0) {
+			_stats.incConHelperTraceSizeCount(sizeTraced);
+			*totalScanned += sizeTraced;
+			spinLimiter->reset();
+		}
+		*request = getConHelperRequest(env);
+	}
+}
+
+bool
+MM_ConcurrentGCSATB::dedicatedMarkDoWorkInternal(MM_EnvironmentBase *env, uintptr_t *sizeTraced)
+{
+	/* Make published barrier packets visible as input; the dedicated loop traces them on its next pass */
+	*sizeTraced = 0;
+	return ((MM_WorkPacketsSATB *)_markingScheme->getWorkPackets())->moveFullBarrierPackets(env);
+}
+
+void
+MM_ConcurrentGCSATB::postConcurrentUpdateStatsAndReport(MM_EnvironmentBase *env, MM_ConcurrentPhaseStatsBase *stats, UDATA bytesConcurrentlyScanned)
+{
+	MM_WorkPacketsSATB *packets = (MM_WorkPacketsSATB *)_markingScheme->getWorkPackets();
+
+	/* Account for any packets still on the barrier stack before reporting */
+	packets->moveFullBarrierPackets(env);
+	_stats.setBarrierPacketStats(packets->getFullBarrierPacketsMoved(), packets->getFullBarrierPacketBatches(), packets->getFullBarrierPacketContention());
+
+	MM_ConcurrentGC::postConcurrentUpdateStatsAndReport(env, stats, bytesConcurrentlyScanned);
+}
+
 /**
  * Tune the concurrent adaptive parameters.
  * Using historical data attempt to predict how much work (tracing)
@@ -267,6 +311,9 @@ MM_ConcurrentGCSATB::tuneToHeap(MM_EnvironmentBase *env)
 	uintptr_t kickoffThreshold = (_stats.getInitWorkRequired() / _allocToInitRate) +
 					   (_bytesToTrace / _allocToTraceRateNormal);
 
+	/* Move the KO point by as much as recent cycles predict is needed to complete marking just before exhaustion */
+	kickoffThreshold = paceKickoffThreshold(kickoffThreshold);
+
 
 	/* We need to ensure that we complete tracing just before we run out of
 	 * storage otherwise we will more than likely get an AF whilst last few allocates
@@ -350,6 +397,7 @@ MM_ConcurrentGCSATB::enableSATB(MM_EnvironmentBase *env) {
 	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
 
 	/* Activate SATB Write Barrier */
+	((MM_WorkPacketsSATB *)_markingScheme->getWorkPackets())->resetFullBarrierPacketCounts();
 	_extensions->sATBBarrierRememberedSet->restoreGlobalFragmentIndex(env);
 
 	TRIGGER_J9HOOK_MM_PRIVATE_CONCURRENT_SATB_TOGGLED(
@@ -455,6 +503,7 @@ MM_ConcurrentGCSATB::doConcurrentTrace(MM_EnvironmentBase *env, MM_AllocateDescr
 		if(_stats.switchExecutionMode(CONCURRENT_TRACE_ONLY, CONCURRENT_EXHAUSTED)) {
 			/* Tell all MSS to use slow path allocate and so get to a safe  point before paying allocation tax. */
 			subspace->setAllocateAtSafePointOnly(env, true);
+			recordTracingExhausted(env, allocDescription);
 		}
 	}
 
@@ -477,6 +526,7 @@ MM_ConcurrentGCSATB::completeConcurrentTracing(MM_EnvironmentBase *env, uintptr_
 	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
 
 	/* Flush barrier packets */
+	((MM_WorkPacketsSATB *)_markingScheme->getWorkPackets())->moveFullBarrierPackets(env);
 	if (((MM_WorkPacketsSATB *)_markingScheme->getWorkPackets())->inUsePacketsAvailable(env)) {
 			((MM_WorkPacketsSATB *)_markingScheme->getWorkPackets())->moveInUseToNonEmpty(env);
 			_extensions->sATBBarrierRememberedSet->flushFragments(env);
@@ -58,6 +58,9 @@ protected:
 
 	virtual uintptr_t doConcurrentTrace(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, uintptr_t sizeToTrace, MM_MemorySubSpace *subspace, bool tlhAllocation);
 	virtual uintptr_t localMark(MM_EnvironmentBase *env, uintptr_t sizeToTrace);
+	virtual void conHelperDoWorkInternal(MM_EnvironmentBase *env, ConHelperRequest *request, MM_SpinLimiter *spinLimiter, uintptr_t *totalScanned);
+	virtual bool dedicatedMarkDoWorkInternal(MM_EnvironmentBase *env, uintptr_t *sizeTraced);
+	virtual void postConcurrentUpdateStatsAndReport(MM_EnvironmentBase *env, MM_ConcurrentPhaseStatsBase *stats = NULL, UDATA bytesConcurrentlyScanned = 0);
 
 	virtual void reportConcurrentCollectionStart(MM_EnvironmentBase *env);
 	virtual void reportConcurrentHalted(MM_EnvironmentBase *env);
@@ -0,0 +1,70 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(CONCURRENTMARKTASK_HPP_)
+#define CONCURRENTMARKTASK_HPP_
+
+#include "omrcfg.h"
+#include "omrmodroncore.h"
+
+#include "ParallelTask.hpp"
+
+class MM_ConcurrentGC;
+class MM_EnvironmentBase;
+class MM_ParallelDispatcher;
+
+/**
+ * Concurrent marking done by dedicated dispatcher threads while mutators run.
+ * Dispatched by the concurrent helper thread; each thread marks and cleans cards until no work is left,
+ * a collection is requested or the concurrent helpers are suspended.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ConcurrentMarkTask : public MM_ParallelTask
+{
+private:
+	MM_ConcurrentGC *_collector;
+	float _threadCPUShare; /**< share of one CPU each thread may use, so all threads together stay within the CPU budget */
+
+public:
+	virtual UDATA getVMStateID() { return OMRVMSTATE_GC_CONCURRENT_MARK_TRACE; };
+
+	virtual void run(MM_EnvironmentBase *env);
+
+	/**
+	 * Create a ConcurrentMarkTask object
+	 */
+	MM_ConcurrentMarkTask(MM_EnvironmentBase *env, MM_ParallelDispatcher *dispatcher, MM_ConcurrentGC *collector, float threadCPUShare) :
+		MM_ParallelTask(env, dispatcher)
+		,_collector(collector)
+		,_threadCPUShare(threadCPUShare)
+	{
+		_typeId = __FUNCTION__;
+	};
+};
+
+#endif /* CONCURRENTMARKTASK_HPP_ */
@@ -0,0 +1,419 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+
+#include "modronopt.h"
+#include "ModronAssertions.h"
+#include "omr.h"
+#include "omrutil.h"
+
+#include <string.h>
+
+#include "AllocateDescription.hpp"
+#include "ConcurrentSweepGC.hpp"
+#include "ConcurrentSweepScheme.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "ParallelDispatcher.hpp"
+
+typedef struct SweepHelperThreadInfo {
+	OMR_VM *omrVM;
+	uintptr_t threadFlags;
+	MM_ConcurrentSweepGC *collector;
+} SweepHelperThreadInfo;
+
+#define SWEEP_HELPER_INFO_FLAG_OK 1
+#define SWEEP_HELPER_INFO_FLAG_FAIL 2
+
+extern "C" {
+
+/**
+ * Background sweep helper thread procedure
+ *
+ * @parm info Address of SweepHelperThreadInfo structure
+ * @return return code; always 0
+ */
+static uintptr_t
+sweep_helper_thread_proc2(OMRPortLibrary* portLib, void *info)
+{
+	SweepHelperThreadInfo *sweepHelperThreadInfo = (SweepHelperThreadInfo *)info;
+	OMR_VM *omrVM = sweepHelperThreadInfo->omrVM;
+	MM_ConcurrentSweepGC *collector = sweepHelperThreadInfo->collector;
+
+	OMR_VMThread *omrThread = MM_EnvironmentBase::attachVMThread(omrVM, "Concurrent Sweep Helper", MM_EnvironmentBase::ATTACH_GC_HELPER_THREAD);
+
+	/* Signal that the helper thread has started (or not); info is not valid beyond this point */
+	omrthread_monitor_t activationMonitor = collector->getSweepHelpersActivationMonitor();
+	omrthread_monitor_enter(activationMonitor);
+	sweepHelperThreadInfo->threadFlags = (NULL != omrThread) ? SWEEP_HELPER_INFO_FLAG_OK : SWEEP_HELPER_INFO_FLAG_FAIL;
+	omrthread_monitor_notify_all(activationMonitor);
+	omrthread_monitor_exit(activationMonitor);
+
+	if (NULL != omrThread) {
+		collector->sweepHelperEntryPoint(omrThread);
+	}
+
+	return 0;
+}
+
+/**
+ * Background sweep helper thread procedure
+ *
+ * @parm info Address of SweepHelperThreadInfo structure
+ */
+static int J9THREAD_PROC
+sweep_helper_thread_proc(void *info)
+{
+	SweepHelperThreadInfo *sweepHelperThreadInfo = (SweepHelperThreadInfo *)info;
+	MM_ParallelDispatcher *dispatcher = MM_GCExtensionsBase::getExtensions(sweepHelperThreadInfo->omrVM)->dispatcher;
+	OMRPORT_ACCESS_FROM_OMRVM(sweepHelperThreadInfo->omrVM);
+
+	uintptr_t rc;
+	omrsig_protect(sweep_helper_thread_proc2, info,
+		dispatcher->getSignalHandler(), dispatcher->getSignalHandlerArg(),
+		OMRPORT_SIG_FLAG_SIGALLSYNC | OMRPORT_SIG_FLAG_MAY_CONTINUE_EXECUTION,
+		&rc);
+
+	return 0;
+}
+
+} /* extern "C" */
+
+MM_ConcurrentSweepGC *
+MM_ConcurrentSweepGC::newInstance(MM_EnvironmentBase *env)
+{
+	MM_ConcurrentSweepGC *globalGC = (MM_ConcurrentSweepGC *)env->getForge()->allocate(sizeof(MM_ConcurrentSweepGC), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != globalGC) {
+		new(globalGC) MM_ConcurrentSweepGC(env);
+		if (!globalGC->initialize(env)) {
+			globalGC->kill(env);
+			globalGC = NULL;
+		}
+	}
+	return globalGC;
+}
+
+void
+MM_ConcurrentSweepGC::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+/**
+ * Initialize the collector and the resources used by the background sweep helpers.
+ * @return true if initialization completed, false otherwise
+ */
+bool
+MM_ConcurrentSweepGC::initialize(MM_EnvironmentBase *env)
+{
+	if (!MM_ParallelGlobalGC::initialize(env)) {
+		return false;
+	}
+
+	if (0 != omrthread_monitor_init_with_name(&_sweepHelpersActivationMonitor, 0, "MM_ConcurrentSweepGC::sweepHelpersActivation")) {
+		return false;
+	}
+
+	if (0 < _sweepHelperThreads) {
+		_sweepHelpersTable = (omrthread_t *)env->getForge()->allocate(_sweepHelperThreads * sizeof(omrthread_t), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == _sweepHelpersTable) {
+			return false;
+		}
+		memset(_sweepHelpersTable, 0, _sweepHelperThreads * sizeof(omrthread_t));
+	}
+
+	return true;
+}
+
+void
+MM_ConcurrentSweepGC::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _sweepHelpersTable) {
+		env->getForge()->free(_sweepHelpersTable);
+		_sweepHelpersTable = NULL;
+	}
+
+	if (NULL != _sweepHelpersActivationMonitor) {
+		omrthread_monitor_destroy(_sweepHelpersActivationMonitor);
+		_sweepHelpersActivationMonitor = NULL;
+	}
+
+	MM_ParallelGlobalGC::tearDown(env);
+}
+
+bool
+MM_ConcurrentSweepGC::collectorStartup(MM_GCExtensionsBase* extensions)
+{
+	bool result = MM_ParallelGlobalGC::collectorStartup(extensions);
+
+	if (result) {
+		result = initializeSweepHelpers(extensions);
+	}
+
+	return result;
+}
+
+void
+MM_ConcurrentSweepGC::collectorShutdown(MM_GCExtensionsBase *extensions)
+{
+	shutdownSweepHelperThreads(extensions);
+	MM_ParallelGlobalGC::collectorShutdown(extensions);
+}
+
+/**
+ * Start the background sweep helper threads.
+ * Helpers run at minimum priority so that they only use cycles not used by the application threads.
+ * @return true if all requested helper threads were started, false otherwise
+ */
+bool
+MM_ConcurrentSweepGC::initializeSweepHelpers(MM_GCExtensionsBase *extensions)
+{
+	if (0 == _sweepHelperThreads) {
+		return true;
+	}
+
+	uintptr_t sweepHelperThreadCount = 0;
+	SweepHelperThreadInfo sweepHelperThreadInfo;
+	sweepHelperThreadInfo.omrVM = extensions->getOmrVM();
+	sweepHelperThreadInfo.collector = this;
+
+	omrthread_monitor_enter(_sweepHelpersActivationMonitor);
+	_sweepHelpersRequest = SWEEP_HELPER_WAIT;
+
+	for (sweepHelperThreadCount = 0; sweepHelperThreadCount < _sweepHelperThreads; sweepHelperThreadCount++) {
+		sweepHelperThreadInfo.threadFlags = 0;
+
+		IDATA threadForkResult = createThreadWithCategory(&(_sweepHelpersTable[sweepHelperThreadCount]), OMR_OS_STACK_SIZE, J9THREAD_PRIORITY_MIN,
+															0, sweep_helper_thread_proc, (void *)&sweepHelperThreadInfo, J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+		if (0 != threadForkResult) {
+			break;
+		}
+
+		do {
+			omrthread_monitor_wait(_sweepHelpersActivationMonitor);
+		} while (0 == sweepHelperThreadInfo.threadFlags);
+
+		if (SWEEP_HELPER_INFO_FLAG_OK != sweepHelperThreadInfo.threadFlags) {
+			break;
+		}
+	}
+	omrthread_monitor_exit(_sweepHelpersActivationMonitor);
+	_sweepHelpersStarted = sweepHelperThreadCount;
+
+	return (_sweepHelpersStarted == _sweepHelperThreads);
+}
+
+/**
+ * Ask all background sweep helper threads to terminate and wait for them to exit.
+ */
+void
+MM_ConcurrentSweepGC::shutdownSweepHelperThreads(MM_GCExtensionsBase *extensions)
+{
+	if (0 < _sweepHelpersStarted) {
+		omrthread_monitor_enter(_sweepHelpersActivationMonitor);
+		_sweepHelpersRequest = SWEEP_HELPER_SHUTDOWN;
+		_sweepHelpersShutdownCount = 0;
+		omrthread_monitor_notify_all(_sweepHelpersActivationMonitor);
+
+		while (_sweepHelpersShutdownCount < _sweepHelpersStarted) {
+			omrthread_monitor_wait(_sweepHelpersActivationMonitor);
+		}
+		omrthread_monitor_exit(_sweepHelpersActivationMonitor);
+		_sweepHelpersStarted = 0;
+	}
+}
+
+/**
+ * Wake up the background sweep helper threads to finish the sweep phase of the
+ * lazy sweep left behind by the collection that just completed.
+ */
+void
+MM_ConcurrentSweepGC::resumeSweepHelperThreads(MM_EnvironmentBase *env)
+{
+	if (0 < _sweepHelpersStarted) {
+		omrthread_monitor_enter(_sweepHelpersActivationMonitor);
+		if (SWEEP_HELPER_WAIT == _sweepHelpersRequest) {
+			_sweepHelpersRequest = SWEEP_HELPER_SWEEP;
+			omrthread_monitor_notify_all(_sweepHelpersActivationMonitor);
+		}
+		omrthread_monitor_exit(_sweepHelpersActivationMonitor);
+	}
+}
+
+/**
+ * Fetch the current request for the background sweep helper threads. A pending sweep request is
+ * withdrawn once exclusive access is requested, so that the helpers release VM access; the
+ * collection resumes them when it completes.
+ */
+MM_ConcurrentSweepGC::SweepHelperRequest
+MM_ConcurrentSweepGC::getSweepHelperRequest(MM_EnvironmentBase *env)
+{
+	SweepHelperRequest result;
+
+	omrthread_monitor_enter(_sweepHelpersActivationMonitor);
+	if (env->isExclusiveAccessRequestWaiting()) {
+		if (SWEEP_HELPER_SWEEP == _sweepHelpersRequest) {
+			_sweepHelpersRequest = SWEEP_HELPER_WAIT;
+		}
+	}
+	result = _sweepHelpersRequest;
+	omrthread_monitor_exit(_sweepHelpersActivationMonitor);
+
+	return result;
+}
+
+void
+MM_ConcurrentSweepGC::sweepHelperEntryPoint(OMR_VMThread *omrThread)
+{
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrThread);
+	SweepHelperRequest request = SWEEP_HELPER_WAIT;
+
+	/* Thread not a mutator so identify its type */
+	env->initializeGCThread();
+	env->setThreadType(CON_SWEEP_HELPER_THREAD);
+
+	while (SWEEP_HELPER_SHUTDOWN != request) {
+		omrthread_monitor_enter(_sweepHelpersActivationMonitor);
+		while (SWEEP_HELPER_WAIT == (request = _sweepHelpersRequest)) {
+			omrthread_monitor_wait(_sweepHelpersActivationMonitor);
+		}
+		omrthread_monitor_exit(_sweepHelpersActivationMonitor);
+
+		if (SWEEP_HELPER_SWEEP == request) {
+			env->acquireVMAccess();
+
+			/* Sweep one chunk at a time so that VM access is given up soon after exclusive access is requested */
+			MM_ConcurrentSweepScheme *concurrentSweep = getConcurrentSweepScheme();
+			while ((SWEEP_HELPER_SWEEP == (request = getSweepHelperRequest(env))) && concurrentSweep->sweepNextChunkConcurrently(env)) {
+				/* keep sweeping */
+			}
+
+			if (SWEEP_HELPER_SWEEP == request) {
+				/* No chunk is left: record that the sweep phase completed concurrently */
+				concurrentSweep->completeSweepingConcurrently(env);
+
+				/* Retire the request while still holding VM access so that a request posted by the
+				 * next collection can not be lost.
+				 */
+				omrthread_monitor_enter(_sweepHelpersActivationMonitor);
+				if (SWEEP_HELPER_SWEEP == _sweepHelpersRequest) {
+					_sweepHelpersRequest = SWEEP_HELPER_WAIT;
+				}
+				request = _sweepHelpersRequest;
+				omrthread_monitor_exit(_sweepHelpersActivationMonitor);
+			}
+			env->releaseVMAccess();
+		}
+	}
+
+	MM_EnvironmentBase::detachVMThread(_extensions->getOmrVM(), omrThread, MM_EnvironmentBase::ATTACH_GC_HELPER_THREAD);
+
+	omrthread_monitor_enter(_sweepHelpersActivationMonitor);
+	_sweepHelpersShutdownCount += 1;
+	if (_sweepHelpersShutdownCount == _sweepHelpersStarted) {
+		omrthread_monitor_notify_all(_sweepHelpersActivationMonitor);
+	}
+	for (uintptr_t i = 0; i < _sweepHelpersStarted; i++) {
+		if (_sweepHelpersTable[i] == omrthread_self()) {
+			_sweepHelpersTable[i] = 0;
+			break;
+		}
+	}
+
+	/* Exit the monitor and terminate the thread */
+	omrthread_exit(_sweepHelpersActivationMonitor);
+}
+
+/**
+ * Finish any outstanding lazy sweep work.
+ * @note Expects exclusive access to be held and the parallel GC threads to be available.
+ */
+void
+MM_ConcurrentSweepGC::completeConcurrentSweep(MM_EnvironmentBase *env)
+{
+	MM_ConcurrentSweepScheme *concurrentSweep = getConcurrentSweepScheme();
+
+	if (concurrentSweep->isConcurrentSweepActive()) {
+		concurrentSweep->completeSweep(env, ABOUT_TO_GC);
+	}
+}
+
+void
+MM_ConcurrentSweepGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace, MM_AllocateDescription *allocDescription, uint32_t gcCode)
+{
+	/* The heap must be walkable before marking starts; a partially connected sweep is not */
+	completeConcurrentSweep(env);
+
+	MM_ParallelGlobalGC::internalPreCollect(env, subSpace, allocDescription, gcCode);
+}
+
+void
+MM_ConcurrentSweepGC::internalPostCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace)
+{
+	MM_ParallelGlobalGC::internalPostCollect(env, subSpace);
+
+	if (getConcurrentSweepScheme()->isConcurrentSweepActive()) {
+		resumeSweepHelperThreads(env);
+	}
+}
+
+void
+MM_ConcurrentSweepGC::prepareHeapForWalk(MM_EnvironmentBase *env)
+{
+	completeConcurrentSweep(env);
+
+	MM_ParallelGlobalGC::prepareHeapForWalk(env);
+}
+
+/**
+ * Pay the allocation tax for the mutator by sweeping and connecting unswept chunks.
+ */
+void
+MM_ConcurrentSweepGC::payAllocationTax(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, MM_MemorySubSpace *baseSubSpace, MM_AllocateDescription *allocDescription)
+{
+	uintptr_t oldVMstate = env->pushVMstate(OMRVMSTATE_GC_CONCURRENT_SWEEP);
+	getConcurrentSweepScheme()->payAllocationTax(env, baseSubSpace, allocDescription);
+	env->popVMstate(oldVMstate);
+}
+
+/**
+ * Replenish a pool's free list by sweeping and connecting chunks until an entry of the given size is found.
+ * @note This call is made under the pool's allocation lock (or equivalent)
+ * @return true if the pool was replenished with a free entry that can satisfy the size, false otherwise.
+ */
+bool
+MM_ConcurrentSweepGC::replenishPoolForAllocate(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, uintptr_t size)
+{
+	return _sweepScheme->replenishPoolForAllocate(env, memoryPool, size);
+}
+
+#endif /* OMR_GC_CONCURRENT_SWEEP */
@@ -0,0 +1,135 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(CONCURRENTSWEEPGC_HPP_)
+#define CONCURRENTSWEEPGC_HPP_
+
+#include "omrcfg.h"
+#include "modronopt.h"
+
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+
+#include "omrthread.h"
+
+#include "ConcurrentSweepScheme.hpp"
+#include "ParallelGlobalGC.hpp"
+
+class MM_AllocateDescription;
+class MM_EnvironmentBase;
+class MM_MemoryPool;
+class MM_MemorySubSpace;
+
+/**
+ * Global collector that leaves the sweep of the heap to be completed lazily after the
+ * stop-the-world phase.
+ *
+ * Chunks are left unswept when the collection ends. Allocating threads sweep and connect
+ * chunks on demand (allocation tax and pool replenishment), and a set of low priority
+ * background helper threads finish off the sweep phase in the meantime. Any outstanding
+ * work is completed before the next collection or heap walk.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ConcurrentSweepGC : public MM_ParallelGlobalGC
+{
+	/*
+	 * Data members
+	 */
+public:
+	/**
+	 * Request state of the background sweep helper threads.
+	 */
+	typedef enum {
+		SWEEP_HELPER_WAIT = 1, /**< nothing to do, wait for a request */
+		SWEEP_HELPER_SWEEP, /**< complete the sweep phase of the outstanding lazy sweep */
+		SWEEP_HELPER_SHUTDOWN /**< exit the thread */
+	} SweepHelperRequest;
+
+private:
+	omrthread_monitor_t _sweepHelpersActivationMonitor; /**< monitor used to wake up and shut down the helper threads */
+	omrthread_t *_sweepHelpersTable; /**< handles of the background helper threads */
+	uintptr_t _sweepHelperThreads; /**< number of helper threads requested */
+	uintptr_t _sweepHelpersStarted; /**< number of helper threads successfully started */
+	uintptr_t _sweepHelpersShutdownCount; /**< number of helper threads that have exited during shutdown */
+	volatile SweepHelperRequest _sweepHelpersRequest; /**< current request for the helper threads */
+
+	/*
+	 * Function members
+	 */
+private:
+	MMINLINE MM_ConcurrentSweepScheme *getConcurrentSweepScheme() { return (MM_ConcurrentSweepScheme *)_sweepScheme; }
+
+	void completeConcurrentSweep(MM_EnvironmentBase *env);
+
+	bool initializeSweepHelpers(MM_GCExtensionsBase *extensions);
+	void shutdownSweepHelperThreads(MM_GCExtensionsBase *extensions);
+	void resumeSweepHelperThreads(MM_EnvironmentBase *env);
+	SweepHelperRequest getSweepHelperRequest(MM_EnvironmentBase *env);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+	virtual void internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace, MM_AllocateDescription *allocDescription, uint32_t gcCode);
+	virtual void internalPostCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace);
+
+public:
+	static MM_ConcurrentSweepGC *newInstance(MM_EnvironmentBase *env);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	virtual bool collectorStartup(MM_GCExtensionsBase* extensions);
+	virtual void collectorShutdown(MM_GCExtensionsBase *extensions);
+
+	virtual void prepareHeapForWalk(MM_EnvironmentBase *env);
+
+	virtual void payAllocationTax(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, MM_MemorySubSpace *baseSubSpace, MM_AllocateDescription *allocDescription);
+	virtual bool replenishPoolForAllocate(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, uintptr_t size);
+
+	MMINLINE omrthread_monitor_t getSweepHelpersActivationMonitor() { return _sweepHelpersActivationMonitor; }
+
+	/**
+	 * Main loop of a background sweep helper thread.
+	 * @param omrThread the attached thread
+	 */
+	void sweepHelperEntryPoint(OMR_VMThread *omrThread);
+
+	MM_ConcurrentSweepGC(MM_EnvironmentBase *env)
+		: MM_ParallelGlobalGC(env)
+		, _sweepHelpersActivationMonitor(NULL)
+		, _sweepHelpersTable(NULL)
+		, _sweepHelperThreads(_extensions->concurrentSweepHelperThreads)
+		, _sweepHelpersStarted(0)
+		, _sweepHelpersShutdownCount(0)
+		, _sweepHelpersRequest(SWEEP_HELPER_WAIT)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* OMR_GC_CONCURRENT_SWEEP */
+
+#endif /* CONCURRENTSWEEPGC_HPP_ */
@@ -440,7 +440,8 @@ MM_ConcurrentSweepScheme::reportCompletedConcurrentSweep(MM_EnvironmentBase *env
 		_stats._completeSweepPhaseBytesSwept,
 		omrtime_hires_delta(_stats._completeConnectPhaseTimeStart, _stats._completeConnectPhaseTimeEnd, OMRPORT_TIME_DELTA_IN_MICROSECONDS),
 		_stats._completeConnectPhaseBytesConnected,
-		reason);
+		reason,
+		_stats._lazyBytesSwept);
 }
 
 /**
@@ -856,6 +857,9 @@ MM_ConcurrentSweepScheme::sweepNextAvailableChunk(MM_EnvironmentStandard *env, M
 		} else if (concurrentsweep_mode_stw_complete_sweep == _stats._mode) {
 			MM_AtomicOperations::add((UDATA *)&_stats._completeSweepPhaseBytesSwept, chunk->size());
 		}
+		if (concurrentsweep_mode_stw_complete_sweep != _stats._mode) {
+			MM_AtomicOperations::add((UDATA *)&_stats._lazyBytesSwept, chunk->size());
+		}
 		return true;
 	}
 	
@@ -1566,6 +1570,34 @@ MM_ConcurrentSweepScheme::completeSweepingConcurrently(MM_EnvironmentBase *envMo
 	return true;
 }
 
+/**
+ * Sweep the next available chunk of any memory pool on behalf of a background thread.
+ * Unlike completeSweepingConcurrently(), a single chunk is swept per call so that the caller can
+ * give up VM access between chunks when exclusive access is requested.
+ * @note The calling thread has VM access.
+ * @return true if a chunk was swept, false if no chunk is left to sweep.
+ */
+bool
+MM_ConcurrentSweepScheme::sweepNextChunkConcurrently(MM_EnvironmentBase *envModron)
+{
+	MM_EnvironmentStandard *env = MM_EnvironmentStandard::getEnvironment(envModron);
+
+	if(!_stats.canCompleteSweepConcurrently()) {
+		return false;
+	}
+
+	MM_HeapMemoryPoolIterator poolIterator(envModron, _extensions->heap);
+	MM_MemoryPoolAddressOrderedList *memoryPool;
+	while(NULL != (memoryPool = (MM_MemoryPoolAddressOrderedList *)poolIterator.nextPool())) {
+		MM_ConcurrentSweepPoolState *sweepState = (MM_ConcurrentSweepPoolState *)getPoolState(memoryPool);
+		if(concurrentSweepNextAvailableChunk(env, sweepState)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
 /**
  * Add to the concurrently sweeping thread pool count.
  * 
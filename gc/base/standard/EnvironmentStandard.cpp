@@ -58,6 +58,17 @@ MM_EnvironmentStandard::initialize(MM_GCExtensionsBase *extensions)
 	_scavengerRememberedSet.fragmentSize = (uintptr_t)OMR_SCV_REMSET_FRAGMENT_SIZE;
 	_scavengerRememberedSet.parentList = &extensions->rememberedSet;
 #endif
+#if defined(OMR_GC_REALTIME)
+	/* The remembered set doesn't exist yet, so the fragment is initialized as MM_RememberedSetSATB::initializeFragment() would
+	 * and attached to it by the first refresh.
+	 */
+	_sATBBarrierRememberedSetFragment.fragmentAlloc = NULL;
+	_sATBBarrierRememberedSetFragment.fragmentTop = NULL;
+	_sATBBarrierRememberedSetFragment.fragmentStorage = NULL;
+	_sATBBarrierRememberedSetFragment.localFragmentIndex = J9GC_REMEMBERED_SET_RESERVED_INDEX + 1;
+	_sATBBarrierRememberedSetFragment.preservedLocalFragmentIndex = J9GC_REMEMBERED_SET_RESERVED_INDEX + 1;
+	_sATBBarrierRememberedSetFragment.fragmentParent = NULL;
+#endif /* defined(OMR_GC_REALTIME) */
 
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	if (extensions->concurrentScavenger) {
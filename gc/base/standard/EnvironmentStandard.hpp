@@ -61,11 +61,17 @@ public:
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	J9VMGC_SublistFragment _scavengerRememberedSet;
 #endif
+#if defined(OMR_GC_REALTIME)
+	MM_GCRememberedSetFragment _sATBBarrierRememberedSetFragment; /**< objects remembered by this thread's snapshot-at-the-beginning barrier (@see standardPreWriteBarrier()) */
+#endif /* defined(OMR_GC_REALTIME) */
 	void *_tenureTLHRemainderBase;  /**< base and top pointers of the last unused tenure TLH copy cache, that might be reused  on next copy refresh */
 	void *_tenureTLHRemainderTop;
 	bool _loaAllocation;  /** true, if tenure TLH remainder is in LOA (TODO: try preventing remainder creation in LOA) */
 	void *_survivorTLHRemainderBase; /**< base and top pointers of the last unused survivor TLH copy cache, that might be reused  on next copy refresh */
 	void *_survivorTLHRemainderTop;
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	uintptr_t _hotFieldSampleCountdown; /**< objects this thread scans before sampling the next one for learned hot fields */
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 
 protected:
 
@@ -98,6 +104,9 @@ public:
 		,_loaAllocation(false)
 		,_survivorTLHRemainderBase(NULL)
 		,_survivorTLHRemainderTop(NULL)
+#if defined(OMR_GC_MODRON_SCAVENGER)
+		,_hotFieldSampleCountdown(0)
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 	{
 		_typeId = __FUNCTION__;
 	}
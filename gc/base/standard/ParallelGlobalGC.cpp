@@ -43,6 +43,7 @@
 #include "HeapMapIterator.hpp"
 #include "HeapRegionDescriptorStandard.hpp"
 #include "HeapRegionIteratorStandard.hpp"
+#include "IdleHeapUncommit.hpp"
 #include "MarkingScheme.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
@@ -351,6 +352,13 @@ MM_ParallelGlobalGC::initialize(MM_EnvironmentBase *env)
 		goto error_no_memory;
 	}
 
+	if (_extensions->idleHeapUncommit) {
+		_idleHeapUncommit = MM_IdleHeapUncommit::newInstance(env);
+		if (NULL == _idleHeapUncommit) {
+			goto error_no_memory;
+		}
+	}
+
 	/* Attach to hooks required by the global collector's
 	 * heap resize (expand/contraction) functions
 	 */
@@ -415,6 +423,11 @@ MM_ParallelGlobalGC::tearDown(MM_EnvironmentBase *env)
 		_heapWalker->kill(env);
 		_heapWalker = NULL;
 	}
+
+	if (NULL != _idleHeapUncommit) {
+		_idleHeapUncommit->kill(env);
+		_idleHeapUncommit = NULL;
+	}
 }
 
 uintptr_t
@@ -1444,12 +1457,18 @@ MM_ParallelGlobalGC::collectorStartup(MM_GCExtensionsBase* extensions)
 		extensions->scavenger->collectorStartup(extensions);
 	}
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+	if (NULL != _idleHeapUncommit) {
+		return _idleHeapUncommit->startup();
+	}
 	return true;
 }
 
 void
 MM_ParallelGlobalGC::collectorShutdown(MM_GCExtensionsBase *extensions)
 {
+	if (NULL != _idleHeapUncommit) {
+		_idleHeapUncommit->shutdown();
+	}
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	if (extensions->scavengerEnabled && (NULL != extensions->scavenger)) {
 		extensions->scavenger->collectorShutdown(extensions);
@@ -341,14 +341,7 @@ MM_ParallelSweepScheme::sweepMarkMapBody(
 		markMapFreeHead = markMapCurrent;
 		heapSlotFreeHead = heapSlotFreeCurrent;
 
-		markMapCurrent += 1;
-
-		while(markMapCurrent < markMapChunkTop) {
-			if(*markMapCurrent != J9MODRON_OBM_SLOT_EMPTY) {
-				break;
-			}
-			markMapCurrent += 1;
-		}
+		markMapCurrent = MM_HeapMapWordIterator::skipEmptyWords(markMapCurrent + 1, markMapChunkTop);
 
 		/* Find the number of slots we've walked
 		 * (pointer math makes this the number of slots)
@@ -407,12 +400,14 @@ MM_ParallelSweepScheme::performSamplingCalculations(MM_ParallelSweepChunk *sweep
 	/* Hole at the beginning of the sample is not considered, since we do not know
 	 * if that's part of a preceding object or part of hole.
 	 */
-	omrobjectptr_t prevObject = markedObjectIterator.nextObject();
-	Assert_MM_true(NULL != prevObject);
+	omrobjectptr_t objects[OMRBITS_BITS_IN_SLOT];
+	uintptr_t objectCount = markedObjectIterator.nextObjects(objects, OMRBITS_BITS_IN_SLOT);
+	Assert_MM_true(0 != objectCount);
+	omrobjectptr_t prevObject = objects[0];
 	uintptr_t prevObjectSize = _extensions->objectModel.getConsumedSizeInBytesWithHeader(prevObject);
 
-	omrobjectptr_t object = NULL;
-	while (NULL != (object = markedObjectIterator.nextObject())) {
+	for (uintptr_t i = 1; i < objectCount; i++) {
+		omrobjectptr_t object = objects[i];
 		uintptr_t holeSize = (uintptr_t)object - ((uintptr_t)prevObject + prevObjectSize);
 		Assert_MM_true(holeSize < minimumFreeEntrySize);
 		darkMatter += holeSize;
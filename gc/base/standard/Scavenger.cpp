@@ -31,6 +31,10 @@
 #endif
 
 #include <math.h>
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define OMR_SCAVENGER_NON_TEMPORAL_COPY
+#endif /* defined(__SSE2__) || defined(_M_X64) */
 
 #include "omrcfg.h"
 #include "omrcomp.h"
@@ -62,6 +66,7 @@
 #include "HeapRegionIterator.hpp"
 #include "HeapRegionManager.hpp"
 #include "HeapStats.hpp"
+#include "Math.hpp"
 #include "MemoryPool.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
@@ -80,6 +85,7 @@
 #include "RSOverflow.hpp"
 #include "Scavenger.hpp"
 #include "ScavengerBackOutScanner.hpp"
+#include "ScavengerHotFieldTable.hpp"
 #include "ScavengerRootScanner.hpp"
 #include "ScavengerStats.hpp"
 #include "SlotObject.hpp"
@@ -88,6 +94,7 @@
 #include "SublistPool.hpp"
 #include "SublistPuddle.hpp"
 #include "SublistSlotIterator.hpp"
+#include "TLHPrezeroer.hpp"
 
 #if defined(OMR_VALGRIND_MEMCHECK)
 #include "MemcheckWrapper.hpp"
@@ -101,6 +108,7 @@
 #include "ut_omrmm.h"
 
 #define INITIAL_FREE_HISTORY_WEIGHT ((float)0.8)
+#define HOT_FIELD_SAMPLE_INTERVAL 16 /**< one in this many scanned objects is sampled for learned hot fields */
 #define TENURE_BYTES_HISTORY_WEIGHT ((float)0.9)
 
 #define FLIP_TENURE_LARGE_SCAN 4
@@ -120,6 +128,9 @@
 #define CACHE_LINE_SIZE 64
 #endif
 
+/* Chunks of a shared chunked copy are at least a page, so claiming one is cheap relative to copying it */
+#define CHUNKED_COPY_MINIMUM_CHUNK_SIZE 4096
+
 /* create macros to interpret the hot field descriptor */
 #define HOTFIELD_SHOULD_ALIGN(descriptor) (0x1 == (0x1 & (descriptor)))
 #define HOTFIELD_ALIGNMENT_BIAS(descriptor, heapObjectAlignment) (((descriptor) >> 1) * (heapObjectAlignment))
@@ -294,6 +305,26 @@ MM_Scavenger::initialize(MM_EnvironmentBase *env)
 	}
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 
+	memset(_chunkedCopies, 0, sizeof(_chunkedCopies));
+
+#if defined(OMR_GC_AUTO_HOT_FIELDS)
+	if (_extensions->scavengerAutoHotFields) {
+		_hotFieldTable = MM_ScavengerHotFieldTable::newInstance(env);
+		if (NULL == _hotFieldTable) {
+			return false;
+		}
+	}
+#endif /* defined(OMR_GC_AUTO_HOT_FIELDS) */
+
+#if defined(OMR_GC_THREAD_LOCAL_HEAP) && defined(OMR_GC_BATCH_CLEAR_TLH)
+	if (_extensions->tlhPrezeroing && (0 != _extensions->batchClearTLH)) {
+		_extensions->tlhPrezeroer = MM_TLHPrezeroer::newInstance(env);
+		if (NULL == _extensions->tlhPrezeroer) {
+			return false;
+		}
+	}
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) && defined(OMR_GC_BATCH_CLEAR_TLH) */
+
 	if (!_delegate.initialize(env)) {
 		return false;
 	}
@@ -306,6 +337,18 @@ MM_Scavenger::tearDown(MM_EnvironmentBase *env)
 {
 	_delegate.tearDown(env);
 
+	if (NULL != _hotFieldTable) {
+		_hotFieldTable->kill(env);
+		_hotFieldTable = NULL;
+	}
+
+#if defined(OMR_GC_THREAD_LOCAL_HEAP) && defined(OMR_GC_BATCH_CLEAR_TLH)
+	if (NULL != _extensions->tlhPrezeroer) {
+		_extensions->tlhPrezeroer->kill(env);
+		_extensions->tlhPrezeroer = NULL;
+	}
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) && defined(OMR_GC_BATCH_CLEAR_TLH) */
+
 	_scavengeCacheFreeList.tearDown(env);
 	_scavengeCacheScanList.tearDown(env);
 
@@ -361,6 +404,14 @@ MM_Scavenger::collectorStartup(MM_GCExtensionsBase* extensions)
 	 */
 	_extensions->scavengerStats._avgExpectedFlipBytes = OMR_MIN(_extensions->heap->getActiveMemorySize(MEMORY_TYPE_NEW) / 8, (uintptr_t)128 * 1024 * 1024);
 
+#if defined(OMR_GC_THREAD_LOCAL_HEAP) && defined(OMR_GC_BATCH_CLEAR_TLH)
+	if (NULL != _extensions->tlhPrezeroer) {
+		if (!_extensions->tlhPrezeroer->startupThread(extensions)) {
+			return false;
+		}
+	}
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) && defined(OMR_GC_BATCH_CLEAR_TLH) */
+
 	return true;
 }
 
@@ -371,6 +422,12 @@ MM_Scavenger::collectorStartup(MM_GCExtensionsBase* extensions)
 void
 MM_Scavenger::collectorShutdown(MM_GCExtensionsBase* extensions)
 {
+#if defined(OMR_GC_THREAD_LOCAL_HEAP) && defined(OMR_GC_BATCH_CLEAR_TLH)
+	if (NULL != _extensions->tlhPrezeroer) {
+		_extensions->tlhPrezeroer->shutdownThread(extensions);
+	}
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) && defined(OMR_GC_BATCH_CLEAR_TLH) */
+
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	if (IS_CONCURRENT_ENABLED) {
 
@@ -466,7 +523,13 @@ MM_Scavenger::mainSetupForGC(MM_EnvironmentStandard *env)
 	}
 
 	/* Record the tenure mask */
-	_tenureMask = calculateTenureMask();
+	_tenureMask = calculateTenureMask(env);
+
+	/* Learn hot fields from the objects sampled by previous scavenges */
+	if (NULL != _hotFieldTable) {
+		_hotFieldTable->update(env);
+		_extensions->scavengerStats._hotFieldLearnedShapes = _hotFieldTable->getLearnedShapes();
+	}
 
 	_activeSubSpace->mainSetupForGC(env);
 
@@ -826,6 +889,13 @@ MM_Scavenger::mergeGCStatsBase(MM_EnvironmentBase *env, MM_ScavengerStats *final
 	finalGCStats->_copyScanUpdates += scavStats->_copyScanUpdates;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
+	finalGCStats->_nonTemporalCopyBytes += scavStats->_nonTemporalCopyBytes;
+	finalGCStats->_chunkedCopyBytes += scavStats->_chunkedCopyBytes;
+	finalGCStats->_chunkedCopyHelpedBytes += scavStats->_chunkedCopyHelpedBytes;
+
+	finalGCStats->_hotFieldSampledObjects += scavStats->_hotFieldSampledObjects;
+	finalGCStats->_hotFieldDepthCopies += scavStats->_hotFieldDepthCopies;
+
 	finalGCStats->_flipDiscardBytes += scavStats->_flipDiscardBytes;
 	finalGCStats->_tenureDiscardBytes += scavStats->_tenureDiscardBytes;
 
@@ -1824,7 +1894,7 @@ MM_Scavenger::copyForVariant(MM_EnvironmentStandard *env, MM_ForwardedHeader* fo
 		} else
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 		{
-			memcpy((void *)destinationObjectPtr, forwardedHeader->getObject(), objectCopySizeInBytes);
+			copyObjectContents(env, (void *)destinationObjectPtr, forwardedHeader->getObject(), objectCopySizeInBytes);
 
 			/* Copy the preserved fields from the forwarded header into the destination object */
 			forwardedHeader->fixupForwardedObject(destinationObjectPtr);
@@ -1883,6 +1953,169 @@ MM_Scavenger::copyForVariant(MM_EnvironmentStandard *env, MM_ForwardedHeader* fo
 	return destinationObjectPtr;
 }
 
+MMINLINE void
+MM_Scavenger::copyObjectContents(MM_EnvironmentStandard *env, void *destination, void *source, uintptr_t sizeInBytes)
+{
+	uintptr_t chunkedCopyThreshold = _extensions->scavengerChunkedCopyThreshold;
+	if ((0 != chunkedCopyThreshold) && (sizeInBytes >= chunkedCopyThreshold)
+	&& (1 < env->_currentTask->getThreadCount())
+	&& copyChunked(env, destination, source, sizeInBytes)
+	) {
+		env->_scavengerStats._chunkedCopyBytes += sizeInBytes;
+		return;
+	}
+
+#if defined(OMR_SCAVENGER_NON_TEMPORAL_COPY)
+	uintptr_t nonTemporalCopyThreshold = _extensions->scavengerNonTemporalCopyThreshold;
+	if ((0 != nonTemporalCopyThreshold) && (sizeInBytes >= nonTemporalCopyThreshold)) {
+		copyNonTemporal(destination, source, sizeInBytes);
+		/* the streaming stores must be visible before the object is forwarded or scanned by another thread */
+		_mm_sfence();
+		env->_scavengerStats._nonTemporalCopyBytes += sizeInBytes;
+		return;
+	}
+#endif /* defined(OMR_SCAVENGER_NON_TEMPORAL_COPY) */
+
+	memcpy(destination, source, sizeInBytes);
+}
+
+MMINLINE void
+MM_Scavenger::copyNonTemporal(void *destination, void *source, uintptr_t sizeInBytes)
+{
+#if defined(OMR_SCAVENGER_NON_TEMPORAL_COPY)
+	uint8_t *dst = (uint8_t *)destination;
+	uint8_t *src = (uint8_t *)source;
+
+	/* streaming stores need a 16 byte aligned destination; objects are only object aligned, so copy the head normally */
+	uintptr_t headSize = OMR_MIN((uintptr_t)(0 - (uintptr_t)dst) & 15, sizeInBytes);
+	memcpy(dst, src, headSize);
+	dst += headSize;
+	src += headSize;
+	sizeInBytes -= headSize;
+
+	uintptr_t streamSize = sizeInBytes & ~(uintptr_t)63;
+	for (uintptr_t offset = 0; offset < streamSize; offset += 64) {
+		__m128i line0 = _mm_loadu_si128((__m128i *)(src + offset));
+		__m128i line1 = _mm_loadu_si128((__m128i *)(src + offset + 16));
+		__m128i line2 = _mm_loadu_si128((__m128i *)(src + offset + 32));
+		__m128i line3 = _mm_loadu_si128((__m128i *)(src + offset + 48));
+		_mm_stream_si128((__m128i *)(dst + offset), line0);
+		_mm_stream_si128((__m128i *)(dst + offset + 16), line1);
+		_mm_stream_si128((__m128i *)(dst + offset + 32), line2);
+		_mm_stream_si128((__m128i *)(dst + offset + 48), line3);
+	}
+	memcpy(dst + streamSize, src + streamSize, sizeInBytes - streamSize);
+#else /* defined(OMR_SCAVENGER_NON_TEMPORAL_COPY) */
+	memcpy(destination, source, sizeInBytes);
+#endif /* defined(OMR_SCAVENGER_NON_TEMPORAL_COPY) */
+}
+
+bool
+MM_Scavenger::copyChunked(MM_EnvironmentStandard *env, void *destination, void *source, uintptr_t sizeInBytes)
+{
+	ChunkedCopy *copy = NULL;
+
+	omrthread_monitor_enter(_scanCacheMonitor);
+	/* a slot is not reused while a helper may still read the copy it last shared */
+	for (uintptr_t i = 0; i < SCAVENGER_CHUNKED_COPY_SLOTS; i++) {
+		if ((NULL == _chunkedCopies[i].source) && (0 == _chunkedCopies[i].helpers)) {
+			copy = &_chunkedCopies[i];
+			break;
+		}
+	}
+	if (NULL != copy) {
+		uintptr_t chunkSize = sizeInBytes / (2 * env->_currentTask->getThreadCount());
+		copy->destination = (uint8_t *)destination;
+		copy->size = sizeInBytes;
+		copy->chunkSize = MM_Math::roundToCeiling(CHUNKED_COPY_MINIMUM_CHUNK_SIZE, OMR_MAX(chunkSize, (uintptr_t)1));
+#if defined(OMR_SCAVENGER_NON_TEMPORAL_COPY)
+		copy->nonTemporal = (0 != _extensions->scavengerNonTemporalCopyThreshold) && (sizeInBytes >= _extensions->scavengerNonTemporalCopyThreshold);
+#endif /* defined(OMR_SCAVENGER_NON_TEMPORAL_COPY) */
+		copy->claimed = 0;
+		copy->completed = 0;
+		MM_AtomicOperations::storeSync();
+		copy->source = (uint8_t *)source;
+		if (0 != _waitingCount) {
+			omrthread_monitor_notify_all(_scanCacheMonitor);
+		}
+	}
+	omrthread_monitor_exit(_scanCacheMonitor);
+
+	if (NULL != copy) {
+		copyChunks(env, copy, (uint8_t *)source);
+
+		/* the object is not complete until the helpers are done with the chunks they claimed; rather than spin, help with other chunked copies */
+		while (copy->completed < sizeInBytes) {
+			if (0 == helpChunkedCopy(env)) {
+				omrthread_yield();
+			}
+		}
+		MM_AtomicOperations::loadSync();
+
+		/* retire the copy, helpers that still hold the slot find nothing left to claim */
+		copy->source = NULL;
+	}
+
+	return NULL != copy;
+}
+
+uintptr_t
+MM_Scavenger::copyChunks(MM_EnvironmentStandard *env, ChunkedCopy *copy, uint8_t *source)
+{
+	uint8_t *destination = copy->destination;
+	uintptr_t size = copy->size;
+	uintptr_t chunkSize = copy->chunkSize;
+	uintptr_t copied = 0;
+
+	for (;;) {
+		uintptr_t offset = MM_AtomicOperations::add(&copy->claimed, chunkSize) - chunkSize;
+		if (offset >= size) {
+			break;
+		}
+		uintptr_t length = OMR_MIN(chunkSize, size - offset);
+		if (copy->nonTemporal) {
+			copyNonTemporal(destination + offset, source + offset, length);
+		} else {
+			memcpy(destination + offset, source + offset, length);
+		}
+		copied += length;
+	}
+
+	if (0 != copied) {
+#if defined(OMR_SCAVENGER_NON_TEMPORAL_COPY)
+		if (copy->nonTemporal) {
+			_mm_sfence();
+		}
+#endif /* defined(OMR_SCAVENGER_NON_TEMPORAL_COPY) */
+		MM_AtomicOperations::add(&copy->completed, copied);
+	}
+
+	return copied;
+}
+
+uintptr_t
+MM_Scavenger::helpChunkedCopy(MM_EnvironmentStandard *env)
+{
+	uintptr_t copied = 0;
+
+	for (uintptr_t i = 0; i < SCAVENGER_CHUNKED_COPY_SLOTS; i++) {
+		ChunkedCopy *copy = &_chunkedCopies[i];
+		if (isChunkedCopyAvailable(copy)) {
+			MM_AtomicOperations::add(&copy->helpers, 1);
+			/* re-read the source now that the slot cannot be reused under us */
+			uint8_t *source = copy->source;
+			if (NULL != source) {
+				MM_AtomicOperations::loadSync();
+				copied += copyChunks(env, copy, source);
+			}
+			MM_AtomicOperations::subtract(&copy->helpers, 1);
+		}
+	}
+	env->_scavengerStats._chunkedCopyHelpedBytes += copied;
+
+	return copied;
+}
+
 MMINLINE void
 MM_Scavenger::depthCopyHotFields(MM_EnvironmentStandard *env, MM_ForwardedHeader* forwardedHeader, omrobjectptr_t destinationObjectPtr) {
 	/* depth copy the hot fields of an object up to a depth specified by depthCopyMax */
@@ -1898,8 +2131,24 @@ MM_Scavenger::depthCopyHotFields(MM_EnvironmentStandard *env, MM_ForwardedHeader
 					copyHotField(env, destinationObjectPtr, hotFieldOffset3);
 				}
 			}
-		} else if (_extensions->alwaysDepthCopyFirstOffset && !_extensions->objectModel.isIndexable(forwardedHeader)) {
-			copyHotField(env, destinationObjectPtr, DEFAULT_HOT_FIELD_OFFSET);
+		} else {
+			const uint8_t *learnedHotFields = NULL;
+#if defined(OMR_GC_AUTO_HOT_FIELDS)
+			if ((NULL != _hotFieldTable) && !_extensions->objectModel.isIndexable(forwardedHeader)) {
+				uintptr_t shape = _extensions->objectModel.getObjectShape(forwardedHeader);
+				if (0 != shape) {
+					learnedHotFields = _hotFieldTable->getHotFields(shape);
+				}
+			}
+#endif /* defined(OMR_GC_AUTO_HOT_FIELDS) */
+			if (NULL != learnedHotFields) {
+				env->_scavengerStats._hotFieldDepthCopies += 1;
+				for (uintptr_t i = 0; (i < SCAVENGER_HOT_FIELD_MAX) && (U_8_MAX != learnedHotFields[i]); i++) {
+					copyHotField(env, destinationObjectPtr, learnedHotFields[i]);
+				}
+			} else if (_extensions->alwaysDepthCopyFirstOffset && !_extensions->objectModel.isIndexable(forwardedHeader)) {
+				copyHotField(env, destinationObjectPtr, DEFAULT_HOT_FIELD_OFFSET);
+			}
 		}
 	}
 }
@@ -1920,6 +2169,18 @@ MM_Scavenger::copyHotField(MM_EnvironmentStandard *env, omrobjectptr_t destinati
 	}
 }
 
+MMINLINE void
+MM_Scavenger::sampleHotField(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, uintptr_t shape, GC_SlotObject *slotObject)
+{
+	if (isObjectInEvacuateMemory(slotObject->readReferenceFromSlot())) {
+		bool const compressed = _extensions->compressObjectReferences();
+		uintptr_t slotIndex = (uintptr_t)GC_SlotObject::subtractSlotAddresses(slotObject->readAddressFromSlot(), (fomrobject_t *)objectPtr, compressed);
+		if (slotIndex < SCAVENGER_HOT_FIELD_SLOTS) {
+			_hotFieldTable->recordCopiedSlot(shape, slotIndex);
+		}
+	}
+}
+
 /****************************************
  * Object scan and copy routines
  ****************************************
@@ -2064,12 +2325,31 @@ MM_Scavenger::scavengeObjectSlots(MM_EnvironmentStandard *env, MM_CopyScanCacheS
 		}
 	}
 
+	/* sample some of the objects for learned hot fields, the slots of indexable objects are not fields */
+	uintptr_t hotFieldShape = 0;
+#if defined(OMR_GC_AUTO_HOT_FIELDS)
+	if ((NULL != _hotFieldTable) && !objectScanner->isIndexableObject()) {
+		if (0 == env->_hotFieldSampleCountdown) {
+			env->_hotFieldSampleCountdown = HOT_FIELD_SAMPLE_INTERVAL - 1;
+			hotFieldShape = _extensions->objectModel.getObjectShape(objectPtr);
+			if (0 != hotFieldShape) {
+				env->_scavengerStats._hotFieldSampledObjects += 1;
+			}
+		} else {
+			env->_hotFieldSampleCountdown -= 1;
+		}
+	}
+#endif /* defined(OMR_GC_AUTO_HOT_FIELDS) */
+
 	uint64_t slotsCopied = 0;
 	uint64_t slotsScanned = 0;
 	GC_SlotObject *slotObject = NULL;
 
 	MM_CopyScanCacheStandard **copyCache = &(env->_effectiveCopyScanCache);
 	while (NULL != (slotObject = objectScanner->getNextSlot())) {
+		if (0 != hotFieldShape) {
+			sampleHotField(env, objectPtr, hotFieldShape, slotObject);
+		}
 		bool isSlotObjectInNewSpace = copyAndForward(env, slotObject);
 		shouldRemember |= isSlotObjectInNewSpace;
 		if (NULL != *copyCache) {
@@ -2412,6 +2692,9 @@ MM_Scavenger::getNextScanCache(MM_EnvironmentStandard *env)
 			}
 		}
 
+		/* help copy a large object before waiting for scan work */
+		helpChunkedCopy(env);
+
 		omrthread_monitor_enter(_scanCacheMonitor);
 		_waitingCount += 1;
 
@@ -2428,7 +2711,7 @@ MM_Scavenger::getNextScanCache(MM_EnvironmentStandard *env)
 					env->_scavengerStats.addToNotifyStallTime(notifyStartTime, omrtime_hires_clock());
 				}
 			} else {
-				while((0 == _cachedEntryCount) && (doneIndex == _doneIndex) && !shouldAbortScanLoop(env)) {
+				while((0 == _cachedEntryCount) && (doneIndex == _doneIndex) && !shouldAbortScanLoop(env) && !isChunkedCopyAvailable()) {
 					flushBuffersForGetNextScanCache(env);
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 					uint64_t waitEndTime, waitStartTime;
@@ -5107,11 +5390,20 @@ MM_Scavenger::reportGCIncrementEnd(MM_EnvironmentStandard *env)
 }
 
 uintptr_t
-MM_Scavenger::calculateTenureMask()
+MM_Scavenger::calculateTenureMask(MM_EnvironmentStandard *env)
 {
 	/* always tenure objects which have reached the maximum age */
 	uintptr_t newMask = ((uintptr_t)1 << OBJECT_HEADER_AGE_MAX);
 
+	if (_extensions->scvTenureStrategyCost) {
+		/* The Cost strategy may raise the tenure age as well as lower it, so it is not combined with the others */
+		uintptr_t costMask = calculateTenureMaskUsingCost(env);
+		if (0 != costMask) {
+			return newMask | costMask;
+		}
+		/* no survivors in the history yet, the other strategies decide */
+	}
+
 	/* Delegate tenure mask calculations to the active strategies. */
 	if (_extensions->scvTenureStrategyFixed) {
 		newMask |= calculateTenureMaskUsingFixed(_extensions->scvTenureFixedTenureAge);
@@ -5125,7 +5417,6 @@ MM_Scavenger::calculateTenureMask()
 	if (_extensions->scvTenureStrategyHistory) {
 		newMask |= calculateTenureMaskUsingHistory(_extensions->scvTenureStrategySurvivalThreshold);
 	}
-
 	return newMask;
 }
 
@@ -5272,6 +5563,84 @@ MM_Scavenger::calculateTenureMaskUsingHistory(double minimumSurvivalRate)
 	return mask;
 }
 
+uintptr_t
+MM_Scavenger::calculateTenureMaskUsingCost(MM_EnvironmentStandard *env)
+{
+	MM_ScavengerStats *stats = &_extensions->scavengerStats;
+
+	/* liveBytes[i] is the projected number of bytes of a generation still alive after surviving i scavenges.
+	 * Skip the first row in the history (it's the current scavenge, and is all zero right now).
+	 */
+	double liveBytes[OBJECT_HEADER_AGE_MAX + 2];
+	double survivedOnceBytes = 0.0;
+	uintptr_t count = 0;
+	for (uintptr_t lookback = 1; lookback < SCAVENGER_FLIP_HISTORY_SIZE; lookback++) {
+		uintptr_t bytes = stats->getFlipHistory(lookback)->_flipBytes[1] + stats->getFlipHistory(lookback)->_tenureBytes[1];
+		if (0 != bytes) {
+			survivedOnceBytes += (double)bytes;
+			count += 1;
+		}
+	}
+	if (0 == count) {
+		/* no survivors in the history yet, leave the decision to the other strategies */
+		return 0;
+	}
+
+	liveBytes[0] = 0.0;
+	liveBytes[1] = survivedOnceBytes / (double)count;
+	double survivalRate = 1.0;
+	for (uintptr_t survived = 1; survived <= OBJECT_HEADER_AGE_MAX; survived++) {
+		/* Only objects flipped at the previous scavenge can survive into the next age, so compare diagonally
+		 * across the history (as the History strategy does), aggregated over all of it.
+		 * An age nobody reached keeps the rate of the oldest age that has been observed.
+		 */
+		double currentBytes = 0.0;
+		double nextBytes = 0.0;
+		for (uintptr_t lookback = 1; lookback < SCAVENGER_FLIP_HISTORY_SIZE - 1; lookback++) {
+			currentBytes += (double)stats->getFlipHistory(lookback + 1)->_flipBytes[survived];
+			nextBytes += (double)(stats->getFlipHistory(lookback)->_flipBytes[survived + 1] + stats->getFlipHistory(lookback)->_tenureBytes[survived + 1]);
+		}
+		if (0.0 != currentBytes) {
+			survivalRate = OMR_MIN(1.0, nextBytes / currentBytes);
+		}
+		liveBytes[survived + 1] = liveBytes[survived] * survivalRate;
+	}
+
+	/* With tenure age T, a generation is flipped after surviving 1..T scavenges and tenured after surviving T+1.
+	 * Whatever is tenured but would not have survived to the maximum age becomes garbage in tenure space.
+	 */
+	uintptr_t bestAge = OBJECT_HEADER_AGE_MAX;
+	double bestCost = 0.0;
+	double bestCopyBytes = 0.0;
+	double bestGarbageBytes = 0.0;
+	double bestSurvivorBytes = 0.0;
+	double survivorBytes = 0.0;
+	for (uintptr_t age = 1; age <= OBJECT_HEADER_AGE_MAX; age++) {
+		survivorBytes += liveBytes[age];
+		if (age < OBJECT_HEADER_AGE_MIN) {
+			continue;
+		}
+		double copyBytes = survivorBytes + liveBytes[age + 1];
+		double garbageBytes = liveBytes[age + 1] - liveBytes[OBJECT_HEADER_AGE_MAX + 1];
+		double cost = copyBytes + garbageBytes;
+		if ((OBJECT_HEADER_AGE_MIN == age) || (cost < bestCost)) {
+			bestAge = age;
+			bestCost = cost;
+			bestCopyBytes = copyBytes;
+			bestGarbageBytes = garbageBytes;
+			bestSurvivorBytes = survivorBytes;
+		}
+	}
+
+	stats->_tenureCostAge = bestAge;
+	stats->_tenureCostCopyBytes = (uintptr_t)bestCopyBytes;
+	stats->_tenureCostGarbageBytes = (uintptr_t)bestGarbageBytes;
+	stats->_tenureCostSurvivorBytes = (uintptr_t)bestSurvivorBytes;
+	Trc_MM_Scavenger_calculateTenureMaskUsingCost(env->getLanguageVMThread(), bestAge, stats->_tenureCostCopyBytes, stats->_tenureCostGarbageBytes, stats->_tenureCostSurvivorBytes);
+
+	return calculateTenureMaskUsingFixed(bestAge);
+}
+
 uintptr_t
 MM_Scavenger::calculateTenureMaskUsingFixed(uintptr_t tenureAge)
 {
@@ -55,12 +55,15 @@ class MM_MemorySubSpaceSemiSpace;
 class MM_ParallelDispatcher;
 class MM_PhysicalSubArena;
 class MM_RSOverflow;
+class MM_ScavengerHotFieldTable;
 class MM_SublistPool;
 
 struct OMR_VM;
 
 extern "C" void concurrentScavengerAsyncCallbackHandler(OMR_VMThread *omrVMThread);
 
+#define SCAVENGER_CHUNKED_COPY_SLOTS 4 /**< large object copies that can be shared out in chunks at the same time */
+
 /**
  * @todo Provide class documentation
  * @ingroup GC_Modron_Standard
@@ -123,6 +126,19 @@ private:
 
 	volatile uintptr_t _backOutDoneIndex; /**< snapshot of _doneIndex, when backOut was detected */
 
+	struct ChunkedCopy {
+		uint8_t * volatile source; /**< source of the large object whose copy is shared out in chunks, NULL if the slot is free */
+		uint8_t *destination; /**< destination of the shared chunked copy */
+		uintptr_t size; /**< size in bytes of the shared chunked copy */
+		uintptr_t chunkSize; /**< bytes claimed at a time from the shared chunked copy */
+		bool nonTemporal; /**< true if the chunks of the shared chunked copy are copied with streaming stores */
+		volatile uintptr_t claimed; /**< bytes of the shared chunked copy claimed by copying threads (may overshoot its size) */
+		volatile uintptr_t completed; /**< bytes of the shared chunked copy already copied */
+		volatile uintptr_t helpers; /**< threads currently reading the slot, it is not reused until they are gone */
+	} _chunkedCopies[SCAVENGER_CHUNKED_COPY_SLOTS]; /**< large object copies currently shared out in chunks */
+
+	MM_ScavengerHotFieldTable *_hotFieldTable; /**< hot fields learned per object shape, NULL unless scavengerAutoHotFields is enabled */
+
 	void *_heapBase;  /**< Cached base pointer of heap */
 	void *_heapTop;  /**< Cached top pointer of heap */
 	MM_HeapRegionManager *_regionManager;
@@ -293,6 +309,62 @@ public:
 	 * @param destinationObjectPtr DestinationObjectPtr of the object described by the forwardedHeader
 	 */ 
 	MMINLINE void depthCopyHotFields(MM_EnvironmentStandard *env, MM_ForwardedHeader* forwardedHeader, omrobjectptr_t destinationObjectPtr);
+
+	/**
+	 * Copy the contents of a surviving object. Large objects are copied with streaming stores so their destination lines
+	 * do not evict the working set, and very large ones are split into chunks that idle threads help copy.
+	 * @param destination Where the object is copied to
+	 * @param source The object being copied
+	 * @param sizeInBytes Number of bytes to copy
+	 */
+	MMINLINE void copyObjectContents(MM_EnvironmentStandard *env, void *destination, void *source, uintptr_t sizeInBytes);
+
+	/**
+	 * Copy memory with streaming (non-temporal) stores, falling back to memcpy where they are not available.
+	 * The stores are weakly ordered: the caller must issue a store fence before the copy is published.
+	 */
+	MMINLINE void copyNonTemporal(void *destination, void *source, uintptr_t sizeInBytes);
+
+	/**
+	 * Publish a chunked copy, copy chunks of it until none are left to claim, and help with other published
+	 * chunked copies (or yield) until the helpers have finished the chunks they claimed.
+	 * @return false if all chunked copy slots are in use and the object was not copied
+	 */
+	bool copyChunked(MM_EnvironmentStandard *env, void *destination, void *source, uintptr_t sizeInBytes);
+
+	/**
+	 * Claim and copy chunks of a published chunked copy until none are left.
+	 * @return the number of bytes copied by the calling thread
+	 */
+	uintptr_t copyChunks(MM_EnvironmentStandard *env, ChunkedCopy *copy, uint8_t *source);
+
+	/**
+	 * Help with the published chunked copies, if any. Called by threads looking for scan work and by
+	 * threads waiting for their own chunked copy to complete.
+	 * @return the number of bytes copied by the calling thread
+	 */
+	uintptr_t helpChunkedCopy(MM_EnvironmentStandard *env);
+
+	/**
+	 * @return true if a chunked copy is published and some of its chunks are still unclaimed
+	 */
+	MMINLINE bool isChunkedCopyAvailable(ChunkedCopy *copy)
+	{
+		return (NULL != copy->source) && (copy->claimed < copy->size);
+	}
+
+	/**
+	 * @return true if any published chunked copy has chunks that are still unclaimed
+	 */
+	MMINLINE bool isChunkedCopyAvailable()
+	{
+		for (uintptr_t i = 0; i < SCAVENGER_CHUNKED_COPY_SLOTS; i++) {
+			if (isChunkedCopyAvailable(&_chunkedCopies[i])) {
+				return true;
+			}
+		}
+		return false;
+	}
 	
 	/* Copy the the hot field of an object.
 	 * Valid if scavenger dynamicBreadthScanOrdering is enabled.
@@ -301,6 +373,15 @@ public:
 	 */ 
 	MMINLINE void copyHotField(MM_EnvironmentStandard *env, omrobjectptr_t destinationObjectPtr, uint8_t offset);
 
+	/**
+	 * Sample a slot of an object scanned for learned hot fields, before the slot is copied and forwarded.
+	 * The slot is recorded if its referent is about to be copied out of evacuate space.
+	 * @param objectPtr The object being scanned
+	 * @param shape The shape of the object being scanned
+	 * @param slotObject The slot of the object about to be copied and forwarded
+	 */
+	MMINLINE void sampleHotField(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, uintptr_t shape, GC_SlotObject *slotObject);
+
 	MMINLINE void updateCopyScanCounts(MM_EnvironmentBase* env, uint64_t slotsScanned, uint64_t slotsCopied);
 	bool splitIndexableObjectScanner(MM_EnvironmentStandard *env, GC_ObjectScanner *objectScanner, uintptr_t startIndex, omrobjectptr_t *rememberedSetSlot);
 
@@ -668,6 +749,20 @@ public:
 	 */
 	uintptr_t calculateTenureMaskUsingHistory(double minimumSurvivalRate);
 
+	/**
+	 * The implementation of the Cost scavenger tenure strategy.
+	 * This strategy computes the survival rate of each age over the whole
+	 * survival history, projects how many bytes of a generation are still
+	 * alive after each scavenge, and picks the tenure age that minimizes the
+	 * projected bytes copied plus the projected bytes tenured that would
+	 * still have died in the nursery. Ages older than any observed survival
+	 * are assumed to keep surviving at the rate of the oldest observed age.
+	 * The choice and its projections are recorded in the cycle scavenger stats.
+	 * @param env The environment of the thread setting up the scavenge
+	 * @return A tenure mask for the resulting ages to tenure, 0 until there is history.
+	 */
+	uintptr_t calculateTenureMaskUsingCost(MM_EnvironmentStandard *env);
+
 	/**
 	 * The implementation of the Fixed scavenger tenure strategy.
 	 * This strategy will tenure any object who's age is above or equal to
@@ -679,9 +774,11 @@ public:
 
 	/**
 	 * Calculates which generations should be tenured in the form of a bit mask.
+	 * When the Cost strategy is enabled it replaces the other strategies, as soon as it has history to go by.
+	 * @param env The environment of the thread setting up the scavenge
 	 * @return mask of ages to tenure
 	 */
-	uintptr_t calculateTenureMask();
+	uintptr_t calculateTenureMask(MM_EnvironmentStandard *env);
 
 	/**
 	 * reset LargeAllocateStats in Tenure Space
@@ -1005,6 +1102,7 @@ public:
 		, _rescanThreadsForRememberedObjects(false)
 #endif
 		, _backOutDoneIndex(0)
+		, _hotFieldTable(NULL)
 		, _heapBase(NULL)
 		, _heapTop(NULL)
 		, _regionManager(_extensions->heapRegionManager)
@@ -0,0 +1,181 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#include "ScavengerHotFieldTable.hpp"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include <string.h>
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "ModronAssertions.h"
+
+/**
+ * Fibonacci hashing spreads the consecutive shapes object models tend to report (sizes, class indexes)
+ * across the whole table.
+ */
+#define SCAVENGER_HOT_FIELD_HASH(shape) ((uintptr_t)(((uint64_t)(shape) * 0x9E3779B97F4A7C15ULL) >> 32) & (SCAVENGER_HOT_FIELD_TABLE_SIZE - 1))
+
+MM_ScavengerHotFieldTable *
+MM_ScavengerHotFieldTable::newInstance(MM_EnvironmentBase *env)
+{
+	MM_ScavengerHotFieldTable *table = (MM_ScavengerHotFieldTable *)env->getForge()->allocate(sizeof(MM_ScavengerHotFieldTable), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != table) {
+		new(table) MM_ScavengerHotFieldTable();
+		if (!table->initialize(env)) {
+			table->kill(env);
+			table = NULL;
+		}
+	}
+	return table;
+}
+
+void
+MM_ScavengerHotFieldTable::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_ScavengerHotFieldTable::initialize(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	_entries = (Entry *)extensions->getForge()->allocate(sizeof(Entry) * SCAVENGER_HOT_FIELD_TABLE_SIZE, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _entries) {
+		return false;
+	}
+	memset(_entries, 0, sizeof(Entry) * SCAVENGER_HOT_FIELD_TABLE_SIZE);
+	for (uintptr_t i = 0; i < SCAVENGER_HOT_FIELD_TABLE_SIZE; i++) {
+		memset(_entries[i].hotFields, U_8_MAX, sizeof(_entries[i].hotFields));
+	}
+
+	/* learn as many hot fields as depth copy is configured to follow */
+	if (extensions->depthCopyThreePaths) {
+		_hotFieldCount = 3;
+	} else if (extensions->depthCopyTwoPaths) {
+		_hotFieldCount = 2;
+	} else {
+		_hotFieldCount = 1;
+	}
+
+	return true;
+}
+
+void
+MM_ScavengerHotFieldTable::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _entries) {
+		env->getForge()->free(_entries);
+		_entries = NULL;
+	}
+}
+
+void
+MM_ScavengerHotFieldTable::recordCopiedSlot(uintptr_t shape, uintptr_t slotIndex)
+{
+	Assert_MM_true(0 != shape);
+	Assert_MM_true(slotIndex < SCAVENGER_HOT_FIELD_SLOTS);
+
+	uintptr_t index = SCAVENGER_HOT_FIELD_HASH(shape);
+	for (uintptr_t probe = 0; probe < SCAVENGER_HOT_FIELD_TABLE_PROBES; probe++) {
+		Entry *entry = &_entries[index];
+		uintptr_t entryShape = entry->shape;
+		if (0 == entryShape) {
+			/* claim the free entry, losing the race to a thread claiming it for the same shape is fine too */
+			entryShape = MM_AtomicOperations::lockCompareExchange(&entry->shape, 0, shape);
+			if (0 == entryShape) {
+				entryShape = shape;
+			}
+		}
+		if (shape == entryShape) {
+			entry->copyCounts[slotIndex] += 1;
+			return;
+		}
+		index = (index + 1) & (SCAVENGER_HOT_FIELD_TABLE_SIZE - 1);
+	}
+	/* the neighbourhood of the shape is full, drop the sample */
+}
+
+const uint8_t *
+MM_ScavengerHotFieldTable::getHotFields(uintptr_t shape)
+{
+	uintptr_t index = SCAVENGER_HOT_FIELD_HASH(shape);
+	for (uintptr_t probe = 0; probe < SCAVENGER_HOT_FIELD_TABLE_PROBES; probe++) {
+		Entry *entry = &_entries[index];
+		uintptr_t entryShape = entry->shape;
+		if (shape == entryShape) {
+			return (U_8_MAX == entry->hotFields[0]) ? NULL : entry->hotFields;
+		}
+		if (0 == entryShape) {
+			break;
+		}
+		index = (index + 1) & (SCAVENGER_HOT_FIELD_TABLE_SIZE - 1);
+	}
+	return NULL;
+}
+
+void
+MM_ScavengerHotFieldTable::update(MM_EnvironmentBase *env)
+{
+	uintptr_t learnedShapes = 0;
+
+	for (uintptr_t i = 0; i < SCAVENGER_HOT_FIELD_TABLE_SIZE; i++) {
+		Entry *entry = &_entries[i];
+		if (0 != entry->shape) {
+			/* selection of the hottest slots, in decreasing order of copies */
+			uint8_t hotFields[SCAVENGER_HOT_FIELD_MAX];
+			memset(hotFields, U_8_MAX, sizeof(hotFields));
+			for (uintptr_t n = 0; n < _hotFieldCount; n++) {
+				uint32_t hottestCount = 0;
+				for (uintptr_t slot = 0; slot < SCAVENGER_HOT_FIELD_SLOTS; slot++) {
+					uint32_t count = entry->copyCounts[slot];
+					if ((count > hottestCount) && (NULL == memchr(hotFields, (int)slot, n))) {
+						hottestCount = count;
+						hotFields[n] = (uint8_t)slot;
+					}
+				}
+				if (U_8_MAX == hotFields[n]) {
+					break;
+				}
+			}
+
+			/* a slot keeps half its weight per scavenge, so the table follows phase changes of the application */
+			for (uintptr_t slot = 0; slot < SCAVENGER_HOT_FIELD_SLOTS; slot++) {
+				entry->copyCounts[slot] >>= 1;
+			}
+
+			memcpy(entry->hotFields, hotFields, sizeof(hotFields));
+			if (U_8_MAX != hotFields[0]) {
+				learnedShapes += 1;
+			}
+		}
+	}
+
+	_learnedShapes = learnedShapes;
+}
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
@@ -0,0 +1,115 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(SCAVENGERHOTFIELDTABLE_HPP_)
+#define SCAVENGERHOTFIELDTABLE_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include "BaseVirtual.hpp"
+
+class MM_EnvironmentBase;
+
+#define SCAVENGER_HOT_FIELD_TABLE_SIZE 1024 /**< number of object shapes tracked, a power of 2 */
+#define SCAVENGER_HOT_FIELD_TABLE_PROBES 8 /**< entries probed for a shape before a sample is dropped */
+#define SCAVENGER_HOT_FIELD_SLOTS 32 /**< leading reference slots of an object whose copies are counted */
+#define SCAVENGER_HOT_FIELD_MAX 3 /**< hot fields learned per shape, as many as the object model can supply */
+
+/**
+ * Learns the hot fields of each object shape at runtime for dynamic breadth first scan ordering.
+ * Scavenger threads sample the slots of scanned objects whose referents had to be copied; before each
+ * scavenge the most frequently copied slots of each shape become its hot fields, so that the copy of
+ * a parent is followed by the copy of the children the mutator is most likely to reach from it.
+ * A copied referent stands in for a field the mutator accessed together with its parent: the table
+ * does not observe which fields are actually used consecutively, only which ones lead to live young
+ * objects. Shapes come from the object model (see getObjectShape(), built with OMR_GC_AUTO_HOT_FIELDS).
+ * Counts are updated without synchronization, lost samples only blur the statistics.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ScavengerHotFieldTable : public MM_BaseVirtual
+{
+private:
+	struct Entry {
+		volatile uintptr_t shape; /**< shape this entry learns for, 0 if the entry is unused */
+		uint32_t copyCounts[SCAVENGER_HOT_FIELD_SLOTS]; /**< decayed number of sampled scans in which the referent of each slot was copied */
+		uint8_t hotFields[SCAVENGER_HOT_FIELD_MAX]; /**< slot indexes of the learned hot fields, hottest first, U_8_MAX terminated */
+	};
+
+	Entry *_entries; /**< open addressed table of shapes */
+	uintptr_t _hotFieldCount; /**< number of hot fields learned per shape */
+	uintptr_t _learnedShapes; /**< number of shapes with at least one hot field after the last update */
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_ScavengerHotFieldTable *newInstance(MM_EnvironmentBase *env);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Record that the referent of a slot of an object with the given shape had to be copied.
+	 * @param shape the shape of the scanned object, as reported by the object model
+	 * @param slotIndex index of the slot from the start of the object
+	 */
+	void recordCopiedSlot(uintptr_t shape, uintptr_t slotIndex);
+
+	/**
+	 * Find the learned hot fields of a shape.
+	 * @param shape the shape of the copied object, as reported by the object model
+	 * @return the slot indexes of the hot fields, hottest first and U_8_MAX terminated, or NULL if none were learned
+	 */
+	const uint8_t *getHotFields(uintptr_t shape);
+
+	/**
+	 * Turn the samples gathered so far into hot fields and decay them. Called single threaded between scavenges.
+	 */
+	void update(MM_EnvironmentBase *env);
+
+	/**
+	 * @return number of shapes with at least one hot field after the last update
+	 */
+	MMINLINE uintptr_t getLearnedShapes() const { return _learnedShapes; }
+
+	MM_ScavengerHotFieldTable()
+		: MM_BaseVirtual()
+		, _entries(NULL)
+		, _hotFieldCount(1)
+		, _learnedShapes(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+
+#endif /* SCAVENGERHOTFIELDTABLE_HPP_ */
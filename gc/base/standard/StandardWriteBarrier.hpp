@@ -30,11 +30,43 @@
 #include "EnvironmentStandard.hpp"
 #include "GCExtensionsBase.hpp"
 #include "ObjectModel.hpp"
+#if defined(OMR_GC_REALTIME)
+#include "MarkingScheme.hpp"
+#include "ParallelGlobalGC.hpp"
+#include "RememberedSetSATB.hpp"
+#endif /* defined(OMR_GC_REALTIME) */
 #include "Scavenger.hpp"
 #include "SlotObject.hpp"
 
 struct OMR_VMThread;
 
+/**
+ * Out-of-line pre-write barrier. In the absence of other (equivalent inline) pre-write barrier, this method must
+ * be called whenever a parent slot is about to be overwritten, including when it is cleared.
+ *
+ * While concurrent marking runs with the snapshot-at-the-beginning barrier, the reference about to be overwritten
+ * is marked and remembered, so that every object reachable when marking started is traced.
+ *
+ * @param omrThread The thread making the assignment to the parent slot
+ * @param parentSlot Points to the slot in the parent object that is about to be overwritten
+ */
+MMINLINE void
+standardPreWriteBarrier(OMR_VMThread *omrThread, fomrobject_t *parentSlot)
+{
+#if defined(OMR_GC_REALTIME)
+	MM_EnvironmentStandard *env = MM_EnvironmentStandard::getEnvironment(omrThread);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	if (extensions->isSATBBarrierActive()) {
+		GC_SlotObject slotObject(omrThread->_vm, parentSlot);
+		omrobjectptr_t oldObject = slotObject.readReferenceFromSlot();
+		MM_MarkingScheme *markingScheme = ((MM_ParallelGlobalGC *)extensions->getGlobalCollector())->getMarkingScheme();
+		if ((NULL != oldObject) && markingScheme->markObject(env, oldObject, true)) {
+			extensions->sATBBarrierRememberedSet->storeInFragment(env, &env->_sATBBarrierRememberedSetFragment, (uintptr_t *)oldObject);
+		}
+	}
+#endif /* defined(OMR_GC_REALTIME) */
+}
+
 /**
  * Out-of-line write barrier. In the absence of other (equivalent inline) write barrier, this method must
  * be called whenever a child reference is assigned to a parent slot.
@@ -72,17 +104,20 @@ standardWriteBarrier(OMR_VMThread *omrThread, omrobjectptr_t parentObject, omrob
 
 /**
  * Convenience method to effect the assignment of a child reference to a parent slot and call
- * out-of-line write barrier.
+ * out-of-line pre-write and write barriers.
  *
  * @param omrThread The thread making the assignment of child reference to parent slot
  * @param parentObject the parent object
  * @param parentSlot Points to the slot in the parent object that will receive the child reference
  * @param childObject THe child object reference
+ * @see standardPreWriteBarrier(OMR_VMThread *, fomrobject_t *)
  * @see standardWriteBarrier(OMR_VMThread *, omrobjectptr_t, omrobjectptr_t)
  */
 MMINLINE void
 standardWriteBarrierStore(OMR_VMThread *omrThread, omrobjectptr_t parentObject, fomrobject_t *parentSlot, omrobjectptr_t childObject)
 {
+	standardPreWriteBarrier(omrThread, parentSlot);
+
 	GC_SlotObject slotObject(omrThread->_vm, parentSlot);
 	slotObject.writeReferenceToSlot(childObject);
 
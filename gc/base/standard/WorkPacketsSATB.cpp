@@ -26,6 +26,7 @@
 
 #include "WorkPacketsSATB.hpp"
 
+#include "AtomicOperations.hpp"
 #include "Debug.hpp"
 #include "GCExtensionsBase.hpp"
 #include "OverflowStandard.hpp"
@@ -40,7 +41,7 @@ MM_WorkPacketsSATB::newInstance(MM_EnvironmentBase *env)
 {
 	MM_WorkPacketsSATB *workPackets;
 
-	workPackets = (MM_WorkPacketsSATB *)env->getForge()->allocate(sizeof(MM_WorkPacketsSATB), MM_AllocationCategory::WORK_PACKETS, J9_GET_CALLSITE());
+	workPackets = (MM_WorkPacketsSATB *)env->getForge()->allocate(sizeof(MM_WorkPacketsSATB), MM_AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
 	if (workPackets) {
 		new(workPackets) MM_WorkPacketsSATB(env);
 		if (!workPackets->initialize(env)) {
@@ -140,6 +141,9 @@ MM_WorkPacketsSATB::getPacketByOverflowing(MM_EnvironmentBase *env)
 {
 	MM_Packet *packet = NULL;
 
+	/* Full barrier packets not yet taken by a marking thread can be overflowed too */
+	moveFullBarrierPackets(env);
+
 	if (NULL != (packet = getPacket(env, &_fullPacketList))) {
 		/* Attempt to overflow a full mark packet.
 		 * Move the contents of the packet to overflow.
@@ -179,10 +183,72 @@ MM_WorkPacketsSATB::removePacketFromInUseList(MM_EnvironmentBase *env, MM_Packet
 	_inUseBarrierPacketList.remove(packet);
 }
 
+/**
+ * Publish a full barrier packet. Mutators flush packets under heavy pointer mutation, so rather
+ * than taking a full packet list lock the packet is pushed onto a lock-free stack, from which
+ * marking threads take all packets at once (@see moveFullBarrierPackets). Until then the packet is
+ * invisible to inputPacketAvailable() and tracingExhausted().
+ * @param packet the packet to publish
+ */
 void
 MM_WorkPacketsSATB::putFullPacket(MM_EnvironmentBase *env, MM_Packet *packet)
 {
-	_fullPacketList.push(env, packet);
+	MM_Packet *head = _fullBarrierPackets;
+
+	while (true) {
+		packet->_next = head;
+		MM_Packet *observed = (MM_Packet *)MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&_fullBarrierPackets, (uintptr_t)head, (uintptr_t)packet);
+		if (observed == head) {
+			break;
+		}
+		/* Count only when contended, so the uncontended push stays a single atomic */
+		MM_AtomicOperations::add(&_fullBarrierPacketContention, 1);
+		head = observed;
+	}
+}
+
+bool
+MM_WorkPacketsSATB::moveFullBarrierPackets(MM_EnvironmentBase *env)
+{
+	if (NULL == _fullBarrierPackets) {
+		return false;
+	}
+
+	/* Detach the whole stack. Packets are only ever pushed individually and taken all at once, so there is no ABA hazard */
+	MM_Packet *head = _fullBarrierPackets;
+	MM_Packet *observed = NULL;
+	while (head != (observed = (MM_Packet *)MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&_fullBarrierPackets, (uintptr_t)head, (uintptr_t)NULL))) {
+		head = observed;
+	}
+
+	if (NULL == head) {
+		return false;
+	}
+
+	/* The stack is singly linked; link it back for the packet list */
+	uintptr_t count = 1;
+	MM_Packet *tail = head;
+	head->_previous = NULL;
+	while (NULL != tail->_next) {
+		tail->_next->_previous = tail;
+		tail = tail->_next;
+		count += 1;
+	}
+
+	_fullPacketList.pushList(head, tail, count);
+
+	MM_AtomicOperations::add(&_fullBarrierPacketsMoved, count);
+	MM_AtomicOperations::add(&_fullBarrierPacketBatches, 1);
+
+	return true;
+}
+
+void
+MM_WorkPacketsSATB::resetFullBarrierPacketCounts()
+{
+	_fullBarrierPacketsMoved = 0;
+	_fullBarrierPacketBatches = 0;
+	_fullBarrierPacketContention = 0;
 }
 
 /**
@@ -253,6 +319,8 @@ MM_WorkPacketsSATB::resetAllPackets(MM_EnvironmentBase *env)
 {
 	MM_Packet *packet;
 
+	moveFullBarrierPackets(env);
+
 	while (NULL != (packet = getPacket(env, &_inUseBarrierPacketList))) {
 		packet->resetData(env);
 		putPacket(env, packet);
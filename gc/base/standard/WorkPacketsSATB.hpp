@@ -35,6 +35,10 @@ class MM_WorkPacketsSATB : public MM_WorkPackets
 {
 protected:
 	MM_PacketList _inUseBarrierPacketList;  /**< List for packets currently being used for the remembered set*/
+	MM_Packet * volatile _fullBarrierPackets; /**< Lock-free stack of full barrier packets, pushed by mutators and taken in bulk by marking threads */
+	volatile uintptr_t _fullBarrierPacketsMoved; /**< Number of full barrier packets moved to the full packet list since the last reset */
+	volatile uintptr_t _fullBarrierPacketBatches; /**< Number of bulk moves of full barrier packets since the last reset */
+	volatile uintptr_t _fullBarrierPacketContention; /**< Number of full barrier packet pushes that raced with another push since the last reset */
 
 public:
 	static MM_WorkPacketsSATB *newInstance(MM_EnvironmentBase *env);
@@ -69,6 +73,30 @@ public:
 
 	void moveInUseToNonEmpty(MM_EnvironmentBase *env);
 
+	/**
+	 * Move all full barrier packets pushed by mutators onto the full packet list in a single batch,
+	 * so they are available for processing.
+	 *
+	 * Packets still on the barrier stack are on no packet list: inputPacketAvailable() does not report
+	 * them and tracingExhausted() counts them as neither empty nor input. Every path that decides whether
+	 * concurrent tracing has work left (localMark, the helper and dedicated mark loops, completeConcurrentTracing
+	 * and the stats report) must call this, or check fullBarrierPacketsAvailable(), first.
+	 *
+	 * @return true if any packets were moved, false otherwise
+	 */
+	bool moveFullBarrierPackets(MM_EnvironmentBase *env);
+
+	MMINLINE bool fullBarrierPacketsAvailable()
+	{
+		return (NULL != _fullBarrierPackets);
+	}
+
+	MMINLINE uintptr_t getFullBarrierPacketsMoved() { return _fullBarrierPacketsMoved; }
+	MMINLINE uintptr_t getFullBarrierPacketBatches() { return _fullBarrierPacketBatches; }
+	MMINLINE uintptr_t getFullBarrierPacketContention() { return _fullBarrierPacketContention; }
+
+	void resetFullBarrierPacketCounts();
+
 	void resetAllPackets(MM_EnvironmentBase *env);
 
 #if defined(J9VM_OPT_CRIU_SUPPORT)
@@ -87,6 +115,10 @@ public:
 	MM_WorkPacketsSATB(MM_EnvironmentBase *env) :
 		MM_WorkPackets(env)
 		, _inUseBarrierPacketList(NULL)
+		, _fullBarrierPackets(NULL)
+		, _fullBarrierPacketsMoved(0)
+		, _fullBarrierPacketBatches(0)
+		, _fullBarrierPacketContention(0)
 	{
 		_typeId = __FUNCTION__;
 	};
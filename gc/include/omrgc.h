@@ -37,11 +37,26 @@
 extern "C" {
 #endif
 
+/* An object reported by OMR_GC_IterateHeap() */
+typedef struct OMR_GC_HeapObject {
+	omrobjectptr_t object;
+	uintptr_t size; /* size consumed by the object in the heap, including its header */
+} OMR_GC_HeapObject;
+
+typedef void (*OMR_GC_HeapObjectsFunc)(OMR_VMThread *omrVMThread, const OMR_GC_HeapObject *objects, uintptr_t objectCount, void *userData);
+
 /* Allocation description will be initialized in call */
 omrobjectptr_t OMR_GC_AllocateObject(OMR_VMThread * omrVMThread, uintptr_t allocationCategory, uintptr_t requiredSizeInBytes, uintptr_t objectAllocationFlags);
 
 omr_error_t OMR_GC_SystemCollect(OMR_VMThread* omrVMThread, uint32_t gcCode);
 
+/* Report J9HOOK_MM_OMR_ALLOCATION_SAMPLE every samplingInterval bytes allocated by each thread, or never if 0 */
+omr_error_t OMR_GC_SetAllocationSamplingInterval(OMR_VMThread* omrVMThread, uintptr_t samplingInterval);
+
+/* Report every live object to function in batches of at most batchSize objects. The heap is marked and walked in
+ * parallel by the GC threads under exclusive VM access, and function is called concurrently on each of them. */
+omr_error_t OMR_GC_IterateHeap(OMR_VMThread* omrVMThread, uintptr_t batchSize, OMR_GC_HeapObjectsFunc function, void *userData);
+
 #ifdef __cplusplus
 } /* extern "C" { */
 #endif
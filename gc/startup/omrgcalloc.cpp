@@ -30,6 +30,11 @@
 #include "Heap.hpp"
 #include "omrgcstartup.hpp"
 #include "ModronAssertions.h"
+#if defined(OMR_GC_MODRON_STANDARD)
+#include "ParallelDispatcher.hpp"
+#include "ParallelGlobalGC.hpp"
+#include "ParallelHeapWalker.hpp"
+#endif /* defined(OMR_GC_MODRON_STANDARD) */
 
 omrobjectptr_t
 OMR_GC_AllocateObject(OMR_VMThread * omrVMThread, MM_AllocateInitialization *allocator)
@@ -60,3 +65,54 @@ OMR_GC_SystemCollect(OMR_VMThread* omrVMThread, uint32_t gcCode)
 	}
 	return result;
 }
+
+omr_error_t
+OMR_GC_SetAllocationSamplingInterval(OMR_VMThread* omrVMThread, uintptr_t samplingInterval)
+{
+	omr_error_t result = OMR_ERROR_NONE;
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(omrVMThread->_vm);
+	if (NULL == extensions) {
+		result = OMR_ERROR_NOT_AVAILABLE;
+	} else {
+		extensions->allocationSamplingInterval = samplingInterval;
+	}
+	return result;
+}
+
+omr_error_t
+OMR_GC_IterateHeap(OMR_VMThread* omrVMThread, uintptr_t batchSize, OMR_GC_HeapObjectsFunc function, void *userData)
+{
+	omr_error_t result = OMR_ERROR_NONE;
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(omrVMThread->_vm);
+	if ((0 == batchSize) || (NULL == function)) {
+		result = OMR_ERROR_ILLEGAL_ARGUMENT;
+	} else if ((NULL == extensions) || !extensions->isStandardGC() || extensions->isSegregatedHeap()) {
+		/* only the standard collector provides a parallel heap walker */
+		result = OMR_ERROR_NOT_AVAILABLE;
+	} else {
+#if defined(OMR_GC_MODRON_STANDARD)
+		MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+		if (NULL == extensions->getGlobalCollector()) {
+			result = OMR_GC_InitializeCollector(omrVMThread);
+		}
+		if (OMR_ERROR_NONE == result) {
+			MM_ParallelGlobalGC *globalCollector = (MM_ParallelGlobalGC *)extensions->getGlobalCollector();
+			MM_ParallelHeapWalker *heapWalker = (MM_ParallelHeapWalker *)globalCollector->getHeapWalker();
+			uintptr_t threadCount = extensions->dispatcher->threadCountMaximum();
+			if (batchSize > (UDATA_MAX / (threadCount * sizeof(OMR_GC_HeapObject)))) {
+				/* each GC thread gets its own batch, and the batches are allocated together */
+				result = OMR_ERROR_ILLEGAL_ARGUMENT;
+			} else {
+				env->acquireExclusiveVMAccess();
+				if (!heapWalker->allObjectBatchesDo(env, function, userData, batchSize, MEMORY_TYPE_RAM)) {
+					result = OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+				}
+				env->releaseExclusiveVMAccess();
+			}
+		}
+#else /* defined(OMR_GC_MODRON_STANDARD) */
+		result = OMR_ERROR_NOT_AVAILABLE;
+#endif /* defined(OMR_GC_MODRON_STANDARD) */
+	}
+	return result;
+}
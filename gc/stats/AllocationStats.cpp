@@ -39,6 +39,9 @@ MM_AllocationStats::clear()
 	_tlhRequestedBytes = 0;
 	_tlhDiscardedBytes = 0;
 	_tlhMaxAbandonedListSize = 0;
+	_tlhFlushedBytes = 0;
+	_tlhZeroedAheadBytes = 0;
+	_tlhZeroedOnDemandBytes = 0;
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 
 	_arrayletLeafAllocationCount = 0;
@@ -64,6 +67,9 @@ MM_AllocationStats::merge(MM_AllocationStats *stats)
 	MM_AtomicOperations::add(&_tlhRequestedBytes, stats->_tlhRequestedBytes);
 	MM_AtomicOperations::add(&_tlhDiscardedBytes, stats->_tlhDiscardedBytes);
 	MM_AtomicOperations::add(&_tlhAllocatedReused, stats->_tlhAllocatedReused);
+	MM_AtomicOperations::add(&_tlhFlushedBytes, stats->_tlhFlushedBytes);
+	MM_AtomicOperations::add(&_tlhZeroedAheadBytes, stats->_tlhZeroedAheadBytes);
+	MM_AtomicOperations::add(&_tlhZeroedOnDemandBytes, stats->_tlhZeroedOnDemandBytes);
 	/* looping to set a maximum value in _tlhMaxAbandonedListSize */
 	for (
 			uintptr_t prevMax = _tlhMaxAbandonedListSize;
@@ -42,6 +42,9 @@ public:
 	uintptr_t _tlhRequestedBytes; 		/**< The amount of memory requested for refreshes. */
 	uintptr_t _tlhDiscardedBytes; 		/**< The amount of memory from discarded TLHs. */
 	uintptr_t _tlhMaxAbandonedListSize; /**< The maximum size of the abandoned list. */
+	uintptr_t _tlhFlushedBytes; 		/**< The amount of unused memory at the top of TLHs when they were flushed (for example for a collection). */
+	uintptr_t _tlhZeroedAheadBytes; 	/**< The amount of batch cleared TLH memory that was zeroed ahead by the TLH zeroing thread. */
+	uintptr_t _tlhZeroedOnDemandBytes; 	/**< The amount of batch cleared TLH memory that was zeroed by the allocating thread on refresh. */
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 
 	uintptr_t _arrayletLeafAllocationCount;	/**< Number of arraylet leaf allocations */
@@ -109,6 +112,9 @@ public:
 		_tlhRequestedBytes(0),
 		_tlhDiscardedBytes(0),
 		_tlhMaxAbandonedListSize(0),
+		_tlhFlushedBytes(0),
+		_tlhZeroedAheadBytes(0),
+		_tlhZeroedOnDemandBytes(0),
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 		_arrayletLeafAllocationCount(0),
 		_arrayletLeafAllocationBytes(0),
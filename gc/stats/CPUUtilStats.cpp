@@ -31,6 +31,7 @@
 
 #include "CollectionStatistics.hpp"
 #include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
 #include "ModronAssertions.h"
 
 void
@@ -71,6 +72,9 @@ MM_CPUUtilStats::recordProcessAndCpuUtilization(MM_EnvironmentBase *env, MM_Coll
 		_processUserTime = stats->_endProcessTimes._userTime;
 		_processSystemTime = stats->_endProcessTimes._systemTime;
 		_cpuTime = cpuTime.cpuTime;
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+		_concurrentMarkCPUTime = env->getExtensions()->concurrentMarkDedicatedCPUTime;
+#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
 
 		/* Expose CPU stats data to the higher level stats struct (but with Collector specific instance), so it can be accessible via hooks */
 		stats->_cpuUtilStats = *this;
@@ -149,6 +153,10 @@ MM_CPUUtilStats::calculateProcessAndCpuUtilizationDelta(MM_EnvironmentBase *env,
 
 		_avgCpuUtil = MM_Math::weightedAverage(_avgCpuUtil, cpuTimeDiff / (float)elapsedTime, 1.0f - utilWeight);
 		_avgProcUtil = MM_Math::weightedAverage(_avgProcUtil, processTimeDiff / (float)elapsedTime, 1.0f - utilWeight);
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+		uint64_t concurrentMarkTimeDiff = env->getExtensions()->concurrentMarkDedicatedCPUTime - _concurrentMarkCPUTime;
+		_avgConcurrentMarkUtil = MM_Math::weightedAverage(_avgConcurrentMarkUtil, OMR_MIN(concurrentMarkTimeDiff / (float)elapsedTime, 1.0f), 1.0f - utilWeight);
+#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
 
 		/* Expose CPU stats data to the higher level stats struct (but with Collector specific instance), so it can be accessible via hooks */
 		stats->_cpuUtilStats = *this;
@@ -47,9 +47,11 @@ public:
 	int64_t _processSystemTime; /**< process system time snapshot at the start of measurement, at GC start */
 	int64_t _cpuTime; /**< cpu time snapshot at the start of measurement, at GC start */
 	uint64_t _elapsedTime; /*< wall clock TS at the start of measurement, at GC start */
+	uint64_t _concurrentMarkCPUTime; /**< dedicated concurrent mark threads CPU time snapshot at the start of measurement, in microseconds */
 	float _avgProcUtil; /**< historically averaged values of process (user + system) times */
 	float _avgCpuUtil; /**< historically averaged values of cpu time */
 	float _avgInterval; /**< historically averaged values of intervals between GCs */
+	float _avgConcurrentMarkUtil; /**< historically averaged values of dedicated concurrent mark threads CPU time */
 	bool _validData; /**< true, if both start and end points have valid data (no system calls failed) */
 
 	MM_CPUUtilStats() :
@@ -58,9 +60,11 @@ public:
 		,_processSystemTime(0)
 		,_cpuTime(0)
 		,_elapsedTime(0)
+		,_concurrentMarkCPUTime(0)
 		,_avgProcUtil(0.0)
 		,_avgCpuUtil(0.0)
 		,_avgInterval(0.0)
+		,_avgConcurrentMarkUtil(0.0)
 		,_validData(false)
 	{}
 
@@ -32,6 +32,9 @@ MM_CardCleaningStats::clear()
 {
 	_cardCleaningTime = 0;
 	_cardsCleaned = 0;
+	for (uintptr_t i = 0; i < CARD_CLEAN_RUN_HISTOGRAM_BUCKETS; i++) {
+		_cleanRunHistogram[i] = 0;
+	}
 }
 
 void
@@ -39,4 +42,7 @@ MM_CardCleaningStats::merge(MM_CardCleaningStats *statsToMerge)
 {
 	_cardCleaningTime += statsToMerge->_cardCleaningTime;
 	_cardsCleaned += statsToMerge->_cardsCleaned;
+	for (uintptr_t i = 0; i < CARD_CLEAN_RUN_HISTOGRAM_BUCKETS; i++) {
+		_cleanRunHistogram[i] += statsToMerge->_cleanRunHistogram[i];
+	}
 }
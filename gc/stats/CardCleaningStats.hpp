@@ -28,12 +28,18 @@
 
 #include "Base.hpp"
 
+/**
+ * Buckets of the clean run histogram: dirty cards found after 0, 1-15, 16-255, 256-4095 and 4096 or more clean cards.
+ */
+#define CARD_CLEAN_RUN_HISTOGRAM_BUCKETS 5
+
 class MM_CardCleaningStats : public MM_Base
 {
 /* Data Members */
 public:
 	uint64_t _cardCleaningTime; /**< Time spent cleaning cards in hi-res clock resolution. */
 	uintptr_t _cardsCleaned; /**< The number of cards cleaned */
+	uintptr_t _cleanRunHistogram[CARD_CLEAN_RUN_HISTOGRAM_BUCKETS]; /**< Dirty cards found, by the length of the run of clean cards skipped to find them (the card table density) */
 	
 /* Function Members */
 public:
@@ -49,6 +55,20 @@ public:
 	 * @param endTime The time scanning ended, measured by omrtime_hires_clock()
 	 */
 	MMINLINE void addToCardCleaningTime(uint64_t startTime, uint64_t endTime) { _cardCleaningTime += (endTime - startTime);	}
+
+	/**
+	 * Record a dirty card found by card cleaning.
+	 * @param cleanCards The number of clean cards skipped before the dirty card was found
+	 */
+	MMINLINE void recordCleanRun(uintptr_t cleanCards)
+	{
+		uintptr_t bucket = 0;
+		while ((0 != cleanCards) && (bucket < (CARD_CLEAN_RUN_HISTOGRAM_BUCKETS - 1))) {
+			bucket += 1;
+			cleanCards >>= 4;
+		}
+		_cleanRunHistogram[bucket] += 1;
+	}
 	
 	/**
 	 * Merges the results from the input MM_CardCleaningStats with the statistics contained within the receiver.
@@ -50,6 +50,9 @@ public:
 	uintptr_t _movedObjects;
 	uintptr_t _movedBytes;
 	uintptr_t _fixupObjects;
+	uintptr_t _incrementSubAreas; /**< sub areas evacuated by an incremental compaction, 0 if the whole heap was compacted */
+	uintptr_t _incrementFragmentedBytes; /**< free bytes below the last live object of the evacuated sub areas, before the move */
+	uintptr_t _incrementLiveBytes; /**< live bytes of all sub areas, which a full compaction would have to move */
 	uint64_t _setupStartTime;
 	uint64_t _setupEndTime;
 	uint64_t _moveStartTime;
@@ -28,6 +28,7 @@
 
 #include "AtomicOperations.hpp"
 #include "Base.hpp"
+#include "CardCleaningStats.hpp"
 
 #define HIGH_VALUES (uintptr_t)(-1)
 /**
@@ -49,6 +50,8 @@ public:
 	volatile uintptr_t finalCleanedCardsPhase2;
 	
 	volatile uintptr_t concurrentCleanedCardsPhase3;
+
+	volatile uintptr_t cleanRunHistogram[CARD_CLEAN_RUN_HISTOGRAM_BUCKETS]; /**< Dirty cards cleaned this cycle, by the length of the run of clean cards before them */
 	
 	MMINLINE void setCount(volatile uintptr_t &counter, uintptr_t count) 
 	{ 
@@ -75,6 +78,24 @@ public:
 		/* Final card cleaning counts */
 		setCount(finalCleanedCardsPhase1, 0);
 		setCount(finalCleanedCardsPhase2, 0);
+
+		for (uintptr_t i = 0; i < CARD_CLEAN_RUN_HISTOGRAM_BUCKETS; i++) {
+			setCount(cleanRunHistogram[i], 0);
+		}
+	}
+
+	/**
+	 * Move the clean run histogram gathered by a card cleaning thread into the totals for the cycle.
+	 * @param[in] threadStats Card cleaning statistics of the thread; its histogram is cleared
+	 */
+	MMINLINE void flushCleanRunHistogram(MM_CardCleaningStats *threadStats)
+	{
+		for (uintptr_t i = 0; i < CARD_CLEAN_RUN_HISTOGRAM_BUCKETS; i++) {
+			if (0 != threadStats->_cleanRunHistogram[i]) {
+				incrementCount(cleanRunHistogram[i], threadStats->_cleanRunHistogram[i]);
+				threadStats->_cleanRunHistogram[i] = 0;
+			}
+		}
 	}
 	
 	MMINLINE void setCardCleaningPhase1Kickoff(uintptr_t kickoff) { _cardCleaningPhase1Kickoff = kickoff; };
@@ -130,7 +151,11 @@ public:
 		concurrentCleanedCardsPhase2(0),
 		finalCleanedCardsPhase2(0),
 		concurrentCleanedCardsPhase3(0)
-	{};
+	{
+		for (uintptr_t i = 0; i < CARD_CLEAN_RUN_HISTOGRAM_BUCKETS; i++) {
+			cleanRunHistogram[i] = 0;
+		}
+	};
 };
 
 #endif /* CARDTABLESTATS_HPP_ */
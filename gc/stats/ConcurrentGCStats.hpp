@@ -67,6 +67,13 @@ class MM_ConcurrentGCStats : public MM_Base
 	volatile uintptr_t _RSObjectsFound;
 	volatile uintptr_t _threadsScannedCount;
 	uintptr_t _threadsToScanCount;
+	volatile uint64_t _dedicatedMarkCPUTime; /**< CPU time, in microseconds, used by dedicated concurrent mark threads */
+	uint64_t _dedicatedMarkElapsedTime; /**< wall time, in microseconds, the dedicated concurrent mark threads were dispatched for */
+	uintptr_t _dedicatedMarkThreads; /**< number of dedicated concurrent mark threads dispatched, 0 if mutators are taxed */
+	float _dedicatedMarkCPUs; /**< number of CPUs the dedicated concurrent mark threads may use */
+	uintptr_t _barrierPacketsFlushed; /**< number of full SATB barrier packets handed to the marking threads */
+	uintptr_t _barrierPacketBatches; /**< number of batches the full SATB barrier packets were handed over in */
+	uintptr_t _barrierPacketFlushContention; /**< number of times a mutator retried publishing a full SATB barrier packet */
 	
 	bool _concurrentWorkStackOverflowOcurred;
 	uintptr_t _concurrentWorkStackOverflowCount;
@@ -75,6 +82,12 @@ class MM_ConcurrentGCStats : public MM_Base
 	
 	ConcurrentKickoffReason _kickoffReason; /**< a constant indicating why kickoff occured */
 	ConcurrentCardCleaningReason _cardCleaningReason; /**< a constant indicating why card cleaning was kicked off */
+
+	float _pacingKickoffScale; /**< factor the pacer applied to the kickoff threshold, 0 if the cycle is not paced */
+	float _pacingConHelperTraceRate; /**< predicted bytes traced by concurrent helpers per taxable byte allocated */
+	uintptr_t _pacingAllocationRate; /**< predicted taxable bytes allocated per millisecond during concurrent mark */
+	uintptr_t _pacingMarkRate; /**< predicted bytes marked concurrently per millisecond */
+	uintptr_t _pacingUnpacedKickoffThreshold; /**< kickoff threshold the cycle would have used without pacing */
 	
 public:
 	static const char* getConcurrentStatusString(MM_EnvironmentBase *env, uintptr_t status, char *statusBuffer, uintptr_t statusBufferLength);
@@ -201,6 +214,28 @@ public:
 	MMINLINE uintptr_t getThreadsToScanCount() { return _threadsToScanCount; };
 	MMINLINE void incThreadsScannedCount() { incrementCount((uintptr_t*)&_threadsScannedCount, 1); };
 	MMINLINE uintptr_t getThreadsScannedCount() { return _threadsScannedCount; };
+
+	MMINLINE void incDedicatedMarkCPUTime(uint64_t increment) { MM_AtomicOperations::addU64(&_dedicatedMarkCPUTime, increment); };
+	MMINLINE uint64_t getDedicatedMarkCPUTime() { return _dedicatedMarkCPUTime; };
+	MMINLINE void incDedicatedMarkElapsedTime(uint64_t increment) { _dedicatedMarkElapsedTime += increment; };
+	MMINLINE uint64_t getDedicatedMarkElapsedTime() { return _dedicatedMarkElapsedTime; };
+	MMINLINE void setDedicatedMark(uintptr_t threads, float cpus)
+	{
+		_dedicatedMarkThreads = threads;
+		_dedicatedMarkCPUs = cpus;
+	}
+	MMINLINE uintptr_t getDedicatedMarkThreads() { return _dedicatedMarkThreads; };
+	MMINLINE float getDedicatedMarkCPUs() { return _dedicatedMarkCPUs; };
+
+	MMINLINE void setBarrierPacketStats(uintptr_t flushed, uintptr_t batches, uintptr_t contention)
+	{
+		_barrierPacketsFlushed = flushed;
+		_barrierPacketBatches = batches;
+		_barrierPacketFlushContention = contention;
+	};
+	MMINLINE uintptr_t getBarrierPacketsFlushed() { return _barrierPacketsFlushed; };
+	MMINLINE uintptr_t getBarrierPacketBatches() { return _barrierPacketBatches; };
+	MMINLINE uintptr_t getBarrierPacketFlushContention() { return _barrierPacketFlushContention; };
 	
 	MMINLINE bool isRootTracingComplete() { return (_completedModes & CONCURRENT_ROOT_TRACING) == CONCURRENT_ROOT_TRACING; };
 	MMINLINE void setModeComplete(ConcurrentStatus mode) {
@@ -213,6 +248,20 @@ public:
 	
 	MMINLINE void setCardCleaningReason(ConcurrentCardCleaningReason reason) { _cardCleaningReason = reason; };
 	MMINLINE ConcurrentCardCleaningReason getCardCleaningReason() { return _cardCleaningReason; };
+
+	MMINLINE void setPacing(float kickoffScale, float conHelperTraceRate, uintptr_t allocationRate, uintptr_t markRate, uintptr_t unpacedKickoffThreshold)
+	{
+		_pacingKickoffScale = kickoffScale;
+		_pacingConHelperTraceRate = conHelperTraceRate;
+		_pacingAllocationRate = allocationRate;
+		_pacingMarkRate = markRate;
+		_pacingUnpacedKickoffThreshold = unpacedKickoffThreshold;
+	}
+	MMINLINE float getPacingKickoffScale() { return _pacingKickoffScale; };
+	MMINLINE float getPacingConHelperTraceRate() { return _pacingConHelperTraceRate; };
+	MMINLINE uintptr_t getPacingAllocationRate() { return _pacingAllocationRate; };
+	MMINLINE uintptr_t getPacingMarkRate() { return _pacingMarkRate; };
+	MMINLINE uintptr_t getPacingUnpacedKickoffThreshold() { return _pacingUnpacedKickoffThreshold; };
 	
 	MMINLINE void reset()
 	{
@@ -227,6 +276,13 @@ public:
 		clearCount((uintptr_t *)&_RSObjectsFound);
 		clearCount((uintptr_t *)&_threadsScannedCount);
 		clearCount(&_threadsToScanCount);
+		MM_AtomicOperations::setU64(&_dedicatedMarkCPUTime, 0);
+		_dedicatedMarkElapsedTime = 0;
+		_dedicatedMarkThreads = 0;
+		_dedicatedMarkCPUs = 0.0f;
+		_barrierPacketsFlushed = 0;
+		_barrierPacketBatches = 0;
+		_barrierPacketFlushContention = 0;
 		_completedModes = 0;
 		_cardCleaningReason = CARD_CLEANING_REASON_NONE;
 	};
@@ -260,11 +316,23 @@ public:
 		_RSObjectsFound(0),
 		_threadsScannedCount(0),
 		_threadsToScanCount(0),
+		_dedicatedMarkCPUTime(0),
+		_dedicatedMarkElapsedTime(0),
+		_dedicatedMarkThreads(0),
+		_dedicatedMarkCPUs(0.0f),
+		_barrierPacketsFlushed(0),
+		_barrierPacketBatches(0),
+		_barrierPacketFlushContention(0),
 		_concurrentWorkStackOverflowOcurred(false),
 		_concurrentWorkStackOverflowCount(0),
 		_completedModes(0),
 		_kickoffReason(NO_KICKOFF_REASON),
-		_cardCleaningReason(CARD_CLEANING_REASON_NONE)
+		_cardCleaningReason(CARD_CLEANING_REASON_NONE),
+		_pacingKickoffScale(0.0f),
+		_pacingConHelperTraceRate(0.0f),
+		_pacingAllocationRate(0),
+		_pacingMarkRate(0),
+		_pacingUnpacedKickoffThreshold(0)
 	{}
 
 };
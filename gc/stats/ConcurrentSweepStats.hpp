@@ -57,6 +57,7 @@ public:
 
 	uintptr_t _totalChunkCount;  /**< Total number of chunks included in the concurrent sweep calculation */
 	volatile uintptr_t _totalChunkSweptCount;  /**< Total number of chunks that have been swept through concurrent sweep */
+	volatile uintptr_t _lazyBytesSwept;  /**< Bytes swept outside of a pause, by allocating threads and background helpers */
 	/**
 	 * @}
 	 */
@@ -143,6 +144,7 @@ public:
 	MMINLINE void clear() {
 		_totalChunkCount = 0;
 		_totalChunkSweptCount = 0;
+		_lazyBytesSwept = 0;
 		_minimumFreeEntryBytesSwept = 0;
 		_minimumFreeEntryBytesConnected = 0;
 		_concurrentCompleteSweepTimeStart = 0;
@@ -161,6 +163,7 @@ public:
 		_mode(concurrentsweep_mode_off),
 		_totalChunkCount(0),
 		_totalChunkSweptCount(0),
+		_lazyBytesSwept(0),
 		_minimumFreeEntryBytesSwept(0),
 		_minimumFreeEntryBytesConnected(0),
 		_concurrentCompleteSweepTimeStart(0),
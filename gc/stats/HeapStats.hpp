@@ -38,6 +38,7 @@ public:
 	uintptr_t _allocBytes;
 	uintptr_t _allocDiscardedBytes;
 	uintptr_t _allocSearchCount;
+	uintptr_t _allocSizeClassIndexCount; /**< Number of allocates whose free list walk was started further ahead by the size class index */
 	
 	/* Number of bytes free at end of last GC */
 	uintptr_t _lastFreeBytes;
@@ -54,6 +55,7 @@ public:
 		_allocBytes(0),
 		_allocDiscardedBytes(0),
 		_allocSearchCount(0),
+		_allocSizeClassIndexCount(0),
 		_lastFreeBytes(0),
 		_activeFreeEntryCount(0),
 		_inactiveFreeEntryCount(0)
@@ -35,12 +35,16 @@ MM_MarkStats::clear()
 	_objectsMarked = 0;
 	_objectsScanned = 0;
 	_bytesScanned = 0;
+	_prefetchRingHits = 0;
+	_prefetchRingMisses = 0;
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	_syncStallCount = 0;
 	_syncStallTime = 0;
 	_splitArraysProcessed = 0;
 	_splitArraysAmount = 0;
+	_packetsAcquiredLocal = 0;
+	_packetsAcquiredRemote = 0;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 }
 
@@ -52,6 +56,8 @@ MM_MarkStats::merge(MM_MarkStats *statsToMerge)
 	_objectsMarked += statsToMerge->_objectsMarked;
 	_objectsScanned += statsToMerge->_objectsScanned;
 	_bytesScanned += statsToMerge->_bytesScanned;
+	_prefetchRingHits += statsToMerge->_prefetchRingHits;
+	_prefetchRingMisses += statsToMerge->_prefetchRingMisses;
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	/* It may not ever be useful to merge these stats, but do it anyways */
@@ -59,6 +65,8 @@ MM_MarkStats::merge(MM_MarkStats *statsToMerge)
 	_syncStallTime += statsToMerge->_syncStallTime;
 	_splitArraysProcessed += statsToMerge->_splitArraysProcessed;
 	_splitArraysAmount += statsToMerge->_splitArraysAmount;
+	_packetsAcquiredLocal += statsToMerge->_packetsAcquiredLocal;
+	_packetsAcquiredRemote += statsToMerge->_packetsAcquiredRemote;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 }
 
@@ -48,12 +48,16 @@ public:
 	uintptr_t _objectsMarked;  /**< The number of objects found through scanning during marking */
 	uintptr_t _objectsScanned;  /**< The number of objects popped and scanned during marking (e.g., non-base type arrays) */
 	uintptr_t _bytesScanned; /**< The number of bytes scanned by the owning thread (or globally) during marking */
+	uintptr_t _prefetchRingHits; /**< The number of objects scanned after a full prefetch ring of other objects was queued behind them */
+	uintptr_t _prefetchRingMisses; /**< The number of objects scanned through the prefetch ring before it was full (the prefetch had less time to complete) */
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	uintptr_t _syncStallCount; /**< The number of times the thread stalled at a sync point */
 	uint64_t _syncStallTime; /**< The time, in hi-res ticks, the thread spent stalled at a sync point */
 	uintptr_t _splitArraysProcessed; /**< The number of array chunks (not counting parts smaller than the split size) processed by this thread */
 	uintptr_t _splitArraysAmount;
+	uintptr_t _packetsAcquiredLocal; /**< The number of work packets this thread took from sublists of its own NUMA node */
+	uintptr_t _packetsAcquiredRemote; /**< The number of work packets this thread had to take from sublists of another NUMA node */
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
 	uint64_t _startTime;	/**< Mark start time */
@@ -110,11 +114,15 @@ public:
 		,_objectsMarked(0)
 		,_objectsScanned(0)
 		,_bytesScanned(0)
+		,_prefetchRingHits(0)
+		,_prefetchRingMisses(0)
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 		,_syncStallCount(0)
 		,_syncStallTime(0)
 		,_splitArraysProcessed(0)
 		,_splitArraysAmount(0)
+		,_packetsAcquiredLocal(0)
+		,_packetsAcquiredRemote(0)
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 		,_startTime(0)
 		,_endTime(0)
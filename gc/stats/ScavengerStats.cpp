@@ -44,6 +44,10 @@ MM_ScavengerStats::MM_ScavengerStats()
 	,_failedFlipCount(0)
 	,_failedFlipBytes(0)
 	,_tenureAge(0)
+	,_tenureCostAge(0)
+	,_tenureCostCopyBytes(0)
+	,_tenureCostGarbageBytes(0)
+	,_tenureCostSurvivorBytes(0)
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	,_releaseScanListCount(0)
 	,_acquireFreeListCount(0)
@@ -77,6 +81,12 @@ MM_ScavengerStats::MM_ScavengerStats()
 #if defined(OMR_GC_LARGE_OBJECT_AREA)	
 	,_avgTenureLOABytes(0)
 #endif /* OMR_GC_LARGE_OBJECT_AREA */
+	,_nonTemporalCopyBytes(0)
+	,_chunkedCopyBytes(0)
+	,_chunkedCopyHelpedBytes(0)
+	,_hotFieldSampledObjects(0)
+	,_hotFieldLearnedShapes(0)
+	,_hotFieldDepthCopies(0)
 	,_flipDiscardBytes(0)
 	,_tenureDiscardBytes(0)
 	,_survivorTLHRemainderCount(0)
@@ -158,6 +168,10 @@ MM_ScavengerStats::clear(bool firstIncrement)
 	_failedFlipCount = 0;
 	_failedFlipBytes = 0;
 	_tenureAge = 0;
+	_tenureCostAge = 0;
+	_tenureCostCopyBytes = 0;
+	_tenureCostGarbageBytes = 0;
+	_tenureCostSurvivorBytes = 0;
 	_nextScavengeWillPercolate = false;
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	_releaseScanListCount = 0;
@@ -182,6 +196,14 @@ MM_ScavengerStats::clear(bool firstIncrement)
 	/* NOTE: _startTime and _endTime are also not cleared
 	 * as they are recorded before/after all stat clearing/gathering.
 	 */
+	_nonTemporalCopyBytes = 0;
+	_chunkedCopyBytes = 0;
+	_chunkedCopyHelpedBytes = 0;
+
+	_hotFieldSampledObjects = 0;
+	_hotFieldLearnedShapes = 0;
+	_hotFieldDepthCopies = 0;
+
 	_flipDiscardBytes = 0;
 	_tenureDiscardBytes = 0;
 
@@ -75,6 +75,10 @@ public:
 	uintptr_t _failedFlipCount;
 	uintptr_t _failedFlipBytes;
 	uintptr_t _tenureAge;
+	uintptr_t _tenureCostAge; /**< The tenure age chosen by the Cost tenure strategy, 0 if it did not choose one */
+	uintptr_t _tenureCostCopyBytes; /**< Bytes per scavenge the Cost tenure strategy projects to copy at its chosen age */
+	uintptr_t _tenureCostGarbageBytes; /**< Bytes per scavenge the Cost tenure strategy projects to tenure and later die at its chosen age */
+	uintptr_t _tenureCostSurvivorBytes; /**< Bytes per scavenge the Cost tenure strategy projects to flip into survivor space at its chosen age */
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	uintptr_t _releaseScanListCount;
 	uintptr_t _acquireFreeListCount;
@@ -124,6 +128,14 @@ public:
 	uintptr_t _avgTenureLOABytes;
 #endif /* OMR_GC_LARGE_OBJECT_AREA */
 
+	uintptr_t _nonTemporalCopyBytes; /**< Bytes of surviving objects copied with streaming stores by a single thread, chunked copies are only counted in _chunkedCopyBytes */
+	uintptr_t _chunkedCopyBytes; /**< Bytes of surviving objects whose copy was split into chunks shared with idle threads */
+	uintptr_t _chunkedCopyHelpedBytes; /**< Bytes of chunked copies done by threads other than the one that forwarded the object */
+
+	uintptr_t _hotFieldSampledObjects; /**< Objects whose copied slots were sampled to learn hot fields */
+	uintptr_t _hotFieldLearnedShapes; /**< Object shapes with learned hot fields at the start of the scavenge */
+	uintptr_t _hotFieldDepthCopies; /**< Copied objects whose learned hot fields were depth copied */
+
 	uintptr_t _flipDiscardBytes;		/**< Bytes of survivor discarded by copy scan cache */
 	uintptr_t _tenureDiscardBytes;		/**< Bytes of tenure discarded by copy scan cache */
 
@@ -47,6 +47,9 @@ public:
 	uintptr_t workPacketsAcquired;
 	uintptr_t workPacketsReleased;
 	uintptr_t workPacketsExchanged; /**< The number of output packets converted into input packets without being returned to the shared pool first */
+	uintptr_t workStealAttempts; /**< The number of work-stealing deques probed by the thread while looking for work */
+	uintptr_t workStealSuccesses; /**< The number of work items taken from other threads' work-stealing deques */
+	uintptr_t workStealingDonations; /**< The number of times the thread moved part of its own deque into a shared packet for waiting threads */
 	uintptr_t _workStallCount; /**< The number of times the thread stalled, and subsequently received more work */
 	uintptr_t _completeStallCount; /**< The number of times the thread stalled, and waited for all other threads to complete working */
 	uint64_t _workStallTime; /**< The time, in hi-res ticks, the thread spent stalled waiting to receive more work */
@@ -73,6 +76,9 @@ public:
 		workPacketsAcquired = 0;
 		workPacketsReleased = 0;
 		workPacketsExchanged = 0;
+		workStealAttempts = 0;
+		workStealSuccesses = 0;
+		workStealingDonations = 0;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 	}
 
@@ -91,6 +97,9 @@ public:
 		workPacketsAcquired += statsToMerge->workPacketsAcquired;
 		workPacketsReleased += statsToMerge->workPacketsReleased;
 		workPacketsExchanged += statsToMerge->workPacketsExchanged;
+		workStealAttempts += statsToMerge->workStealAttempts;
+		workStealSuccesses += statsToMerge->workStealSuccesses;
+		workStealingDonations += statsToMerge->workStealingDonations;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 	}
 
@@ -147,6 +156,9 @@ public:
 		,workPacketsAcquired(0)
 		,workPacketsReleased(0)
 		,workPacketsExchanged(0)
+		,workStealAttempts(0)
+		,workStealSuccesses(0)
+		,workStealingDonations(0)
 		,_workStallCount(0)
 		,_completeStallCount(0)
 		,_workStallTime(0)
@@ -0,0 +1,97 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#if !defined(VERBOSEBINARYFORMAT_H_)
+#define VERBOSEBINARYFORMAT_H_
+
+/*
+ * Layout of the binary verbose GC log written by MM_VerboseWriterFileLoggingBinary and read back by
+ * the vgcdecode tool. A log is an OMR_VerboseBinaryFileHeader followed by fixed size records in the
+ * byte order of the writing process. Types, collector phases and resize reasons are not stored as
+ * text in the records but as codes into a dictionary which the log carries in its STRING records,
+ * so a decoder needs no knowledge of the collector that produced it.
+ *
+ * This header is shared with tools which do not link against OMR, so it depends only on stdint.h.
+ */
+
+#include <stdint.h>
+
+#define OMR_VERBOSE_BINARY_MAGIC ((uint32_t)0x4F564742) /* "OVGB" */
+#define OMR_VERBOSE_BINARY_VERSION 1
+#define OMR_VERBOSE_BINARY_GC_VERSION_LENGTH 64
+#define OMR_VERBOSE_BINARY_STRING_LENGTH 64
+#define OMR_VERBOSE_BINARY_DATA_SLOTS 8
+#define OMR_VERBOSE_BINARY_MAX_STRINGS 64
+
+/* Record types */
+#define OMR_VERBOSE_BINARY_RECORD_STRING 1 /**< dictionary entry: code is the string code, payload.string its text */
+#define OMR_VERBOSE_BINARY_RECORD_CYCLE_START 2 /**< code: cycle type; data[0]: interval since the previous cycle of the type in us */
+#define OMR_VERBOSE_BINARY_RECORD_CYCLE_END 3 /**< code: cycle type */
+#define OMR_VERBOSE_BINARY_RECORD_GC_START 4 /**< code: cycle type; followed by a MEM_INFO record */
+#define OMR_VERBOSE_BINARY_RECORD_GC_END 5 /**< code: cycle type; data[0..4]: duration, user, system and stall time in us, active threads; followed by a MEM_INFO record */
+#define OMR_VERBOSE_BINARY_RECORD_MEM_INFO 6 /**< heap snapshot, see OMR_VERBOSE_BINARY_MEM_* */
+#define OMR_VERBOSE_BINARY_RECORD_GC_OP 7 /**< code: operation; data[0]: time in us; mark adds data[1..3]: objects marked, objects scanned, bytes scanned */
+#define OMR_VERBOSE_BINARY_RECORD_HEAP_RESIZE 8 /**< code: resize type; see OMR_VERBOSE_BINARY_RESIZE_* */
+#define OMR_VERBOSE_BINARY_RECORD_DROPPED 9 /**< data[0]: records dropped because the ring was full */
+
+/* Record flags */
+#define OMR_VERBOSE_BINARY_FLAG_CLOCK_ERROR 0x1 /**< a timing in the record is suspect */
+#define OMR_VERBOSE_BINARY_FLAG_NURSERY 0x2 /**< MEM_INFO: the nursery fields are valid */
+#define OMR_VERBOSE_BINARY_FLAG_TRACE_INFO 0x4 /**< GC_OP: data[1..3] hold the mark trace counts */
+
+/* MEM_INFO data slots */
+#define OMR_VERBOSE_BINARY_MEM_FREE 0
+#define OMR_VERBOSE_BINARY_MEM_TOTAL 1
+#define OMR_VERBOSE_BINARY_MEM_NURSERY_FREE 2
+#define OMR_VERBOSE_BINARY_MEM_NURSERY_TOTAL 3
+#define OMR_VERBOSE_BINARY_MEM_TENURE_FREE 4
+#define OMR_VERBOSE_BINARY_MEM_TENURE_TOTAL 5
+
+/* HEAP_RESIZE data slots */
+#define OMR_VERBOSE_BINARY_RESIZE_AMOUNT 0
+#define OMR_VERBOSE_BINARY_RESIZE_COUNT 1
+#define OMR_VERBOSE_BINARY_RESIZE_TIME 2
+#define OMR_VERBOSE_BINARY_RESIZE_SPACE 3 /**< string code */
+#define OMR_VERBOSE_BINARY_RESIZE_REASON 4 /**< string code */
+
+typedef struct OMR_VerboseBinaryFileHeader {
+	uint32_t magic; /**< OMR_VERBOSE_BINARY_MAGIC */
+	uint16_t version; /**< OMR_VERBOSE_BINARY_VERSION */
+	uint16_t recordSize; /**< sizeof(OMR_VerboseBinaryRecord) */
+	char gcVersion[OMR_VERBOSE_BINARY_GC_VERSION_LENGTH]; /**< version attribute of the verbosegc element */
+} OMR_VerboseBinaryFileHeader;
+
+typedef struct OMR_VerboseBinaryRecord {
+	uint16_t type; /**< one of OMR_VERBOSE_BINARY_RECORD_* */
+	uint16_t flags; /**< OMR_VERBOSE_BINARY_FLAG_* */
+	uint32_t code; /**< dictionary code of the type or operation name, or of the entry a STRING record defines */
+	uint64_t id; /**< verbose id of the stanza */
+	uint64_t contextId; /**< verbose id of the cycle the stanza belongs to */
+	uint64_t timestamp; /**< wall clock time in ms since the epoch */
+	union {
+		uint64_t data[OMR_VERBOSE_BINARY_DATA_SLOTS];
+		char string[OMR_VERBOSE_BINARY_STRING_LENGTH];
+	} payload;
+} OMR_VerboseBinaryRecord;
+
+#endif /* VERBOSEBINARYFORMAT_H_ */
@@ -29,6 +29,7 @@
 #include "ConcurrentPhaseStatsBase.hpp"
 #include "Heap.hpp"
 #include "HeapRegionManager.hpp"
+#include "HeapStats.hpp"
 #include "ObjectAllocationInterface.hpp"
 #include "ParallelDispatcher.hpp"
 #if defined(OMR_GC_SPARSE_HEAP_ALLOCATION)
@@ -351,6 +352,9 @@ MM_VerboseHandlerOutput::outputInitializedStanza(MM_EnvironmentBase *env, MM_Ver
 	}
 
 	buffer->formatAndOutput(env, 1, "<attribute name=\"packetListSplit\" value=\"%zu\" />", _extensions->packetListSplit);
+	if (0 != _extensions->workStealingDequeSize) {
+		buffer->formatAndOutput(env, 1, "<attribute name=\"workStealingDequeSize\" value=\"%zu\" />", _extensions->workStealingDequeSize);
+	}
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	buffer->formatAndOutput(env, 1, "<attribute name=\"cacheListSplit\" value=\"%zu\" />", _extensions->cacheListSplit);
 #endif /* OMR_GC_MODRON_SCAVENGER */
@@ -904,6 +908,26 @@ MM_VerboseHandlerOutput::printAllocationStats(MM_EnvironmentBase* env)
 		/* for now, not covered the case of specs that do not have TLHs, but have arraylets */
 	}
 
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+	if (0 != systemStats->_tlhFlushedBytes) {
+		writer->formatAndOutput(env, 1, "<tlh-waste discardedBytes=\"%zu\" flushedBytes=\"%zu\" />", systemStats->_tlhDiscardedBytes, systemStats->_tlhFlushedBytes);
+	}
+	if (_extensions->tlhAdaptiveSizing) {
+		writer->formatAndOutput(env, 1, "<tlh-refresh count=\"%zu\" requestedBytes=\"%zu\" />",
+				systemStats->_tlhRefreshCountFresh + systemStats->_tlhRefreshCountReused, systemStats->_tlhRequestedBytes);
+	}
+	if ((0 != systemStats->_tlhZeroedAheadBytes) || (0 != systemStats->_tlhZeroedOnDemandBytes)) {
+		writer->formatAndOutput(env, 1, "<tlh-zeroing aheadBytes=\"%zu\" onDemandBytes=\"%zu\" />", systemStats->_tlhZeroedAheadBytes, systemStats->_tlhZeroedOnDemandBytes);
+	}
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) */
+
+	if (_extensions->freeListSizeClassIndex) {
+		MM_HeapStats heapStats;
+		_extensions->heap->mergeHeapStats(&heapStats, MEMORY_TYPE_OLD);
+		writer->formatAndOutput(env, 1, "<free-list-search allocations=\"%zu\" walked=\"%zu\" indexed=\"%zu\" />",
+				heapStats._allocCount, heapStats._allocSearchCount, heapStats._allocSizeClassIndexCount);
+	}
+
 	if(0 != _extensions->bytesAllocatedMost){
 		const char *dots = "";
 		char escapedThreadName[128];
@@ -938,8 +962,17 @@ MM_VerboseHandlerOutput::handleGCStart(J9HookInterface** hook, uintptr_t eventNu
 	writer->formatAndOutput(env, 0, "<gc-start %s>", tagTemplate);
 
 	if (stats->_cpuUtilStats._validData) {
-		writer->formatAndOutput(env, 1, "<cpu-util id=\"%zu\" total=\"%.2f\" process=\"%.2f\" />",
-				_manager->getIdAndIncrement(), stats->_cpuUtilStats._avgCpuUtil * 100, stats->_cpuUtilStats._avgProcUtil * 100);
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+		if (0 != _extensions->concurrentMarkDedicatedThreads) {
+			writer->formatAndOutput(env, 1, "<cpu-util id=\"%zu\" total=\"%.2f\" process=\"%.2f\" concurrentMark=\"%.2f\" />",
+					_manager->getIdAndIncrement(), stats->_cpuUtilStats._avgCpuUtil * 100, stats->_cpuUtilStats._avgProcUtil * 100,
+					stats->_cpuUtilStats._avgConcurrentMarkUtil * 100);
+		} else
+#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
+		{
+			writer->formatAndOutput(env, 1, "<cpu-util id=\"%zu\" total=\"%.2f\" process=\"%.2f\" />",
+					_manager->getIdAndIncrement(), stats->_cpuUtilStats._avgCpuUtil * 100, stats->_cpuUtilStats._avgProcUtil * 100);
+		}
 	}
 	outputMemoryInfo(env, _manager->getIndentLevel() + 1, stats);
 	writer->formatAndOutput(env, 0, "</gc-start>");
@@ -1054,6 +1087,30 @@ MM_VerboseHandlerOutput::handleHeapResize(J9HookInterface** hook, uintptr_t even
 	exitAtomicReportingBlock();
 }
 
+void
+MM_VerboseHandlerOutput::getHeapResizeStrings(HeapResizeType resizeType, uintptr_t reason, const char **resizeTypeName, const char **reasonString)
+{
+	if (HEAP_EXPAND == resizeType) {
+		*resizeTypeName = "expand";
+		*reasonString = getExpandReasonAsString((ExpandReason)reason);
+	} else if (HEAP_CONTRACT == resizeType) {
+		*resizeTypeName = "contract";
+		*reasonString = getContractReasonAsString((ContractReason)reason);
+	} else if (HEAP_LOA_EXPAND == resizeType) {
+		*resizeTypeName = "loa expand";
+		*reasonString = getLoaResizeReasonAsString((LoaResizeReason)reason);
+	} else if (HEAP_LOA_CONTRACT == resizeType) {
+		*resizeTypeName = "loa contract";
+		*reasonString = getLoaResizeReasonAsString((LoaResizeReason)reason);
+	} else if (HEAP_RELEASE_FREE_PAGES == resizeType) {
+		*resizeTypeName = "release free pages";
+		*reasonString = "idle";
+	} else {
+		*resizeTypeName = "unknown";
+		*reasonString = "unknown";
+	}
+}
+
 void
 MM_VerboseHandlerOutput::outputHeapResizeInfo(MM_EnvironmentBase *env, uintptr_t indent, HeapResizeType resizeType, uintptr_t resizeAmount, uintptr_t resizeCount, uintptr_t subSpaceType, uintptr_t reason, uint64_t timeInMicroSeconds)
 {
@@ -1064,25 +1121,7 @@ MM_VerboseHandlerOutput::outputHeapResizeInfo(MM_EnvironmentBase *env, uintptr_t
 	const char *resizeTypeName = NULL;
 	char tagTemplate[200];
 
-	if (HEAP_EXPAND == resizeType) {
-		resizeTypeName = "expand";
-		reasonString = getExpandReasonAsString((ExpandReason)reason);
-	} else if (HEAP_CONTRACT == resizeType) {
-		resizeTypeName = "contract";
-		reasonString = getContractReasonAsString((ContractReason)reason);
-	} else if (HEAP_LOA_EXPAND == resizeType) {
-		resizeTypeName = "loa expand";
-		reasonString = getLoaResizeReasonAsString((LoaResizeReason)reason);
-	} else if (HEAP_LOA_CONTRACT == resizeType) {
-		resizeTypeName = "loa contract";
-		reasonString = getLoaResizeReasonAsString((LoaResizeReason)reason);
-	} else if (HEAP_RELEASE_FREE_PAGES == resizeType) {
-		resizeTypeName = "release free pages";
-		reasonString = "idle";
-	} else {
-		resizeTypeName = "unknown";
-		reasonString = "unknown";
-	}
+	getHeapResizeStrings(resizeType, reason, &resizeTypeName, &reasonString);
 
 	getTagTemplate(tagTemplate, sizeof(tagTemplate), omrtime_current_time_millis());
 
@@ -205,6 +205,15 @@ protected:
 
 	virtual void outputMemoryInfoInnerStanza(MM_EnvironmentBase *env, uintptr_t indent, MM_CollectionStatistics *stats);
 
+	/**
+	 * Answer the names a heap resize stanza reports for its type and reason.
+	 * @param resizeType type of resize (ie compact or expand)
+	 * @param reason the reason for the resize
+	 * @param[out] resizeTypeName the human readable "type" of the resize
+	 * @param[out] reasonString the human readable "reason" for the resize
+	 */
+	void getHeapResizeStrings(HeapResizeType resizeType, uintptr_t reason, const char **resizeTypeName, const char **reasonString);
+
 	/**
 	 * Output a stand-alone stanza heap resize events.
 	 * @param env GC thread used for output.
@@ -29,11 +29,13 @@
 #include "VerboseManager.hpp"
 
 #include "VerboseHandlerOutput.hpp"
+#include "VerboseHandlerBinaryStandard.hpp"
 #include "VerboseHandlerOutputStandard.hpp"
 #include "VerboseWriter.hpp"
 #include "VerboseWriterChain.hpp"
 #include "VerboseWriterHook.hpp"
 #include "VerboseWriterFileLogging.hpp"
+#include "VerboseWriterFileLoggingBinary.hpp"
 #include "VerboseWriterFileLoggingBuffered.hpp"
 #include "VerboseWriterFileLoggingSynchronous.hpp"
 #include "VerboseWriterStreamOutput.hpp"
@@ -121,7 +123,11 @@ MM_VerboseManager::createVerboseHandlerOutputObject(MM_EnvironmentBase *env)
 
 	if (extensions->isStandardGC()) {
 #if defined(OMR_GC_MODRON_STANDARD)
-		handler = MM_VerboseHandlerOutputStandard::newInstance(env, this);
+		if (extensions->binaryLogging) {
+			handler = MM_VerboseHandlerBinaryStandard::newInstance(env, this);
+		} else {
+			handler = MM_VerboseHandlerOutputStandard::newInstance(env, this);
+		}
 #endif /* defined(OMR_GC_MODRON_STANDARD) */
 	} else {
 		handler = MM_VerboseHandlerOutput::newInstance(env, this);
@@ -250,6 +256,10 @@ MM_VerboseManager::parseWriterType(MM_EnvironmentBase *env, char *filename, uint
 		return VERBOSE_WRITER_HOOK;
 	}
 
+	if (extensions->binaryLogging) {
+		return VERBOSE_WRITER_FILE_LOGGING_BINARY;
+	}
+
 	if (extensions->bufferedLogging) {
 		return VERBOSE_WRITER_FILE_LOGGING_BUFFERED;
 	}
@@ -330,6 +340,10 @@ MM_VerboseManager::createWriter(MM_EnvironmentBase *env, WriterType type, char *
 			writer = MM_VerboseWriterStreamOutput::newInstance(env, NULL);
 		}
 		break;
+	case VERBOSE_WRITER_FILE_LOGGING_BINARY:
+		/* no fallback: the binary handler only reports to this writer, and a text stream would get nothing */
+		writer = MM_VerboseWriterFileLoggingBinary::newInstance(env, this, filename, fileCount, iterations);
+		break;
 
 	default:
 		return NULL;
@@ -0,0 +1,438 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#include "modronapicore.hpp"
+#include "omrport.h"
+#include "ModronAssertions.h"
+
+#include "VerboseManager.hpp"
+#include "VerboseWriterFileLoggingBinary.hpp"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "ParallelDispatcher.hpp"
+
+#include <string.h>
+
+MM_VerboseWriterFileLoggingBinary::MM_VerboseWriterFileLoggingBinary(MM_EnvironmentBase *env, MM_VerboseManager *manager)
+	:MM_VerboseWriterFileLogging(env, manager, VERBOSE_WRITER_FILE_LOGGING_BINARY)
+	,_omrVM(env->getOmrVM())
+	,_ring(NULL)
+	,_ringTail(0)
+	,_ringHead(0)
+	,_droppedRecords(0)
+	,_batchCount(0)
+	,_dictionaryCount(0)
+	,_logFileDescriptor(-1)
+	,_monitor(NULL)
+	,_state(STATE_ERROR)
+{
+	/* No implementation */
+}
+
+/**
+ * Create a new MM_VerboseWriterFileLoggingBinary instance.
+ * @return Pointer to the new MM_VerboseWriterFileLoggingBinary.
+ */
+MM_VerboseWriterFileLoggingBinary *
+MM_VerboseWriterFileLoggingBinary::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	MM_VerboseWriterFileLoggingBinary *agent = (MM_VerboseWriterFileLoggingBinary *)extensions->getForge()->allocate(sizeof(MM_VerboseWriterFileLoggingBinary), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if(agent) {
+		new(agent) MM_VerboseWriterFileLoggingBinary(env, manager);
+		if(!agent->initialize(env, filename, numFiles, numCycles)) {
+			agent->kill(env);
+			agent = NULL;
+		}
+	}
+	return agent;
+}
+
+/**
+ * Initializes the MM_VerboseWriterFileLoggingBinary instance, opening the file and starting the drain thread.
+ * The ring and the dictionary outlive reconfiguration, so records published meanwhile are not lost.
+ * @return true on success, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingBinary::initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	if (NULL == _ring) {
+		_ring = (Slot *)extensions->getForge()->allocate(sizeof(Slot) * RING_SIZE, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		if (NULL == _ring) {
+			return false;
+		}
+		for (uintptr_t i = 0; i < RING_SIZE; i++) {
+			_ring[i].sequence = i;
+		}
+	}
+
+	if (NULL == _monitor) {
+		if (0 != omrthread_monitor_init_with_name(&_monitor, 0, "MM_VerboseWriterFileLoggingBinary::_monitor")) {
+			_monitor = NULL;
+			return false;
+		}
+	}
+
+	if (!MM_VerboseWriterFileLogging::initialize(env, filename, numFiles, numCycles)) {
+		return false;
+	}
+
+	return startDrainThread();
+}
+
+/**
+ * Tear down the structures managed by the MM_VerboseWriterFileLoggingBinary.
+ * Stops the drain thread, logging what remains in the ring, and frees the ring.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::tearDown(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	stopDrainThread();
+	closeFile(env);
+
+	if (NULL != _monitor) {
+		omrthread_monitor_destroy(_monitor);
+		_monitor = NULL;
+	}
+
+	if (NULL != _ring) {
+		extensions->getForge()->free(_ring);
+		_ring = NULL;
+	}
+
+	MM_VerboseWriterFileLogging::tearDown(env);
+}
+
+bool
+MM_VerboseWriterFileLoggingBinary::reconfigure(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	stopDrainThread();
+	closeFile(env);
+	MM_VerboseWriterFileLogging::tearDown(env);
+	return initialize(env, filename, numFiles, numCycles);
+}
+
+/**
+ * Closes the agent's output stream once everything published has been logged.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::closeStream(MM_EnvironmentBase *env)
+{
+	stopDrainThread();
+	closeFile(env);
+}
+
+bool
+MM_VerboseWriterFileLoggingBinary::openStream(MM_EnvironmentBase *env)
+{
+	return openFile(env) && startDrainThread();
+}
+
+/**
+ * Opens the file to log to and writes the file header, followed by the dictionary logged so far.
+ * @return true on sucess, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingBinary::openFile(MM_EnvironmentBase *env, bool printInitializedHeader)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+	const char* version = omrgc_get_version(env->getOmrVM());
+
+	char *filenameToOpen = expandFilename(env, _currentFile);
+	if (NULL == filenameToOpen) {
+		return false;
+	}
+
+	int32_t openFlags =  EsOpenWrite | EsOpenCreate | _manager->fileOpenMode(env);
+
+	_logFileDescriptor = omrfile_open(filenameToOpen, openFlags, 0666);
+	if(-1 == _logFileDescriptor) {
+		char *cursor = filenameToOpen;
+		/**
+		 * This may have failed due to directories in the path not being available.
+		 * Try to create these directories and attempt to open again before failing.
+		 */
+		while ( (cursor = strchr(++cursor, DIR_SEPARATOR)) != NULL ) {
+			*cursor = '\0';
+			omrfile_mkdir(filenameToOpen);
+			*cursor = DIR_SEPARATOR;
+		}
+
+		/* Try again */
+		_logFileDescriptor = omrfile_open(filenameToOpen, openFlags, 0666);
+		if (-1 == _logFileDescriptor) {
+			_manager->handleFileOpenError(env, filenameToOpen);
+			extensions->getForge()->free(filenameToOpen);
+			return false;
+		}
+	}
+
+	extensions->getForge()->free(filenameToOpen);
+
+	OMR_VerboseBinaryFileHeader header;
+	memset(&header, 0, sizeof(header));
+	header.magic = OMR_VERBOSE_BINARY_MAGIC;
+	header.version = OMR_VERBOSE_BINARY_VERSION;
+	header.recordSize = sizeof(OMR_VerboseBinaryRecord);
+	strncpy(header.gcVersion, version, sizeof(header.gcVersion) - 1);
+	omrfile_write(_logFileDescriptor, &header, sizeof(header));
+
+	/* every file describes its own records, so each can be decoded once older ones have rotated away */
+	if (0 != _dictionaryCount) {
+		omrfile_write(_logFileDescriptor, _dictionary, sizeof(OMR_VerboseBinaryRecord) * _dictionaryCount);
+	}
+
+	return true;
+}
+
+/**
+ * Closes the file being logged to.
+ */
+void
+MM_VerboseWriterFileLoggingBinary::closeFile(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if(-1 != _logFileDescriptor) {
+		omrfile_close(_logFileDescriptor);
+		_logFileDescriptor = -1;
+	}
+}
+
+bool
+MM_VerboseWriterFileLoggingBinary::record(const OMR_VerboseBinaryRecord *record)
+{
+	uintptr_t position = _ringTail;
+	Slot *slot = NULL;
+
+	while (true) {
+		slot = &_ring[position & (RING_SIZE - 1)];
+		intptr_t lag = (intptr_t)(slot->sequence - position);
+		if (0 == lag) {
+			uintptr_t claimed = MM_AtomicOperations::lockCompareExchange(&_ringTail, position, position + 1);
+			if (claimed == position) {
+				break;
+			}
+			position = claimed;
+		} else if (lag < 0) {
+			/* the slot still holds the record from a lap ago: the drain thread is behind and the ring is full */
+			MM_AtomicOperations::add(&_droppedRecords, 1);
+			return false;
+		} else {
+			/* another producer claimed this position */
+			position = _ringTail;
+		}
+	}
+
+	slot->record = *record;
+	/* the drain thread must see the record before it sees the slot as full */
+	MM_AtomicOperations::storeSync();
+	slot->sequence = position + 1;
+
+	if (0 == (position & ((RING_SIZE / 2) - 1))) {
+		/* wake the drain thread every half ring rather than leave it to the timer under a burst of collections */
+		omrthread_monitor_enter(_monitor);
+		omrthread_monitor_notify(_monitor);
+		omrthread_monitor_exit(_monitor);
+	}
+
+	return true;
+}
+
+bool
+MM_VerboseWriterFileLoggingBinary::startDrainThread()
+{
+	bool success = false;
+
+	/* hold the monitor over start-up of the thread so it cannot report its state before we wait for it */
+	omrthread_monitor_enter(_monitor);
+	_state = STATE_STARTING;
+	intptr_t forkResult = createThreadWithCategory(
+		NULL,
+		OMR_OS_STACK_SIZE,
+		J9THREAD_PRIORITY_MIN,
+		0,
+		drain_thread_proc,
+		this,
+		J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 == forkResult) {
+		while (STATE_STARTING == _state) {
+			omrthread_monitor_wait(_monitor);
+		}
+		success = (STATE_RUNNING == _state);
+	} else {
+		_state = STATE_ERROR;
+	}
+	omrthread_monitor_exit(_monitor);
+
+	return success;
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::stopDrainThread()
+{
+	if (STATE_ERROR != _state) {
+		omrthread_monitor_enter(_monitor);
+		while (STATE_TERMINATED != _state) {
+			_state = STATE_TERMINATION_REQUESTED;
+			omrthread_monitor_notify(_monitor);
+			omrthread_monitor_wait(_monitor);
+		}
+		_state = STATE_ERROR;
+		omrthread_monitor_exit(_monitor);
+	}
+}
+
+uintptr_t
+MM_VerboseWriterFileLoggingBinary::drain_thread_proc2(OMRPortLibrary *portLib, void *info)
+{
+	MM_VerboseWriterFileLoggingBinary *writer = (MM_VerboseWriterFileLoggingBinary *)info;
+	/* drain until asked to terminate.  This method will NOT return */
+	writer->drainEntryPoint();
+	Assert_MM_unreachable();
+	return 0;
+}
+
+int J9THREAD_PROC
+MM_VerboseWriterFileLoggingBinary::drain_thread_proc(void *info)
+{
+	MM_VerboseWriterFileLoggingBinary *writer = (MM_VerboseWriterFileLoggingBinary *)info;
+	OMR_VM *omrVM = writer->_omrVM;
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(omrVM);
+	OMRPORT_ACCESS_FROM_OMRVM(omrVM);
+	uintptr_t rc = 0;
+	omrsig_protect(drain_thread_proc2, info,
+		extensions->dispatcher->getSignalHandler(), omrVM,
+		OMRPORT_SIG_FLAG_SIGALLSYNC | OMRPORT_SIG_FLAG_MAY_CONTINUE_EXECUTION,
+		&rc);
+	return 0;
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::drainEntryPoint()
+{
+	/* the thread only writes files, so it needs no VM thread of its own */
+	MM_EnvironmentBase env(_omrVM);
+
+	omrthread_monitor_enter(_monitor);
+	_state = STATE_RUNNING;
+	omrthread_monitor_notify(_monitor);
+
+	while (STATE_RUNNING == _state) {
+		omrthread_monitor_wait_timed(_monitor, DRAIN_INTERVAL_MILLIS, 0);
+		/* drain on the way out as well, so whatever was published before a stop request is logged */
+		omrthread_monitor_exit(_monitor);
+		drain(&env);
+		omrthread_monitor_enter(_monitor);
+	}
+
+	/* notify the stopping thread, which resumes once the monitor is released on exit */
+	_state = STATE_TERMINATED;
+	omrthread_monitor_notify(_monitor);
+	omrthread_exit(_monitor);
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::drain(MM_EnvironmentBase *env)
+{
+	uintptr_t droppedRecords = _droppedRecords;
+	if (0 != droppedRecords) {
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		OMR_VerboseBinaryRecord dropped;
+		memset(&dropped, 0, sizeof(dropped));
+		dropped.type = OMR_VERBOSE_BINARY_RECORD_DROPPED;
+		dropped.timestamp = omrtime_current_time_millis();
+		dropped.payload.data[0] = droppedRecords;
+		appendToBatch(env, &dropped);
+		MM_AtomicOperations::subtract(&_droppedRecords, droppedRecords);
+	}
+
+	while (true) {
+		Slot *slot = &_ring[_ringHead & (RING_SIZE - 1)];
+		if ((_ringHead + 1) != slot->sequence) {
+			break;
+		}
+		MM_AtomicOperations::loadSync();
+		appendToBatch(env, &slot->record);
+		/* the copy must complete before a producer can claim the slot for the next lap */
+		MM_AtomicOperations::sync();
+		slot->sequence = _ringHead + RING_SIZE;
+		_ringHead += 1;
+	}
+
+	flushBatch(env);
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::appendToBatch(MM_EnvironmentBase *env, const OMR_VerboseBinaryRecord *record)
+{
+	_batch[_batchCount] = *record;
+	_batchCount += 1;
+
+	if (OMR_VERBOSE_BINARY_RECORD_STRING == record->type) {
+		/* handlers republish their dictionary when reattached, so keep the latest definition of each code */
+		uintptr_t entry = 0;
+		while ((entry < _dictionaryCount) && (_dictionary[entry].code != record->code)) {
+			entry += 1;
+		}
+		if (entry < OMR_VERBOSE_BINARY_MAX_STRINGS) {
+			_dictionary[entry] = *record;
+			if (entry == _dictionaryCount) {
+				_dictionaryCount += 1;
+			}
+		}
+	}
+
+	if (OMR_VERBOSE_BINARY_RECORD_CYCLE_END == record->type) {
+		/* rotate only after the cycle end is in the file it closes */
+		flushBatch(env);
+		MM_VerboseWriterFileLogging::endOfCycle(env);
+	} else if (BATCH_SIZE == _batchCount) {
+		flushBatch(env);
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingBinary::flushBatch(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if (0 != _batchCount) {
+		if (-1 == _logFileDescriptor) {
+			/* the file failed to open at the last rotation; try again rather than lose the batch */
+			openFile(env);
+		}
+		if (-1 != _logFileDescriptor) {
+			omrfile_write(_logFileDescriptor, _batch, sizeof(OMR_VerboseBinaryRecord) * _batchCount);
+		}
+		_batchCount = 0;
+	}
+}
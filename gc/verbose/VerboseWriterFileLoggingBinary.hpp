@@ -0,0 +1,143 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#if !defined(VERBOSEWRITERFILELOGGINGBINARY_HPP_)
+#define VERBOSEWRITERFILELOGGINGBINARY_HPP_
+
+#include "omrcfg.h"
+#include "omrthread.h"
+
+#include "VerboseBinaryFormat.h"
+#include "VerboseWriterFileLogging.hpp"
+
+/**
+ * Output agent which logs verbosegc events to file as fixed size binary records (see VerboseBinaryFormat.h).
+ * Producers never format text, take a lock or touch the file: record() claims a slot in a bounded
+ * lock-free ring and copies the record in. A background thread drains the ring to the file in batches,
+ * rotating files on cycle end records, so the cost to the collector is a compare and swap and a copy
+ * per event. When the ring is full records are counted and dropped rather than stalling the collector;
+ * the drain thread logs the count in a DROPPED record.
+ */
+class MM_VerboseWriterFileLoggingBinary : public MM_VerboseWriterFileLogging
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	typedef enum DrainThreadState
+	{
+		STATE_ERROR = 0,
+		STATE_STARTING,
+		STATE_RUNNING,
+		STATE_TERMINATION_REQUESTED,
+		STATE_TERMINATED,
+	} DrainThreadState;
+
+	enum {
+		RING_SIZE = 1024, /**< Records the ring holds; a power of two */
+		BATCH_SIZE = 64, /**< Records written to the file per write */
+		DRAIN_INTERVAL_MILLIS = 200, /**< Longest a record waits in the ring */
+	};
+
+	struct Slot {
+		volatile uintptr_t sequence; /**< Ring position the slot may next be claimed for (empty), or that position plus one (full) */
+		OMR_VerboseBinaryRecord record;
+	};
+
+	OMR_VM *_omrVM; /**< The VM the drain thread logs for */
+	Slot *_ring; /**< Records published but not yet drained */
+	volatile uintptr_t _ringTail; /**< Next ring position producers claim */
+	uintptr_t _ringHead; /**< Next ring position the drain thread reads (drain thread only) */
+	volatile uintptr_t _droppedRecords; /**< Records dropped on a full ring since the drain thread last logged them */
+	OMR_VerboseBinaryRecord _batch[BATCH_SIZE]; /**< Records drained but not yet written (drain thread only) */
+	uintptr_t _batchCount; /**< Records in _batch */
+	OMR_VerboseBinaryRecord _dictionary[OMR_VERBOSE_BINARY_MAX_STRINGS]; /**< STRING records logged so far, repeated at the start of each file */
+	uintptr_t _dictionaryCount; /**< Records in _dictionary */
+	intptr_t _logFileDescriptor; /**< the file being written to */
+	omrthread_monitor_t _monitor; /**< Protects _state, and times the wait between drains */
+	volatile DrainThreadState _state; /**< The state (protected by _monitor) of the drain thread */
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_VerboseWriterFileLoggingBinary *newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char* filename, uintptr_t fileCount, uintptr_t iterations);
+
+	/**
+	 * Publish a record for the drain thread to log. Safe to call from any number of threads at once.
+	 * @param[in] record the record to copy into the ring
+	 * @return true if the record was published, false if it was dropped because the ring was full
+	 */
+	bool record(const OMR_VerboseBinaryRecord *record);
+
+	/**
+	 * Binary logs carry no text; the handler publishes records with record() instead.
+	 */
+	virtual void outputString(MM_EnvironmentBase *env, const char* string) {}
+
+	/**
+	 * Files are rotated by the drain thread as it logs cycle end records, so collectors never wait on file I/O.
+	 */
+	virtual void endOfCycle(MM_EnvironmentBase *env) {}
+
+	virtual bool reconfigure(MM_EnvironmentBase *env, const char* filename, uintptr_t fileCount, uintptr_t iterations);
+	virtual void closeStream(MM_EnvironmentBase *env);
+	virtual bool openStream(MM_EnvironmentBase *env);
+
+protected:
+	MM_VerboseWriterFileLoggingBinary(MM_EnvironmentBase *env, MM_VerboseManager *manager);
+
+	virtual bool initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles);
+
+private:
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	bool openFile(MM_EnvironmentBase *env, bool printInitializedHeader = false);
+	void closeFile(MM_EnvironmentBase *env);
+
+	/**
+	 * Start the drain thread, waiting until it reports success.
+	 * @return true on success, false on failure
+	 */
+	bool startDrainThread();
+
+	/**
+	 * Stop the drain thread, waiting until it has logged everything published before the call.
+	 */
+	void stopDrainThread();
+
+	static int J9THREAD_PROC drain_thread_proc(void *info);
+	static uintptr_t drain_thread_proc2(OMRPortLibrary *portLib, void *info);
+	void drainEntryPoint();
+
+	/**
+	 * Move every published record from the ring to the file.
+	 */
+	void drain(MM_EnvironmentBase *env);
+	void appendToBatch(MM_EnvironmentBase *env, const OMR_VerboseBinaryRecord *record);
+	void flushBatch(MM_EnvironmentBase *env);
+};
+
+#endif /* VERBOSEWRITERFILELOGGINGBINARY_HPP_ */
@@ -0,0 +1,472 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#include "omrcfg.h"
+
+#include "omrgcconsts.h"
+#include "gcutils.h"
+
+#include "AtomicOperations.hpp"
+#include "CollectionStatisticsStandard.hpp"
+#include "CycleState.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "ParallelDispatcher.hpp"
+#include "VerboseHandlerBinaryStandard.hpp"
+#include "VerboseManager.hpp"
+#include "VerboseWriterChain.hpp"
+#include "VerboseWriterFileLoggingBinary.hpp"
+
+#include <string.h>
+
+static void verboseHandlerBinaryCycleStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void verboseHandlerBinaryCycleEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void verboseHandlerBinaryGCStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void verboseHandlerBinaryGCEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void verboseHandlerBinaryMarkEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void verboseHandlerBinarySweepEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+#if defined(OMR_GC_MODRON_COMPACTION)
+static void verboseHandlerBinaryCompactEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+#if defined(OMR_GC_MODRON_SCAVENGER)
+static void verboseHandlerBinaryScavengeEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+static void verboseHandlerBinaryHeapResize(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+
+static const char *unknownString = "unknown";
+
+MM_VerboseHandlerOutput *
+MM_VerboseHandlerBinaryStandard::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager)
+{
+	MM_GCExtensionsBase* extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	MM_VerboseHandlerBinaryStandard *verboseHandlerOutput = (MM_VerboseHandlerBinaryStandard *)extensions->getForge()->allocate(sizeof(MM_VerboseHandlerBinaryStandard), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != verboseHandlerOutput) {
+		new(verboseHandlerOutput) MM_VerboseHandlerBinaryStandard(extensions);
+		if(!verboseHandlerOutput->initialize(env, manager)) {
+			verboseHandlerOutput->kill(env);
+			verboseHandlerOutput = NULL;
+		}
+	}
+	return verboseHandlerOutput;
+}
+
+bool
+MM_VerboseHandlerBinaryStandard::initialize(MM_EnvironmentBase *env, MM_VerboseManager *manager)
+{
+	memset((void *)_strings, 0, sizeof(_strings));
+	/* code 0 stands in for anything the dictionary has no room left for */
+	_strings[0] = (uintptr_t)unknownString;
+
+	return MM_VerboseHandlerOutputStandard::initialize(env, manager);
+}
+
+void
+MM_VerboseHandlerBinaryStandard::enableVerbose()
+{
+	MM_VerboseWriter *writer = _manager->getWriterChain()->getFirstWriter();
+	while (NULL != writer) {
+		if (VERBOSE_WRITER_FILE_LOGGING_BINARY == writer->getType()) {
+			_writer = (MM_VerboseWriterFileLoggingBinary *)writer;
+			break;
+		}
+		writer = writer->getNextWriter();
+	}
+
+	if (NULL != _writer) {
+		/* the dictionary entries for codes already handed out, which the writer may not have seen yet */
+		for (uintptr_t code = 0; code < OMR_VERBOSE_BINARY_MAX_STRINGS; code++) {
+			const char *string = (const char *)_strings[code];
+			if (NULL != string) {
+				OMR_VerboseBinaryRecord record;
+				initRecord(&record, OMR_VERBOSE_BINARY_RECORD_STRING, NULL, 0, 0);
+				record.code = (uint32_t)code;
+				strncpy(record.payload.string, string, sizeof(record.payload.string) - 1);
+				publish(&record);
+			}
+		}
+	}
+
+	/* Cycle */
+	(*_mmOmrHooks)->J9HookRegisterWithCallSite(_mmOmrHooks, J9HOOK_MM_OMR_GC_CYCLE_START, verboseHandlerBinaryCycleStart, OMR_GET_CALLSITE(), (void *)this);
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_GC_POST_CYCLE_END, verboseHandlerBinaryCycleEnd, OMR_GET_CALLSITE(), (void *)this);
+
+	/* STW GC increment */
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_GC_INCREMENT_START, verboseHandlerBinaryGCStart, OMR_GET_CALLSITE(), (void *)this);
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_GC_INCREMENT_END, verboseHandlerBinaryGCEnd, OMR_GET_CALLSITE(), (void *)this);
+
+	/* GCOps */
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_MARK_END, verboseHandlerBinaryMarkEnd, OMR_GET_CALLSITE(), (void *)this);
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_SWEEP_END, verboseHandlerBinarySweepEnd, OMR_GET_CALLSITE(), (void *)this);
+#if defined(OMR_GC_MODRON_COMPACTION)
+	(*_mmOmrHooks)->J9HookRegisterWithCallSite(_mmOmrHooks, J9HOOK_MM_OMR_COMPACT_END, verboseHandlerBinaryCompactEnd, OMR_GET_CALLSITE(), (void *)this);
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_SCAVENGE_END, verboseHandlerBinaryScavengeEnd, OMR_GET_CALLSITE(), (void *)this);
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+
+	/* Heap resize */
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_HEAP_RESIZE, verboseHandlerBinaryHeapResize, OMR_GET_CALLSITE(), (void *)this);
+}
+
+void
+MM_VerboseHandlerBinaryStandard::disableVerbose()
+{
+	/* Cycle */
+	(*_mmOmrHooks)->J9HookUnregister(_mmOmrHooks, J9HOOK_MM_OMR_GC_CYCLE_START, verboseHandlerBinaryCycleStart, NULL);
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_GC_POST_CYCLE_END, verboseHandlerBinaryCycleEnd, NULL);
+
+	/* STW GC increment */
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_GC_INCREMENT_START, verboseHandlerBinaryGCStart, NULL);
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_GC_INCREMENT_END, verboseHandlerBinaryGCEnd, NULL);
+
+	/* GCOps */
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_MARK_END, verboseHandlerBinaryMarkEnd, NULL);
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_SWEEP_END, verboseHandlerBinarySweepEnd, NULL);
+#if defined(OMR_GC_MODRON_COMPACTION)
+	(*_mmOmrHooks)->J9HookUnregister(_mmOmrHooks, J9HOOK_MM_OMR_COMPACT_END, verboseHandlerBinaryCompactEnd, NULL);
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_SCAVENGE_END, verboseHandlerBinaryScavengeEnd, NULL);
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+
+	/* Heap resize */
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_HEAP_RESIZE, verboseHandlerBinaryHeapResize, NULL);
+
+	_writer = NULL;
+}
+
+uint32_t
+MM_VerboseHandlerBinaryStandard::getStringCode(const char *string)
+{
+	for (uintptr_t code = 0; code < OMR_VERBOSE_BINARY_MAX_STRINGS; code++) {
+		uintptr_t entry = _strings[code];
+		if (0 == entry) {
+			entry = MM_AtomicOperations::lockCompareExchange(&_strings[code], 0, (uintptr_t)string);
+			if (0 == entry) {
+				/* this thread claimed the code, so it publishes the definition */
+				OMR_VerboseBinaryRecord record;
+				initRecord(&record, OMR_VERBOSE_BINARY_RECORD_STRING, NULL, 0, 0);
+				record.code = (uint32_t)code;
+				strncpy(record.payload.string, string, sizeof(record.payload.string) - 1);
+				publish(&record);
+				return (uint32_t)code;
+			}
+		}
+		if ((uintptr_t)string == entry) {
+			return (uint32_t)code;
+		}
+	}
+	return 0;
+}
+
+void
+MM_VerboseHandlerBinaryStandard::initRecord(OMR_VerboseBinaryRecord *record, uint16_t type, const char *name, uintptr_t id, uintptr_t contextId)
+{
+	OMRPORT_ACCESS_FROM_OMRVM(_omrVM);
+
+	memset(record, 0, sizeof(*record));
+	record->type = type;
+	if (NULL != name) {
+		record->code = getStringCode(name);
+	}
+	record->id = id;
+	record->contextId = contextId;
+	record->timestamp = omrtime_current_time_millis();
+}
+
+void
+MM_VerboseHandlerBinaryStandard::publish(const OMR_VerboseBinaryRecord *record)
+{
+	if (NULL != _writer) {
+		_writer->record(record);
+	}
+}
+
+void
+MM_VerboseHandlerBinaryStandard::publishMemoryInfo(MM_EnvironmentBase *env, MM_CollectionStatistics *statsBase)
+{
+	MM_CollectionStatisticsStandard *stats = MM_CollectionStatisticsStandard::getCollectionStatistics(statsBase);
+	OMR_VerboseBinaryRecord record;
+
+	initRecord(&record, OMR_VERBOSE_BINARY_RECORD_MEM_INFO, NULL, _manager->getIdAndIncrement(), env->_cycleState->_verboseContextID);
+	record.payload.data[OMR_VERBOSE_BINARY_MEM_FREE] = stats->_totalFreeHeapSize;
+	record.payload.data[OMR_VERBOSE_BINARY_MEM_TOTAL] = stats->_totalHeapSize;
+	if (stats->_scavengerEnabled) {
+		record.flags |= OMR_VERBOSE_BINARY_FLAG_NURSERY;
+		record.payload.data[OMR_VERBOSE_BINARY_MEM_NURSERY_FREE] = stats->_totalFreeNurseryHeapSize;
+		record.payload.data[OMR_VERBOSE_BINARY_MEM_NURSERY_TOTAL] = stats->_totalNurseryHeapSize;
+	}
+	record.payload.data[OMR_VERBOSE_BINARY_MEM_TENURE_FREE] = stats->_totalFreeTenureHeapSize;
+	record.payload.data[OMR_VERBOSE_BINARY_MEM_TENURE_TOTAL] = stats->_totalTenureHeapSize;
+	publish(&record);
+}
+
+void
+MM_VerboseHandlerBinaryStandard::publishGCOp(MM_EnvironmentBase *env, const char *type, uint64_t duration, bool deltaTimeSuccess, OMR_VerboseBinaryRecord *record)
+{
+	initRecord(record, OMR_VERBOSE_BINARY_RECORD_GC_OP, type, _manager->getIdAndIncrement(), env->_cycleState->_verboseContextID);
+	if (!deltaTimeSuccess) {
+		record->flags |= OMR_VERBOSE_BINARY_FLAG_CLOCK_ERROR;
+	}
+	record->payload.data[0] = duration;
+}
+
+void
+MM_VerboseHandlerBinaryStandard::handleCycleStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_GCCycleStartEvent* event = (MM_GCCycleStartEvent*)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->omrVMThread);
+	uint64_t currentTime = event->timestamp;
+	uint64_t previousTime = 0;
+
+	switch (env->_cycleState->_type) {
+	case OMR_GC_CYCLE_TYPE_GLOBAL:
+		previousTime = _manager->getLastGlobalGCTime();
+		_manager->setLastGlobalGCTime(currentTime);
+		break;
+	case OMR_GC_CYCLE_TYPE_SCAVENGE:
+		previousTime = _manager->getLastLocalGCTime();
+		_manager->setLastLocalGCTime(currentTime);
+		break;
+	default:
+		break;
+	}
+
+	if (0 == previousTime) {
+		previousTime = _manager->getInitializedTime();
+	}
+
+	uint64_t deltaTime = 0;
+	bool deltaTimeSuccess = getTimeDeltaInMicroSeconds(&deltaTime, previousTime, currentTime);
+
+	uintptr_t id = _manager->getIdAndIncrement();
+	env->_cycleState->_verboseContextID = id;
+
+	OMR_VerboseBinaryRecord record;
+	initRecord(&record, OMR_VERBOSE_BINARY_RECORD_CYCLE_START, getCurrentCycleType(env), id, 0);
+	if (!deltaTimeSuccess) {
+		record.flags |= OMR_VERBOSE_BINARY_FLAG_CLOCK_ERROR;
+	}
+	record.payload.data[0] = deltaTime;
+	publish(&record);
+}
+
+void
+MM_VerboseHandlerBinaryStandard::handleCycleEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_GCPostCycleEndEvent* event = (MM_GCPostCycleEndEvent*)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	OMR_VerboseBinaryRecord record;
+
+	initRecord(&record, OMR_VERBOSE_BINARY_RECORD_CYCLE_END, getCurrentCycleType(env), _manager->getIdAndIncrement(), env->_cycleState->_verboseContextID);
+	publish(&record);
+}
+
+void
+MM_VerboseHandlerBinaryStandard::handleGCStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_GCIncrementStartEvent * event = (MM_GCIncrementStartEvent *)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	OMR_VerboseBinaryRecord record;
+
+	initRecord(&record, OMR_VERBOSE_BINARY_RECORD_GC_START, getCurrentCycleType(env), _manager->getIdAndIncrement(), env->_cycleState->_verboseContextID);
+	publish(&record);
+	publishMemoryInfo(env, (MM_CollectionStatistics *)event->stats);
+}
+
+void
+MM_VerboseHandlerBinaryStandard::handleGCEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_GCIncrementEndEvent * event = (MM_GCIncrementEndEvent *)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	MM_CollectionStatistics *stats = (MM_CollectionStatistics *)event->stats;
+	uint64_t durationInMicroseconds = 0;
+	uint64_t userTimeInMicroseconds = 0;
+	uint64_t systemTimeInMicroseconds = 0;
+	uint64_t stallTimeInMicroseconds = 0;
+
+	bool getDurationTimeSuccessful = getTimeDeltaInMicroSeconds(&durationInMicroseconds, stats->_startTime, stats->_endTime);
+	bool getUserTimeSuccessful = getTimeDelta(&userTimeInMicroseconds, (uint64_t)stats->_startProcessTimes._userTime / 1000, (uint64_t)stats->_endProcessTimes._userTime / 1000);
+	bool getSystemTimeSuccessful = getTimeDelta(&systemTimeInMicroseconds, (uint64_t)stats->_startProcessTimes._systemTime / 1000, (uint64_t)stats->_endProcessTimes._systemTime / 1000);
+	bool getStallTimeSuccessful = getTimeDeltaInMicroSeconds(&stallTimeInMicroseconds, 0, stats->_stallTime);
+
+	OMR_VerboseBinaryRecord record;
+	initRecord(&record, OMR_VERBOSE_BINARY_RECORD_GC_END, getCurrentCycleType(env), _manager->getIdAndIncrement(), env->_cycleState->_verboseContextID);
+	if (!getDurationTimeSuccessful || !getUserTimeSuccessful || !getSystemTimeSuccessful || !getStallTimeSuccessful) {
+		record.flags |= OMR_VERBOSE_BINARY_FLAG_CLOCK_ERROR;
+	}
+	record.payload.data[0] = durationInMicroseconds;
+	record.payload.data[1] = userTimeInMicroseconds;
+	record.payload.data[2] = systemTimeInMicroseconds;
+	record.payload.data[3] = stallTimeInMicroseconds;
+	record.payload.data[4] = env->getExtensions()->dispatcher->activeThreadCount();
+	publish(&record);
+	publishMemoryInfo(env, stats);
+}
+
+void
+MM_VerboseHandlerBinaryStandard::handleMarkEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_MarkEndEvent* event = (MM_MarkEndEvent*)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	MM_MarkStats *markStats = &env->getExtensions()->globalGCStats.markStats;
+	uint64_t duration = 0;
+	bool deltaTimeSuccess = getTimeDeltaInMicroSeconds(&duration, markStats->_startTime, markStats->_endTime);
+	OMR_VerboseBinaryRecord record;
+
+	publishGCOp(env, "mark", duration, deltaTimeSuccess, &record);
+	record.flags |= OMR_VERBOSE_BINARY_FLAG_TRACE_INFO;
+	record.payload.data[1] = markStats->_objectsMarked;
+	record.payload.data[2] = markStats->_objectsScanned;
+	record.payload.data[3] = markStats->_bytesScanned;
+	publish(&record);
+}
+
+void
+MM_VerboseHandlerBinaryStandard::handleSweepEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_SweepEndEvent* event = (MM_SweepEndEvent*)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	MM_SweepStats *sweepStats = &env->getExtensions()->globalGCStats.sweepStats;
+	uint64_t duration = 0;
+	bool deltaTimeSuccess = getTimeDeltaInMicroSeconds(&duration, sweepStats->_startTime, sweepStats->_endTime);
+	OMR_VerboseBinaryRecord record;
+
+	publishGCOp(env, "sweep", duration, deltaTimeSuccess, &record);
+	publish(&record);
+}
+
+#if defined(OMR_GC_MODRON_COMPACTION)
+void
+MM_VerboseHandlerBinaryStandard::handleCompactEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_CompactEndEvent* event = (MM_CompactEndEvent*)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->omrVMThread);
+	MM_CompactStats *compactStats = &env->getExtensions()->globalGCStats.compactStats;
+	uint64_t duration = 0;
+	bool deltaTimeSuccess = getTimeDeltaInMicroSeconds(&duration, compactStats->_startTime, compactStats->_endTime);
+	OMR_VerboseBinaryRecord record;
+
+	publishGCOp(env, "compact", duration, deltaTimeSuccess, &record);
+	publish(&record);
+}
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+void
+MM_VerboseHandlerBinaryStandard::handleScavengeEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_ScavengeEndEvent* event = (MM_ScavengeEndEvent*)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	uint64_t duration = 0;
+	bool deltaTimeSuccess = getTimeDeltaInMicroSeconds(&duration, event->incrementStartTime, event->incrementEndTime);
+	OMR_VerboseBinaryRecord record;
+
+	publishGCOp(env, "scavenge", duration, deltaTimeSuccess, &record);
+	publish(&record);
+}
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+
+void
+MM_VerboseHandlerBinaryStandard::handleHeapResize(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_HeapResizeEvent * event = (MM_HeapResizeEvent *)eventData;
+	HeapResizeType resizeType = (HeapResizeType) event->resizeType;
+	const char *reasonString = NULL;
+	const char *resizeTypeName = NULL;
+
+	if ((0 == event->amount) || ((HEAP_EXPAND == resizeType) && (SATISFY_COLLECTOR == (ExpandReason)event->reason))) {
+		/* as for the XML output, collector expansions are not reported on their own */
+		return;
+	}
+
+	getHeapResizeStrings(resizeType, event->reason, &resizeTypeName, &reasonString);
+
+	OMR_VerboseBinaryRecord record;
+	initRecord(&record, OMR_VERBOSE_BINARY_RECORD_HEAP_RESIZE, resizeTypeName, _manager->getIdAndIncrement(), 0);
+	record.payload.data[OMR_VERBOSE_BINARY_RESIZE_AMOUNT] = event->amount;
+	record.payload.data[OMR_VERBOSE_BINARY_RESIZE_COUNT] = 1;
+	record.payload.data[OMR_VERBOSE_BINARY_RESIZE_TIME] = event->timeTaken;
+	record.payload.data[OMR_VERBOSE_BINARY_RESIZE_SPACE] = getStringCode(getSubSpaceType(event->subSpaceType));
+	record.payload.data[OMR_VERBOSE_BINARY_RESIZE_REASON] = getStringCode(reasonString);
+	publish(&record);
+}
+
+static void
+verboseHandlerBinaryCycleStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseHandlerBinaryStandard *)userData)->handleCycleStart(hook, eventNum, eventData);
+}
+
+static void
+verboseHandlerBinaryCycleEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseHandlerBinaryStandard *)userData)->handleCycleEnd(hook, eventNum, eventData);
+}
+
+static void
+verboseHandlerBinaryGCStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseHandlerBinaryStandard *)userData)->handleGCStart(hook, eventNum, eventData);
+}
+
+static void
+verboseHandlerBinaryGCEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseHandlerBinaryStandard *)userData)->handleGCEnd(hook, eventNum, eventData);
+}
+
+static void
+verboseHandlerBinaryMarkEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseHandlerBinaryStandard *)userData)->handleMarkEnd(hook, eventNum, eventData);
+}
+
+static void
+verboseHandlerBinarySweepEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseHandlerBinaryStandard *)userData)->handleSweepEnd(hook, eventNum, eventData);
+}
+
+#if defined(OMR_GC_MODRON_COMPACTION)
+static void
+verboseHandlerBinaryCompactEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseHandlerBinaryStandard *)userData)->handleCompactEnd(hook, eventNum, eventData);
+}
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+static void
+verboseHandlerBinaryScavengeEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseHandlerBinaryStandard *)userData)->handleScavengeEnd(hook, eventNum, eventData);
+}
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+
+static void
+verboseHandlerBinaryHeapResize(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseHandlerBinaryStandard *)userData)->handleHeapResize(hook, eventNum, eventData);
+}
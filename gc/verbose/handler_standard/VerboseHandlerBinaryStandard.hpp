@@ -0,0 +1,103 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#if !defined(VERBOSEHANDLERBINARYSTANDARD_HPP_)
+#define VERBOSEHANDLERBINARYSTANDARD_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+
+#include "VerboseBinaryFormat.h"
+#include "VerboseHandlerOutputStandard.hpp"
+
+class MM_CollectionStatistics;
+class MM_EnvironmentBase;
+class MM_VerboseWriterFileLoggingBinary;
+
+/**
+ * Verbose handler for the standard collectors which reports to the binary file writer (-Xgc:binaryLogging)
+ * instead of formatting XML. It hooks the events of the cycle skeleton -- cycle start and end, increment
+ * start and end with heap snapshots, the mark, sweep, compact and scavenge phases and heap resizes -- and
+ * publishes each as a fixed size record. Type names are published once as dictionary entries, so a record
+ * carries only codes and numbers; vgcdecode turns a log back into verbosegc XML.
+ */
+class MM_VerboseHandlerBinaryStandard : public MM_VerboseHandlerOutputStandard
+{
+private:
+	MM_VerboseWriterFileLoggingBinary *_writer; /**< The writer records are published to, if one is configured */
+	volatile uintptr_t _strings[OMR_VERBOSE_BINARY_MAX_STRINGS]; /**< Dictionary: the string (by address) each code stands for, 0 for an unused code */
+
+protected:
+public:
+
+private:
+	/**
+	 * Answer the dictionary code for a string, publishing a STRING record for it the first time it is seen.
+	 * Strings are identified by address, so only pass strings with static storage duration.
+	 * @param[in] string the string to encode
+	 * @return the code for the string, or the code of "unknown" if the dictionary is full
+	 */
+	uint32_t getStringCode(const char *string);
+
+	/**
+	 * Initialize a record of the given type, stamped with the current time.
+	 */
+	void initRecord(OMR_VerboseBinaryRecord *record, uint16_t type, const char *name, uintptr_t id, uintptr_t contextId);
+
+	void publish(const OMR_VerboseBinaryRecord *record);
+	void publishMemoryInfo(MM_EnvironmentBase *env, MM_CollectionStatistics *stats);
+	void publishGCOp(MM_EnvironmentBase *env, const char *type, uint64_t duration, bool deltaTimeSuccess, OMR_VerboseBinaryRecord *record);
+
+protected:
+	virtual bool initialize(MM_EnvironmentBase *env, MM_VerboseManager *manager);
+
+	MM_VerboseHandlerBinaryStandard(MM_GCExtensionsBase *extensions)
+		: MM_VerboseHandlerOutputStandard(extensions)
+		, _writer(NULL)
+	{};
+
+public:
+	static MM_VerboseHandlerOutput *newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager);
+
+	/**
+	 * Attach to the binary writer and register only the hooks the binary records cover.
+	 */
+	virtual void enableVerbose();
+	virtual void disableVerbose();
+
+	void handleCycleStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+	void handleCycleEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+	void handleGCStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+	void handleGCEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+	void handleMarkEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+	void handleSweepEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+#if defined(OMR_GC_MODRON_COMPACTION)
+	void handleCompactEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	void handleScavengeEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+	void handleHeapResize(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+};
+
+#endif /* VERBOSEHANDLERBINARYSTANDARD_HPP_ */
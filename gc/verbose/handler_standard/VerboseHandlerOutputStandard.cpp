@@ -73,6 +73,9 @@ static void verboseHandlerConcurrentHalted(J9HookInterface** hook, uintptr_t eve
 static void verboseHandlerConcurrentCollectionStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
 static void verboseHandlerConcurrentAborted(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+static void verboseHandlerCompletedConcurrentSweep(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
 
 MM_VerboseHandlerOutput *
 MM_VerboseHandlerOutputStandard::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager)
@@ -155,6 +158,9 @@ MM_VerboseHandlerOutputStandard::enableVerbose()
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_COMPLETE_TRACING_END, verboseHandlerConcurrentTracingEnd, OMR_GET_CALLSITE(), (void *)this);
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_COLLECTION_CARD_CLEANING_END, verboseHandlerConcurrentCardCleaningEnd, OMR_GET_CALLSITE(), (void *)this);
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_COMPLETED_CONCURRENT_SWEEP, verboseHandlerCompletedConcurrentSweep, OMR_GET_CALLSITE(), (void *)this);
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
 
 	/* Excessive GC */
 	(*_mmOmrHooks)->J9HookRegisterWithCallSite(_mmOmrHooks, J9HOOK_MM_OMR_EXCESSIVEGC_RAISED, verboseHandlerExcessiveGCRaised, OMR_GET_CALLSITE(), this);
@@ -214,6 +220,9 @@ MM_VerboseHandlerOutputStandard::disableVerbose()
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_COMPLETE_TRACING_END, verboseHandlerConcurrentTracingEnd, NULL);
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_COLLECTION_CARD_CLEANING_END, verboseHandlerConcurrentCardCleaningEnd, NULL);
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_COMPLETED_CONCURRENT_SWEEP, verboseHandlerCompletedConcurrentSweep, NULL);
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
 
 	/* Excessive GC */
 	(*_mmOmrHooks)->J9HookUnregister(_mmOmrHooks, J9HOOK_MM_OMR_EXCESSIVEGC_RAISED, verboseHandlerExcessiveGCRaised, NULL);
@@ -297,6 +306,21 @@ MM_VerboseHandlerOutputStandard::handleMarkEnd(J9HookInterface** hook, uintptr_t
 
 	writer->formatAndOutput(env, 1, "<trace-info objectcount=\"%zu\" scancount=\"%zu\" scanbytes=\"%zu\" />",
 			markStats->_objectsMarked, markStats->_objectsScanned, markStats->_bytesScanned);
+	if (0 != extensions->markingPrefetchDepth) {
+		writer->formatAndOutput(env, 1, "<prefetch-ring depth=\"%zu\" hits=\"%zu\" misses=\"%zu\" />",
+				extensions->markingPrefetchDepth, markStats->_prefetchRingHits, markStats->_prefetchRingMisses);
+	}
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	if (0 != extensions->workStealingDequeSize) {
+		MM_WorkPacketStats *workPacketStats = &extensions->globalGCStats.workPacketStats;
+		writer->formatAndOutput(env, 1, "<work-stealing attempts=\"%zu\" steals=\"%zu\" donations=\"%zu\" />",
+				workPacketStats->workStealAttempts, workPacketStats->workStealSuccesses, workPacketStats->workStealingDonations);
+	}
+	if (extensions->numaAwarePacketLists) {
+		writer->formatAndOutput(env, 1, "<numa-packets local=\"%zu\" remote=\"%zu\" />",
+				markStats->_packetsAcquiredLocal, markStats->_packetsAcquiredRemote);
+	}
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
 	handleMarkEndInternal(env, eventData);
 
@@ -372,6 +396,10 @@ MM_VerboseHandlerOutputStandard::handleCompactEnd(J9HookInterface** hook, uintpt
 	if(COMPACT_PREVENTED_NONE == compactStats->_compactPreventedReason) {
 		writer->formatAndOutput(env, 1, "<compact-info movecount=\"%zu\" movebytes=\"%zu\" reason=\"%s\" />",
 				compactStats->_movedObjects, compactStats->_movedBytes, getCompactionReasonAsString(compactStats->_compactReason));
+		if (0 != compactStats->_incrementSubAreas) {
+			writer->formatAndOutput(env, 1, "<compact-increment subareas=\"%zu\" fragmentedbytes=\"%zu\" livebytes=\"%zu\" fixupobjects=\"%zu\" />",
+					compactStats->_incrementSubAreas, compactStats->_incrementFragmentedBytes, compactStats->_incrementLiveBytes, compactStats->_fixupObjects);
+		}
 	} else {
 		writer->formatAndOutput(env, 1, "<compact-info reason=\"%s\" />", getCompactionReasonAsString(compactStats->_compactReason));
 		writer->formatAndOutput(env, 1, "<warning details=\"compaction prevented due to %s\" />", getCompactionPreventedReasonAsString(compactStats->_compactPreventedReason));
@@ -412,6 +440,11 @@ MM_VerboseHandlerOutputStandard::handleScavengeEndNoLock(J9HookInterface** hook,
 	if (event->cycleEnd) {
 		writer->formatAndOutput(env, 1, "<scavenger-info tenureage=\"%zu\" tenuremask=\"%4zx\" tiltratio=\"%zu\" />",
 				cycleScavengerStats->_tenureAge, cycleScavengerStats->getFlipHistory(0)->_tenureMask, cycleScavengerStats->_tiltRatio);
+		if (0 != cycleScavengerStats->_tenureCostAge) {
+			writer->formatAndOutput(env, 1, "<tenure-cost age=\"%zu\" copybytes=\"%zu\" garbagebytes=\"%zu\" survivorbytes=\"%zu\" />",
+					cycleScavengerStats->_tenureCostAge, cycleScavengerStats->_tenureCostCopyBytes,
+					cycleScavengerStats->_tenureCostGarbageBytes, cycleScavengerStats->_tenureCostSurvivorBytes);
+		}
 	}
 
 	if (0 != scavengerStats->_flipCount) {
@@ -430,6 +463,23 @@ MM_VerboseHandlerOutputStandard::handleScavengeEndNoLock(J9HookInterface** hook,
 		writer->formatAndOutput(env, 1, "<copy-failed type=\"tenure\" objects=\"%zu\" bytes=\"%zu\" />",
 				scavengerStats->_failedTenureCount, scavengerStats->_failedTenureBytes);
 	}
+	if ((0 != scavengerStats->_nonTemporalCopyBytes) || (0 != scavengerStats->_chunkedCopyBytes)) {
+		writer->formatAndOutput(env, 1, "<memory-copied-modes nontemporalbytes=\"%zu\" chunkedbytes=\"%zu\" helpedbytes=\"%zu\" />",
+				scavengerStats->_nonTemporalCopyBytes, scavengerStats->_chunkedCopyBytes, scavengerStats->_chunkedCopyHelpedBytes);
+	}
+#if defined(OMR_GC_AUTO_HOT_FIELDS)
+	if (extensions->scavengerAutoHotFields) {
+		writer->formatAndOutput(env, 1, "<hot-fields sampled=\"%zu\" shapes=\"%zu\" depthcopies=\"%zu\" />",
+				scavengerStats->_hotFieldSampledObjects, cycleScavengerStats->_hotFieldLearnedShapes, scavengerStats->_hotFieldDepthCopies);
+	}
+#endif /* defined(OMR_GC_AUTO_HOT_FIELDS) */
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	if (0 != scavengerStats->_readObjectBarrierUpdate) {
+		writer->formatAndOutput(env, 1, "<read-barrier copied=\"%llu\" updated=\"%llu\" flipbytes=\"%zu\" tenurebytes=\"%zu\" />",
+				scavengerStats->_readObjectBarrierCopy, scavengerStats->_readObjectBarrierUpdate,
+				scavengerStats->_readObjectBarrierFlipBytes, scavengerStats->_readObjectBarrierTenureBytes);
+	}
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
 
 	handleScavengeEndInternal(env, eventData);
 	
@@ -541,6 +591,22 @@ MM_VerboseHandlerOutputStandard::handleConcurrentMarkEnd(J9HookInterface** hook,
 			const char* cardCleaningReasonString = getCardCleaningReasonString(collectionStats->getCardCleaningReason());
 			writer->formatAndOutput(env, 1, "<card-cleaning reason=\"%s\" bytesTraced=\"%zu\" cardsCleaned=\"%zu\" />", cardCleaningReasonString, (collectionStats->getConHelperCardCleanCount() + collectionStats->getCardCleanCount()), stats->_cardTableStats->getConcurrentCleanedCards());
 		}
+		/* dirty cards found after a run of 0, 1-15, 16-255, 256-4095 and 4096+ clean cards */
+		volatile uintptr_t *cleanRuns = stats->_cardTableStats->cleanRunHistogram;
+		if (0 != (cleanRuns[0] | cleanRuns[1] | cleanRuns[2] | cleanRuns[3] | cleanRuns[4])) {
+			writer->formatAndOutput(env, 1, "<card-density adjacent=\"%zu\" near=\"%zu\" scattered=\"%zu\" sparse=\"%zu\" isolated=\"%zu\" />",
+				cleanRuns[0], cleanRuns[1], cleanRuns[2], cleanRuns[3], cleanRuns[4]);
+		}
+	}
+	if (0 != collectionStats->getDedicatedMarkThreads()) {
+		writer->formatAndOutput(env, 1, "<dedicated-mark threads=\"%zu\" cpus=\"%.2f\" cputimems=\"%llu.%03.3llu\" elapsedms=\"%llu.%03.3llu\" />",
+			collectionStats->getDedicatedMarkThreads(), collectionStats->getDedicatedMarkCPUs(),
+			collectionStats->getDedicatedMarkCPUTime() / 1000, collectionStats->getDedicatedMarkCPUTime() % 1000,
+			collectionStats->getDedicatedMarkElapsedTime() / 1000, collectionStats->getDedicatedMarkElapsedTime() % 1000);
+	}
+	if (0 != collectionStats->getBarrierPacketsFlushed()) {
+		writer->formatAndOutput(env, 1, "<satb-barrier packetsFlushed=\"%zu\" batches=\"%zu\" contended=\"%zu\" />",
+			collectionStats->getBarrierPacketsFlushed(), collectionStats->getBarrierPacketBatches(), collectionStats->getBarrierPacketFlushContention());
 	}
 	handleGCOPOuterStanzaEnd(env);
 	writer->flush(env);
@@ -678,6 +744,18 @@ MM_VerboseHandlerOutputStandard::handleConcurrentKickoff(J9HookInterface** hook,
 				env, 1, "<kickoff reason=\"%s\" targetBytes=\"%zu\" thresholdFreeBytes=\"%zu\" remainingFree=\"%zu\" tenureFreeBytes=\"%zu\" />",
 				reasonString, event->traceTarget, event->kickOffThreshold, event->remainingFree, event->commonData->tenureFreeBytes);
 	}
+	MM_ConcurrentGCStats *concurrentStats = (MM_ConcurrentGCStats *)event->concurrentStats;
+	if ((NULL != concurrentStats) && (0.0f < concurrentStats->getPacingKickoffScale())) {
+		writer->formatAndOutput(
+				env, 1, "<pacing kickoffScale=\"%.3f\" unpacedThresholdBytes=\"%zu\" allocatedBytesPerMs=\"%zu\" markedBytesPerMs=\"%zu\" helperTraceRate=\"%.3f\" />",
+				concurrentStats->getPacingKickoffScale(), concurrentStats->getPacingUnpacedKickoffThreshold(), concurrentStats->getPacingAllocationRate(),
+				concurrentStats->getPacingMarkRate(), concurrentStats->getPacingConHelperTraceRate());
+	}
+	if ((NULL != concurrentStats) && (0 != concurrentStats->getDedicatedMarkThreads())) {
+		writer->formatAndOutput(
+				env, 1, "<dedicated-mark threads=\"%zu\" cpus=\"%.2f\" />",
+				concurrentStats->getDedicatedMarkThreads(), concurrentStats->getDedicatedMarkCPUs());
+	}
 	writer->formatAndOutput(env, 0, "</concurrent-kickoff>");
 	writer->flush(env);
 
@@ -872,6 +950,53 @@ MM_VerboseHandlerOutputStandard::handleConcurrentAbortedInternal(MM_EnvironmentB
 }
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+void
+MM_VerboseHandlerOutputStandard::handleCompletedConcurrentSweep(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_CompletedConcurrentSweep* event = (MM_CompletedConcurrentSweep*)eventData;
+	MM_VerboseManager* manager = getManager();
+	MM_VerboseWriterChain* writer = manager->getWriterChain();
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	char tagTemplate[100];
+
+	const char* reason;
+	switch((SweepCompletionReason)event->reason) {
+	case ABOUT_TO_GC:
+		reason = "about to gc";
+		break;
+	case COMPACTION_REQUIRED:
+		reason = "compaction required";
+		break;
+	case CONTRACTION_REQUIRED:
+		reason = "contraction required";
+		break;
+	case EXPANSION_REQUIRED:
+		reason = "expansion required";
+		break;
+	case LOA_RESIZE:
+		reason = "loa resize";
+		break;
+	case SYSTEM_GC:
+		reason = "system gc";
+		break;
+	default:
+		reason = "unknown";
+		break;
+	}
+
+	enterAtomicReportingBlock();
+	getTagTemplate(tagTemplate, sizeof(tagTemplate), manager->getIdAndIncrement(), omrtime_current_time_millis());
+	writer->formatAndOutput(env, 0, "<concurrent-sweep-end %s>", tagTemplate);
+	writer->formatAndOutput(env, 1, "<sweep lazybytes=\"%zu\" completebytes=\"%zu\" connectbytes=\"%zu\" reason=\"%s\" />",
+			event->lazyBytesSwept, event->bytesSwept, event->bytesConnected, reason);
+	writer->formatAndOutput(env, 0, "</concurrent-sweep-end>");
+	writer->flush(env);
+	exitAtomicReportingBlock();
+}
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
+
 bool
 MM_VerboseHandlerOutputStandard::hasOutputMemoryInfoInnerStanza()
 {
@@ -1144,6 +1269,14 @@ verboseHandlerConcurrentAborted(J9HookInterface** hook, uintptr_t eventNum, void
 }
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+void
+verboseHandlerCompletedConcurrentSweep(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseHandlerOutputStandard *)userData)->handleCompletedConcurrentSweep(hook, eventNum, eventData);
+}
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
+
 void
 verboseHandlerExcessiveGCRaised(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
 {
@@ -217,6 +217,16 @@ public:
 	 */
 	void handleConcurrentAborted(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+	/**
+	 * Write verbose stanza for the completion of a lazy (concurrent) sweep.
+	 * @param hook Hook interface used by the JVM.
+	 * @param eventNum The hook event number.
+	 * @param eventData hook specific event data.
+	 */
+	void handleCompletedConcurrentSweep(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
 };
 
 #endif /* VERBOSEHANDLEROUTPUTSTANDARD_HPP_ */
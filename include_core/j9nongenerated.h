@@ -218,6 +218,11 @@ typedef struct J9MemorySegmentList {
 
 #if defined(OMR_GC_REALTIME)
 
+/* A global fragment index equal to this value means the SATB barrier is disabled (@see MM_RememberedSetSATB) */
+#if !defined(J9GC_REMEMBERED_SET_RESERVED_INDEX)
+#define J9GC_REMEMBERED_SET_RESERVED_INDEX 0
+#endif /* !defined(J9GC_REMEMBERED_SET_RESERVED_INDEX) */
+
 typedef struct MM_GCRememberedSet {
 	uintptr_t globalFragmentIndex;
 	uintptr_t preservedGlobalFragmentIndex;
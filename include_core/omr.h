@@ -150,6 +150,9 @@ typedef struct OMR_VM {
 	omrthread_monitor_t _gcCycleOnMonitor;
 	uintptr_t _gcCycleOn;
 #endif /* defined(OMR_GC_REALTIME) */
+#if defined(OMR_RAS_TDF_TRACE)
+	void *_allocationProfiler;
+#endif /* OMR_RAS_TDF_TRACE */
 } OMR_VM;
 
 typedef struct OMR_VMThread {
@@ -185,6 +188,7 @@ typedef struct OMR_VMThread {
 
 	void *_savedObject1; /**< holds new object allocation until object can be attached to reference graph (see MM_AllocationDescription::save/restoreObjects()) */
 	void *_savedObject2; /**< holds new object allocation until object can be attached to reference graph (see MM_AllocationDescription::save/restoreObjects()) */
+	uintptr_t _allocationSampleBytes; /**< bytes represented by the allocation sample being reported, 0 when no sample is pending */
 } OMR_VMThread;
 
 #if defined(OMR_GC_COMPRESSED_POINTERS)
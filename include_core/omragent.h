@@ -43,6 +43,18 @@ extern "C" {
 
 typedef struct OMR_TI_MemoryCategory OMR_TI_MemoryCategory;
 typedef struct OMR_SampledMethodDescription OMR_SampledMethodDescription;
+typedef struct OMR_TI_AllocationSite OMR_TI_AllocationSite;
+typedef struct OMR_TI_HeapObject OMR_TI_HeapObject;
+
+/**
+ * Receives a batch of heap objects from IterateHeap().
+ *
+ * @param[in] vmThread The OMR VM thread of the GC thread reporting the batch.
+ * @param[in] objects The objects in the batch. Only valid for the duration of the call.
+ * @param[in] objectCount The number of objects in the batch.
+ * @param[in] userData The userData passed to IterateHeap().
+ */
+typedef void (*OMR_TI_HeapObjectsCallback)(OMR_VMThread *vmThread, const OMR_TI_HeapObject *objects, uintptr_t objectCount, void *userData);
 
 typedef struct OMR_TI {
 	int32_t version;
@@ -302,6 +314,84 @@ typedef struct OMR_TI {
 	 * @retval OMR_ERROR_ILLEGAL_ARGUMENT A NULL pointer was passed in for an output parameter.
 	 */
 	omr_error_t (*GetMethodProperties)(OMR_VMThread *vmThread, size_t *numProperties, const char *const **propertyNames, size_t *sizeofSampledMethodDesc);
+
+	/**
+	 * Start sampling object allocations.
+	 *
+	 * The GC reports a sample each time a thread has allocated samplingInterval bytes from the heap
+	 * since its previous sample. Allocations are observed when a thread refreshes its TLH, so a sample
+	 * represents all of the bytes allocated since the previous sample, not only the last object.
+	 * The language runtime walks the allocating thread's stack in response, and the sample is charged
+	 * to the method of the top-most frame. See omr_ras_sampleStackTraceStart().
+	 *
+	 * Restarting sampling discards the sites collected so far.
+	 *
+	 * @param[in] vmThread The current OMR VM thread.
+	 * @param[in] samplingInterval The number of bytes to allocate between samples. Must be non-zero.
+	 * @param[in] maxSites The number of heaviest allocation sites to retain. Must be non-zero.
+	 *
+	 * @return An OMR error code.
+	 * @retval OMR_ERROR_NONE Success.
+	 * @retval OMR_THREAD_NOT_ATTACHED vmThread is NULL.
+	 * @retval OMR_ERROR_ILLEGAL_ARGUMENT samplingInterval or maxSites is zero.
+	 * @retval OMR_ERROR_NOT_AVAILABLE The GC is not available.
+	 * @retval OMR_ERROR_OUT_OF_NATIVE_MEMORY Unable to allocate native memory for the allocation sites.
+	 */
+	omr_error_t (*StartAllocationSampling)(OMR_VMThread *vmThread, uintptr_t samplingInterval, uint32_t maxSites);
+
+	/**
+	 * Stop sampling object allocations. The sites collected so far remain available from GetAllocationSites().
+	 *
+	 * @param[in] vmThread The current OMR VM thread.
+	 *
+	 * @return An OMR error code.
+	 * @retval OMR_ERROR_NONE Success.
+	 * @retval OMR_THREAD_NOT_ATTACHED vmThread is NULL.
+	 * @retval OMR_ERROR_NOT_AVAILABLE Allocation sampling has never been started.
+	 */
+	omr_error_t (*StopAllocationSampling)(OMR_VMThread *vmThread);
+
+	/**
+	 * Retrieve the allocation sites that have been charged the most sampled bytes, heaviest first.
+	 *
+	 * Method keys can be resolved using GetMethodDescriptions().
+	 *
+	 * @param[in] vmThread The current OMR VM thread.
+	 * @param[in] maxSites The number of elements in sites.
+	 * @param[out] sites A pre-allocated buffer where the allocation sites will be written.
+	 * @param[out] writtenCount The number of allocation sites written to sites. Must be non-NULL.
+	 * @param[out] sampledBytes The total number of sampled bytes, including bytes charged to sites
+	 *             that are no longer retained. May be NULL.
+	 *
+	 * @return An OMR error code.
+	 * @retval OMR_ERROR_NONE Success.
+	 * @retval OMR_THREAD_NOT_ATTACHED vmThread is NULL.
+	 * @retval OMR_ERROR_ILLEGAL_ARGUMENT maxSites is negative, or a NULL pointer was passed in for sites or writtenCount.
+	 * @retval OMR_ERROR_NOT_AVAILABLE Allocation sampling has never been started.
+	 */
+	omr_error_t (*GetAllocationSites)(OMR_VMThread *vmThread, int32_t maxSites, OMR_TI_AllocationSite *sites, int32_t *writtenCount, uint64_t *sampledBytes);
+
+	/**
+	 * Report every live object in the heap to an agent callback, in batches.
+	 *
+	 * The calling thread acquires exclusive VM access for the duration of the iteration. The heap is marked and
+	 * then walked in parallel by the GC threads, each of which reports the live objects it finds in its own batches.
+	 * The callback is therefore invoked concurrently from several threads, in no particular order, and must not
+	 * allocate from the heap or request VM access.
+	 *
+	 * @param[in] vmThread The current OMR VM thread.
+	 * @param[in] batchSize The maximum number of objects in each batch. Must be non-zero.
+	 * @param[in] callback The function that receives each batch.
+	 * @param[in] userData Passed through to callback.
+	 *
+	 * @return An OMR error code.
+	 * @retval OMR_ERROR_NONE Success.
+	 * @retval OMR_THREAD_NOT_ATTACHED vmThread is NULL.
+	 * @retval OMR_ERROR_ILLEGAL_ARGUMENT batchSize is zero, or callback is NULL.
+	 * @retval OMR_ERROR_NOT_AVAILABLE The GC is not available, or its collector does not support parallel heap iteration.
+	 * @retval OMR_ERROR_OUT_OF_NATIVE_MEMORY Unable to allocate native memory for the batches.
+	 */
+	omr_error_t (*IterateHeap)(OMR_VMThread *vmThread, uintptr_t batchSize, OMR_TI_HeapObjectsCallback callback, void *userData);
 } OMR_TI;
 
 /*
@@ -353,6 +443,28 @@ struct OMR_SampledMethodDescription {
 	const char *propertyValues[];
 };
 
+/**
+ * An allocation site returned by GetAllocationSites().
+ */
+struct OMR_TI_AllocationSite {
+	/* Key of the method at the top of the allocating stack */
+	const void *methodKey;
+
+	/* Sampled bytes charged to this site */
+	uint64_t bytes;
+};
+
+/**
+ * A heap object reported by IterateHeap().
+ */
+struct OMR_TI_HeapObject {
+	/* The object */
+	void *object;
+
+	/* Size of the object in the heap in bytes, including its header */
+	uintptr_t size;
+};
+
 typedef struct OMR_AgentCallbacks {
 	uint32_t version; /* version counter, initially 0 */
 	omr_error_t (*onPreFork)(void);
@@ -114,6 +114,10 @@ omr_error_t omrtiGetMethodDescriptions(OMR_VMThread *vmThread, void **methodArra
 	OMR_SampledMethodDescription *methodDescriptions, char *nameBuffer, size_t nameBytes,
 	size_t *firstRetryMethod, size_t *nameBytesRemaining);
 omr_error_t omrtiGetMethodProperties(OMR_VMThread *vmThread, size_t *numProperties, const char *const **propertyNames, size_t *sizeofSampledMethodDesc);
+omr_error_t omrtiStartAllocationSampling(OMR_VMThread *vmThread, uintptr_t samplingInterval, uint32_t maxSites);
+omr_error_t omrtiStopAllocationSampling(OMR_VMThread *vmThread);
+omr_error_t omrtiGetAllocationSites(OMR_VMThread *vmThread, int32_t maxSites, OMR_TI_AllocationSite *sites, int32_t *writtenCount, uint64_t *sampledBytes);
+omr_error_t omrtiIterateHeap(OMR_VMThread *vmThread, uintptr_t batchSize, OMR_TI_HeapObjectsCallback callback, void *userData);
 
 /* This is an internal API which is subject to change without notice. Agents must not use this API. */
 typedef struct OMR_ThreadAPI {
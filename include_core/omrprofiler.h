@@ -82,6 +82,32 @@ void omr_ras_cleanupMethodDictionary(OMR_VM *vm);
  */
 omr_error_t omr_ras_insertMethodDictionary(OMR_VM *vm, OMR_MethodDictionaryEntry *entry);
 
+/* ---------------- OMR_AllocationProfiler.cpp ---------------- */
+
+/**
+ * @brief Allocate and initialize the VM's allocation profiler.
+ *
+ * If the VM's allocation profiler is already allocated, its samples are discarded
+ * and it is resized to hold maxSites sites.
+ *
+ * @param[in] vm The OMR VM.
+ * @param[in] maxSites Number of allocation sites to retain. Must be non-zero.
+ * @return An OMR error code.
+ * @retval OMR_ERROR_NONE Success.
+ * @retval OMR_ERROR_ILLEGAL_ARGUMENT maxSites is zero or too large.
+ * @retval OMR_ERROR_OUT_OF_NATIVE_MEMORY Unable to allocate native memory for the allocation profiler.
+ * @retval OMR_ERROR_FAILED_TO_ALLOCATE_MONITOR Unable to allocate the allocation profiler's lock.
+ * @retval OMR_ERROR_FAILED_TO_ATTACH_NATIVE_THREAD Unable to attach to the omrthread library.
+ */
+omr_error_t omr_ras_initAllocationProfiler(OMR_VM *vm, uint32_t maxSites);
+
+/**
+ * @brief Deallocate the VM's allocation profiler.
+ *
+ * @param[in] vm The OMR VM.
+ */
+void omr_ras_cleanupAllocationProfiler(OMR_VM *vm);
+
 /* ---------------- OMR_Profiler.cpp ---------------- */
 /**
  * @brief Trace the current thread's top-most stack frame.
@@ -90,6 +116,9 @@ omr_error_t omr_ras_insertMethodDictionary(OMR_VM *vm, OMR_MethodDictionaryEntry
  * This allows omrglue code to be compiled without access to tracegen-generated
  * header files.
  *
+ * If the stack is being walked for an allocation sample (omrVMThread->_allocationSampleBytes
+ * is non-zero), the sampled bytes are also charged to methodKey in the VM's allocation profiler.
+ *
  * @pre The current thread must be attached to the OMR VM.
  *
  * @param[in] omrVMThread The current OMR VM thread. Must not be NULL.
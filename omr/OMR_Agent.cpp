@@ -61,7 +61,11 @@ OMR_TI const OMR_Agent::theOmrTI = {
 	omrtiGetProcessPrivateMemorySize,
 	omrtiGetProcessPhysicalMemorySize,
 	omrtiGetMethodDescriptions,
-	omrtiGetMethodProperties
+	omrtiGetMethodProperties,
+	omrtiStartAllocationSampling,
+	omrtiStopAllocationSampling,
+	omrtiGetAllocationSites,
+	omrtiIterateHeap
 };
 
 extern "C" OMR_Agent *
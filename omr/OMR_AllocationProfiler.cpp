@@ -0,0 +1,187 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "OMR_AllocationProfiler.hpp"
+
+#include "omrport.h"
+
+/* Track twice as many sites as requested, so that the reported top sites are not skewed by recent evictions. */
+#define OMR_ALLOCATIONPROFILER_SITE_FACTOR 2
+
+omr_error_t
+omr_ras_initAllocationProfiler(OMR_VM *vm, uint32_t maxSites)
+{
+	omr_error_t rc = OMR_ERROR_NONE;
+	if ((0 == maxSites) || (maxSites > (UINT32_MAX / OMR_ALLOCATIONPROFILER_SITE_FACTOR))) {
+		rc = OMR_ERROR_ILLEGAL_ARGUMENT;
+	} else if (NULL == vm->_allocationProfiler) {
+		OMRPORT_ACCESS_FROM_OMRVM(vm);
+		OMR_AllocationProfiler *allocationProfiler =
+			(OMR_AllocationProfiler *)omrmem_allocate_memory(sizeof(*allocationProfiler), OMRMEM_CATEGORY_OMRTI);
+		if (NULL != allocationProfiler) {
+			rc = allocationProfiler->init(vm, maxSites);
+			if (OMR_ERROR_NONE == rc) {
+				vm->_allocationProfiler = allocationProfiler;
+			} else {
+				omrmem_free_memory(allocationProfiler);
+			}
+		} else {
+			rc = OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+		}
+	} else {
+		rc = ((OMR_AllocationProfiler *)vm->_allocationProfiler)->reset(maxSites);
+	}
+	return rc;
+}
+
+void
+omr_ras_cleanupAllocationProfiler(OMR_VM *vm)
+{
+	if (NULL != vm->_allocationProfiler) {
+		OMRPORT_ACCESS_FROM_OMRVM(vm);
+		((OMR_AllocationProfiler *)vm->_allocationProfiler)->cleanup();
+		omrmem_free_memory(vm->_allocationProfiler);
+		vm->_allocationProfiler = NULL;
+	}
+}
+
+omr_error_t
+OMR_AllocationProfiler::init(OMR_VM *vm, uint32_t maxSites)
+{
+	_lock = NULL;
+	_sites = NULL;
+	_maxSites = maxSites;
+	_sampledBytes = 0;
+	_vm = vm;
+
+	omr_error_t rc = OMR_ERROR_NONE;
+	omrthread_t self = NULL;
+	if (0 == omrthread_attach_ex(&self, J9THREAD_ATTR_DEFAULT)) {
+		_sites = newSites(maxSites);
+		if (NULL != _sites) {
+			if (0 != omrthread_monitor_init_with_name(&_lock, 0, "omrVM->_allocationProfiler")) {
+				rc = OMR_ERROR_FAILED_TO_ALLOCATE_MONITOR;
+			}
+		} else {
+			rc = OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+		}
+
+		if (OMR_ERROR_NONE != rc) {
+			cleanup();
+		}
+		omrthread_detach(self);
+	} else {
+		rc = OMR_ERROR_FAILED_TO_ATTACH_NATIVE_THREAD;
+	}
+	return rc;
+}
+
+void
+OMR_AllocationProfiler::cleanup()
+{
+	if (NULL != _vm) {
+		omrthread_t self = NULL;
+		if (0 == omrthread_attach_ex(&self, J9THREAD_ATTR_DEFAULT)) {
+			if (NULL != _sites) {
+				spaceSavingFree(_sites);
+				_sites = NULL;
+			}
+			if (NULL != _lock) {
+				omrthread_monitor_destroy(_lock);
+				_lock = NULL;
+			}
+			_vm = NULL;
+			omrthread_detach(self);
+		}
+	}
+}
+
+/**
+ * Discard all samples and resize the site table. Samples may be recorded concurrently,
+ * so the new table is swapped in under the lock and the old one is freed afterwards.
+ */
+omr_error_t
+OMR_AllocationProfiler::reset(uint32_t maxSites)
+{
+	omr_error_t rc = OMR_ERROR_NONE;
+	omrthread_t self = NULL;
+	if (0 == omrthread_attach_ex(&self, J9THREAD_ATTR_DEFAULT)) {
+		OMRSpaceSaving *sites = newSites(maxSites);
+		if (NULL != sites) {
+			omrthread_monitor_enter_using_threadId(_lock, self);
+			OMRSpaceSaving *oldSites = _sites;
+			_sites = sites;
+			_maxSites = maxSites;
+			_sampledBytes = 0;
+			omrthread_monitor_exit_using_threadId(_lock, self);
+			spaceSavingFree(oldSites);
+		} else {
+			rc = OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+		}
+		omrthread_detach(self);
+	} else {
+		rc = OMR_ERROR_FAILED_TO_ATTACH_NATIVE_THREAD;
+	}
+	return rc;
+}
+
+/*
+ * Called by the allocating thread, which is attached to the VM.
+ */
+void
+OMR_AllocationProfiler::record(const void *methodKey, uintptr_t bytes)
+{
+	omrthread_monitor_enter(_lock);
+	spaceSavingUpdate(_sites, (void *)methodKey, bytes);
+	_sampledBytes += bytes;
+	omrthread_monitor_exit(_lock);
+}
+
+void
+OMR_AllocationProfiler::getSites(int32_t maxSites, OMR_TI_AllocationSite *sites, int32_t *writtenCount, uint64_t *sampledBytes)
+{
+	omrthread_monitor_enter(_lock);
+	uintptr_t count = spaceSavingGetCurSize(_sites);
+	if (count > _maxSites) {
+		count = _maxSites;
+	}
+	if (count > (uintptr_t)maxSites) {
+		count = (uintptr_t)maxSites;
+	}
+	/* space saving ranks are 1-based, heaviest first */
+	for (uintptr_t i = 0; i < count; i++) {
+		sites[i].methodKey = spaceSavingGetKthMostFreq(_sites, i + 1);
+		sites[i].bytes = spaceSavingGetKthMostFreqCount(_sites, i + 1);
+	}
+	*writtenCount = (int32_t)count;
+	if (NULL != sampledBytes) {
+		*sampledBytes = _sampledBytes;
+	}
+	omrthread_monitor_exit(_lock);
+}
+
+OMRSpaceSaving *
+OMR_AllocationProfiler::newSites(uint32_t maxSites)
+{
+	OMRPORT_ACCESS_FROM_OMRVM(_vm);
+	return spaceSavingNew(OMRPORTLIB, maxSites * OMR_ALLOCATIONPROFILER_SITE_FACTOR);
+}
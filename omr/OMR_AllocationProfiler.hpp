@@ -0,0 +1,70 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#if !defined(OMR_ALLOCATIONPROFILER_HPP_INCLUDED)
+#define OMR_ALLOCATIONPROFILER_HPP_INCLUDED
+
+#include "omr.h"
+#include "omragent.h"
+#include "omrprofiler.h"
+#include "spacesaving.h"
+#include "thread_api.h"
+
+/**
+ * Aggregates sampled allocations by the method at the top of the allocating thread's stack.
+ *
+ * Samples are reported by the GC through the J9HOOK_MM_OMR_ALLOCATION_SAMPLE hook. The language
+ * listener walks the allocating thread's stack, and omr_ras_sampleStackTraceStart() charges the
+ * sampled bytes to the top-most frame's method key. Only the heaviest sites are retained, using
+ * the space saving top-K approximation.
+ */
+class OMR_AllocationProfiler
+{
+/*
+ * Data members
+ */
+public:
+protected:
+private:
+	omrthread_monitor_t _lock;
+	OMRSpaceSaving *_sites; /**< sampled bytes keyed by method key */
+	uint32_t _maxSites; /**< number of sites requested by the agent */
+	uint64_t _sampledBytes; /**< total bytes charged to all sites, including evicted ones */
+	OMR_VM *_vm;
+
+/*
+ * Function members
+ */
+public:
+	omr_error_t init(OMR_VM *vm, uint32_t maxSites);
+	void cleanup();
+	omr_error_t reset(uint32_t maxSites);
+	void record(const void *methodKey, uintptr_t bytes);
+	void getSites(int32_t maxSites, OMR_TI_AllocationSite *sites, int32_t *writtenCount, uint64_t *sampledBytes);
+
+protected:
+
+private:
+	OMRSpaceSaving *newSites(uint32_t maxSites);
+};
+
+#endif /* defined(OMR_ALLOCATIONPROFILER_HPP_INCLUDED) */
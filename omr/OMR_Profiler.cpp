@@ -23,10 +23,23 @@
 #include "omrprofiler.h"
 #include "ut_omrti.h"
 
+#include "OMR_AllocationProfiler.hpp"
+
 void
 omr_ras_sampleStackTraceStart(OMR_VMThread *omrVMThread, const void *methodKey)
 {
 	Trc_OMRPROF_MethodSampleStart(omrVMThread, methodKey);
+#if defined(OMR_RAS_TDF_TRACE)
+	uintptr_t sampleBytes = omrVMThread->_allocationSampleBytes;
+	if (0 != sampleBytes) {
+		/* only the top-most frame is charged for the sample */
+		omrVMThread->_allocationSampleBytes = 0;
+		OMR_AllocationProfiler *allocationProfiler = (OMR_AllocationProfiler *)omrVMThread->_vm->_allocationProfiler;
+		if (NULL != allocationProfiler) {
+			allocationProfiler->record(methodKey, sampleBytes);
+		}
+	}
+#endif /* OMR_RAS_TDF_TRACE */
 }
 
 void
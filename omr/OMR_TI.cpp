@@ -28,6 +28,10 @@
 #include "omrtrace.h"
 #include "ut_omrti.h"
 
+#if defined(OMR_GC)
+#include "omrgc.h"
+#endif /* defined(OMR_GC) */
+#include "OMR_AllocationProfiler.hpp"
 #include "OMR_MethodDictionary.hpp"
 #include "OMR_VM.hpp"
 
@@ -871,3 +875,112 @@ omrtiGetMethodProperties(OMR_VMThread *vmThread, size_t *numProperties, const ch
 	}
 	return rc;
 }
+
+omr_error_t
+omrtiStartAllocationSampling(OMR_VMThread *vmThread, uintptr_t samplingInterval, uint32_t maxSites)
+{
+	omr_error_t rc = OMR_ERROR_NONE;
+
+	OMR_TI_ENTER_FROM_VM_THREAD(vmThread);
+
+	if (NULL == vmThread) {
+		rc = OMR_THREAD_NOT_ATTACHED;
+	} else if ((0 == samplingInterval) || (0 == maxSites)) {
+		rc = OMR_ERROR_ILLEGAL_ARGUMENT;
+	} else {
+#if defined(OMR_GC)
+		rc = omr_ras_initAllocationProfiler(vmThread->_vm, maxSites);
+		if (OMR_ERROR_NONE == rc) {
+			rc = OMR_GC_SetAllocationSamplingInterval(vmThread, samplingInterval);
+			if (OMR_ERROR_NONE != rc) {
+				omr_ras_cleanupAllocationProfiler(vmThread->_vm);
+			}
+		}
+#else /* defined(OMR_GC) */
+		rc = OMR_ERROR_NOT_AVAILABLE;
+#endif /* defined(OMR_GC) */
+	}
+	OMR_TI_RETURN(vmThread, rc);
+}
+
+omr_error_t
+omrtiStopAllocationSampling(OMR_VMThread *vmThread)
+{
+	omr_error_t rc = OMR_ERROR_NONE;
+
+	OMR_TI_ENTER_FROM_VM_THREAD(vmThread);
+
+	if (NULL == vmThread) {
+		rc = OMR_THREAD_NOT_ATTACHED;
+	} else if (NULL == vmThread->_vm->_allocationProfiler) {
+		rc = OMR_ERROR_NOT_AVAILABLE;
+	} else {
+#if defined(OMR_GC)
+		rc = OMR_GC_SetAllocationSamplingInterval(vmThread, 0);
+#endif /* defined(OMR_GC) */
+	}
+	OMR_TI_RETURN(vmThread, rc);
+}
+
+omr_error_t
+omrtiGetAllocationSites(OMR_VMThread *vmThread, int32_t maxSites, OMR_TI_AllocationSite *sites, int32_t *writtenCount, uint64_t *sampledBytes)
+{
+	omr_error_t rc = OMR_ERROR_NONE;
+
+	OMR_TI_ENTER_FROM_VM_THREAD(vmThread);
+
+	if (NULL == vmThread) {
+		rc = OMR_THREAD_NOT_ATTACHED;
+	} else if (NULL == vmThread->_vm->_allocationProfiler) {
+		rc = OMR_ERROR_NOT_AVAILABLE;
+	} else if ((maxSites < 0) || (NULL == writtenCount) || ((0 != maxSites) && (NULL == sites))) {
+		rc = OMR_ERROR_ILLEGAL_ARGUMENT;
+	} else {
+		OMR_AllocationProfiler *const allocationProfiler = (OMR_AllocationProfiler *)vmThread->_vm->_allocationProfiler;
+		allocationProfiler->getSites(maxSites, sites, writtenCount, sampledBytes);
+	}
+	OMR_TI_RETURN(vmThread, rc);
+}
+
+#if defined(OMR_GC)
+typedef struct omrtiIterateHeapState {
+	OMR_TI_HeapObjectsCallback callback;
+	void *userData;
+} omrtiIterateHeapState;
+
+/**
+ * Callback used by omrtiIterateHeap with OMR_GC_IterateHeap.
+ * OMR_TI_HeapObject has the same layout as OMR_GC_HeapObject, so batches are passed on without copying.
+ */
+static void
+omrtiIterateHeapCallback(OMR_VMThread *omrVMThread, const OMR_GC_HeapObject *objects, uintptr_t objectCount, void *userData)
+{
+	omrtiIterateHeapState *state = (omrtiIterateHeapState *)userData;
+	state->callback(omrVMThread, (const OMR_TI_HeapObject *)objects, objectCount, state->userData);
+}
+#endif /* defined(OMR_GC) */
+
+omr_error_t
+omrtiIterateHeap(OMR_VMThread *vmThread, uintptr_t batchSize, OMR_TI_HeapObjectsCallback callback, void *userData)
+{
+	omr_error_t rc = OMR_ERROR_NONE;
+
+	/* The TI access mutex is not taken: it would be held while waiting for exclusive VM access,
+	 * and the callback may use other OMR_TI functions from the GC threads.
+	 */
+	if (NULL == vmThread) {
+		rc = OMR_THREAD_NOT_ATTACHED;
+	} else if ((0 == batchSize) || (NULL == callback)) {
+		rc = OMR_ERROR_ILLEGAL_ARGUMENT;
+	} else {
+#if defined(OMR_GC)
+		omrtiIterateHeapState state;
+		state.callback = callback;
+		state.userData = userData;
+		rc = OMR_GC_IterateHeap(vmThread, batchSize, omrtiIterateHeapCallback, &state);
+#else /* defined(OMR_GC) */
+		rc = OMR_ERROR_NOT_AVAILABLE;
+#endif /* defined(OMR_GC) */
+	}
+	return rc;
+}
@@ -62,6 +62,7 @@ omr_vmthread_init(OMR_VMThread *vmthread)
 {
 	omr_error_t rc = OMR_ERROR_NONE;
 
+	vmthread->_allocationSampleBytes = 0;
 	omrthread_monitor_init(&vmthread->threadNameMutex, 0);
 	if (NULL == vmthread->threadNameMutex) {
 		rc = OMR_ERROR_FAILED_TO_ALLOCATE_MONITOR;
@@ -233,6 +233,7 @@ omr_ras_cleanupTI(OMR_VM *vm)
 		if (0 != omrthread_monitor_destroy(vm->_omrTIAccessMutex)) {
 			rc = OMR_ERROR_INTERNAL;
 		}
+		vm->_omrTIAccessMutex = NULL;
 	}
 	return rc;
 }
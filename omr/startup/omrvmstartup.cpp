@@ -486,6 +486,7 @@ OMR_Shutdown_VM(OMR_VM *omrVM, OMR_VMThread *omrVMThread)
 #endif /* OMR_GC */
 
 #if defined(OMR_RAS_TDF_TRACE)
+		omr_ras_cleanupAllocationProfiler(omrVM);
 		omr_ras_cleanupMethodDictionary(omrVM);
 
 		omr_ras_cleanupHealthCenter(omrVM, &(omrVM->_hcAgent));
@@ -22,6 +22,7 @@
 
 #include <string.h>
 #include <algorithm>
+#include <string>
 #include <vector>
 #include <iterator>
 #include <numeric>
@@ -37,13 +38,70 @@ const char* XPATH_GET_ALL_MARK_TIME = "/verbosegc/gc-op[@type='mark']";
 const char* XPATH_GET_ALL_SWEEP_TIME = "/verbosegc/gc-op[@type='sweep']";
 const char* XPATH_GET_ALL_EXPAND_TIME = "/verbosegc/heap-resize[@type='expand']";
 const char* XPATH_GET_TOTAL_GC_TIME = "/verbosegc/gc-end[@type='global']";
+const char* XPATH_GET_ALL_MUTATOR_TIME = "/verbosegc/exclusive-start";
+const char* XPATH_GET_ALL_PAUSE_TIME = "/verbosegc/exclusive-end";
+const char* XPATH_GET_ALL_READ_BARRIER = "//read-barrier";
+const char* XPATH_GET_ALL_GC_END = "/verbosegc/gc-end";
 const char* SRC_DIR = "./";
 const char* VERBOSE_GC_FILE_PREFIX = "VerboseGC";
+const char* JSON_OPTION = "-json=";
+
+/**
+ * Figures reported for one benchmark, pooled over all of its runs, i.e. all verbose GC logs
+ * that share the benchmark name. Repeating a short run is how a configuration collects enough
+ * pauses for the upper percentiles to mean something.
+ */
+struct BenchmarkResult {
+	std::string name; /**< benchmark name, the verbose log name without prefix, pid and timestamp */
+	size_t runs; /**< number of verbose logs pooled into the figures */
+	std::vector<double> pauses; /**< every pause of every run in ms */
+	size_t gcCount; /**< number of gc-end stanzas */
+	size_t pauseCount; /**< number of exclusive access (stop-the-world) pauses */
+	double pauseTotal; /**< sum of all pauses in ms */
+	double pauseP50; /**< median pause in ms */
+	double pauseP90; /**< 90th percentile pause in ms */
+	double pauseP99; /**< 99th percentile pause in ms */
+	double pauseMax; /**< longest pause in ms */
+	double mutatorTime; /**< time between pauses in ms */
+	double mutatorThroughput; /**< share of elapsed time left to the mutator, in percent */
+	double gcCpuTime; /**< user plus system CPU time of all collections in ms */
+	double barrierCopies; /**< objects copied by the load barrier */
+	double barrierUpdates; /**< references updated by the load barrier */
+
+	BenchmarkResult()
+		: runs(0)
+		, gcCount(0)
+		, pauseCount(0)
+		, pauseTotal(0)
+		, pauseP50(0)
+		, pauseP90(0)
+		, pauseP99(0)
+		, pauseMax(0)
+		, mutatorTime(0)
+		, mutatorThroughput(0)
+		, gcCpuTime(0)
+		, barrierCopies(0)
+		, barrierUpdates(0)
+	{}
+};
 
 double getAvg(std::vector<double> v);
-void analyze(char* fileName, OMRPortLibrary portLibrary);
-
-int main(void)
+double getPercentile(std::vector<double> sorted, double percentile);
+bool hasPercentile(size_t samples, double percentile);
+void formatPercentile(char *buffer, size_t length, double value, size_t samples, double percentile, const char *unavailable);
+std::string getBenchmarkName(const char *fileName);
+void analyzePauses(pugi::xml_document &doc, BenchmarkResult &result);
+void summarizePauses(OMRPortLibrary portLibrary, BenchmarkResult &result);
+bool analyze(const char* fileName, OMRPortLibrary portLibrary, BenchmarkResult &result);
+bool writeJSON(const char *fileName, std::vector<BenchmarkResult> &results, OMRPortLibrary portLibrary);
+
+/**
+ * Analyze all verbose GC logs left in the current directory by the perfTest configurations.
+ * Logs of repeated runs of the same configuration are pooled into one benchmark result.
+ * With -json=<file>, the figures of every benchmark are also written to <file> as JSON, for
+ * tools that compare runs to catch GC regressions.
+ */
+int main(int argc, char *argv[])
 {
 	int32_t totalFiles = 0;
 	intptr_t rc = 0;
@@ -51,6 +109,18 @@ int main(void)
 	uintptr_t rcFile;
 	uintptr_t handle;
 	OMRPortLibrary portLibrary;
+	const char *jsonFile = NULL;
+	std::vector<std::string> fileNames;
+	std::vector<BenchmarkResult> results;
+
+	for (int i = 1; i < argc; i++) {
+		if (0 == strncmp(argv[i], JSON_OPTION, strlen(JSON_OPTION))) {
+			jsonFile = argv[i] + strlen(JSON_OPTION);
+		} else {
+			fprintf(stderr, "Unrecognized option %s\nUsage: %s [%s<file>]\n", argv[i], argv[0], JSON_OPTION);
+			return -1;
+		}
+	}
 
 	rc = omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT);
 	if (0 != rc) {
@@ -75,10 +145,7 @@ int main(void)
 
 	while ((uintptr_t)-1 != rcFile) {
 		if (strncmp(resultBuffer, VERBOSE_GC_FILE_PREFIX, strlen(VERBOSE_GC_FILE_PREFIX)) == 0) {
-			analyze(resultBuffer, portLibrary);
-			totalFiles++;
-			/* Clean up verbose log file */
-			omrfile_unlink(resultBuffer);
+			fileNames.push_back(resultBuffer);
 		}
 		rcFile = omrfile_findnext(handle, resultBuffer);
 	}
@@ -86,12 +153,41 @@ int main(void)
 		omrfile_findclose(handle);
 	}
 
+	/* report in a stable order so that runs can be compared */
+	std::sort(fileNames.begin(), fileNames.end());
+	for (std::vector<std::string>::const_iterator it = fileNames.begin(); it != fileNames.end(); ++it) {
+		std::string name = getBenchmarkName(it->c_str());
+		size_t i = 0;
+		while ((i < results.size()) && (results[i].name != name)) {
+			i++;
+		}
+		if (i == results.size()) {
+			results.push_back(BenchmarkResult());
+		}
+		if (!analyze(it->c_str(), portLibrary, results[i]) && (0 == results[i].runs)) {
+			results.pop_back();
+		}
+		totalFiles++;
+		/* Clean up verbose log file */
+		omrfile_unlink(it->c_str());
+	}
+
+	for (std::vector<BenchmarkResult>::iterator it = results.begin(); it != results.end(); ++it) {
+		summarizePauses(portLibrary, *it);
+	}
+
 	if(totalFiles < 1) {
 		omrtty_printf("Failed to find any verbose GC file to process!\n\n");
 	}
 
+	if ((NULL != jsonFile) && !writeJSON(jsonFile, results, portLibrary)) {
+		omrtty_printf("Failed to write results to %s\n", jsonFile);
+		rc = -1;
+	}
+
 	portLibrary.port_shutdown_library(&portLibrary);
 	omrthread_detach(NULL);
+	return (int)rc;
 }
 
 double
@@ -102,8 +198,190 @@ getAvg(std::vector<double> v)
 	return avg;
 }
 
+/**
+ * Nearest-rank percentile of an ascending sorted, non-empty vector.
+ */
+double
+getPercentile(std::vector<double> sorted, double percentile)
+{
+	size_t rank = (size_t)((percentile / 100.0) * sorted.size() + 0.5);
+	if (0 < rank) {
+		rank -= 1;
+	}
+	return sorted[std::min(rank, sorted.size() - 1)];
+}
+
+/**
+ * A percentile is only reported once there are enough samples for it to differ from the maximum,
+ * i.e. at least 10 samples for P90 and 100 samples for P99.
+ */
+bool
+hasPercentile(size_t samples, double percentile)
+{
+	return (0 < samples) && ((samples * (100.0 - percentile)) >= 100.0);
+}
+
+/**
+ * Print a percentile in ms, or unavailable when there are too few samples for it.
+ */
+void
+formatPercentile(char *buffer, size_t length, double value, size_t samples, double percentile, const char *unavailable)
+{
+	if (hasPercentile(samples, percentile)) {
+		snprintf(buffer, length, "%f", value);
+	} else {
+		snprintf(buffer, length, "%s", unavailable);
+	}
+}
+
+/**
+ * Name a benchmark after its verbose log, e.g. VerboseGC-gencon_tree_perf_1234_1700000000000.xml
+ * becomes gencon_tree_perf.
+ */
+std::string
+getBenchmarkName(const char *fileName)
+{
+	std::string name(fileName + strlen(VERBOSE_GC_FILE_PREFIX));
+	if (!name.empty() && (('-' == name[0]) || ('_' == name[0]))) {
+		name.erase(0, 1);
+	}
+	size_t extension = name.rfind(".xml");
+	if (std::string::npos != extension) {
+		name.erase(extension);
+	}
+	/* drop the _<pid>_<timestamp> suffix the test appends to the configured log name */
+	for (int i = 0; i < 2; i++) {
+		size_t separator = name.rfind('_');
+		if ((std::string::npos == separator) || (std::string::npos != name.find_first_not_of("0123456789", separator + 1))) {
+			break;
+		}
+		name.erase(separator);
+	}
+	return name;
+}
+
+/**
+ * Add the stop-the-world pauses, the time left to the mutator and the CPU time spent collecting in one run
+ * to the benchmark result, along with the work done by the load barrier during concurrent scavenge.
+ */
 void
-analyze(char* fileName, OMRPortLibrary portLibrary)
+analyzePauses(pugi::xml_document &doc, BenchmarkResult &result)
+{
+	pugi::xpath_node_set mutatorTimes = doc.select_nodes(XPATH_GET_ALL_MUTATOR_TIME);
+	for (pugi::xpath_node_set::const_iterator it = mutatorTimes.begin(); it != mutatorTimes.end(); ++it) {
+		result.mutatorTime += it->node().attribute("intervalms").as_double();
+	}
+
+	pugi::xpath_node_set pauseTimes = doc.select_nodes(XPATH_GET_ALL_PAUSE_TIME);
+	for (pugi::xpath_node_set::const_iterator it = pauseTimes.begin(); it != pauseTimes.end(); ++it) {
+		double value = it->node().attribute("durationms").as_double();
+		result.pauses.push_back(value);
+		result.pauseTotal += value;
+	}
+
+	pugi::xpath_node_set gcEnds = doc.select_nodes(XPATH_GET_ALL_GC_END);
+	for (pugi::xpath_node_set::const_iterator it = gcEnds.begin(); it != gcEnds.end(); ++it) {
+		result.gcCpuTime += it->node().attribute("usertimems").as_double() + it->node().attribute("systemtimems").as_double();
+	}
+	result.gcCount += gcEnds.size();
+
+	pugi::xpath_node_set readBarriers = doc.select_nodes(XPATH_GET_ALL_READ_BARRIER);
+	for (pugi::xpath_node_set::const_iterator it = readBarriers.begin(); it != readBarriers.end(); ++it) {
+		result.barrierCopies += it->node().attribute("copied").as_double();
+		result.barrierUpdates += it->node().attribute("updated").as_double();
+	}
+	result.runs += 1;
+}
+
+/**
+ * Report the distribution of stop-the-world pauses over all runs of a benchmark, the share of time left to
+ * the mutator and the CPU time spent collecting, which are the figures to compare across GC policies and
+ * releases. Percentiles that too few pauses cannot resolve are reported as n/a rather than as the maximum.
+ */
+void
+summarizePauses(OMRPortLibrary portLibrary, BenchmarkResult &result)
+{
+	char p90[32];
+	char p99[32];
+
+	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
+
+	omrtty_printf("\nResults for benchmark : %s (%zu runs)\n", result.name.c_str(), result.runs);
+	if (result.pauses.empty()) {
+		omrtty_printf("No pauses\n\n");
+		return;
+	}
+	std::sort(result.pauses.begin(), result.pauses.end());
+	result.pauseCount = result.pauses.size();
+	result.pauseP50 = getPercentile(result.pauses, 50);
+	result.pauseP90 = getPercentile(result.pauses, 90);
+	result.pauseP99 = getPercentile(result.pauses, 99);
+	result.pauseMax = result.pauses.back();
+	result.mutatorThroughput = (100.0 * result.mutatorTime) / (result.mutatorTime + result.pauseTotal);
+
+	formatPercentile(p90, sizeof(p90), result.pauseP90, result.pauseCount, 90, "n/a     ");
+	formatPercentile(p99, sizeof(p99), result.pauseP99, result.pauseCount, 99, "n/a     ");
+	omrtty_printf("Pauses  : count %zu   total %f ms   mutator throughput %f%%\n",
+						result.pauseCount, result.pauseTotal, result.mutatorThroughput);
+	omrtty_printf("            P50            P90            P99            Max\n");
+	omrtty_printf("-------------------------------------------------------------------\n");
+	omrtty_printf("Pause   : %f        %s        %s        %f\n",
+						result.pauseP50, p90, p99, result.pauseMax);
+	omrtty_printf("GC CPU  : %f ms in %zu collections\n", result.gcCpuTime, result.gcCount);
+	if (0 != result.barrierUpdates) {
+		omrtty_printf("Load barrier : %.0f objects copied, %.0f references updated\n", result.barrierCopies, result.barrierUpdates);
+	}
+	omrtty_printf("\n");
+}
+
+/**
+ * Write the results as a JSON document of the form
+ * {"benchmarks": [{"name": ..., "runs": ..., "pauseMs": {"p50": ..., ...}, ...}, ...]}.
+ * Percentiles that too few pauses cannot resolve are null. Benchmark names come from verbose
+ * log file names and need no escaping.
+ */
+bool
+writeJSON(const char *fileName, std::vector<BenchmarkResult> &results, OMRPortLibrary portLibrary)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
+
+	intptr_t fd = omrfile_open(fileName, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if (-1 == fd) {
+		return false;
+	}
+
+	omrfile_printf(fd, "{\n  \"benchmarks\": [");
+	for (size_t i = 0; i < results.size(); i++) {
+		BenchmarkResult &result = results[i];
+		char p90[32];
+		char p99[32];
+		double elapsedTime = result.mutatorTime + result.pauseTotal;
+		double gcCpuPercent = (0 < elapsedTime) ? ((100.0 * result.gcCpuTime) / elapsedTime) : 0;
+
+		omrfile_printf(fd, "%s\n    {\n", (0 == i) ? "" : ",");
+		omrfile_printf(fd, "      \"name\": \"%s\",\n", result.name.c_str());
+		omrfile_printf(fd, "      \"runs\": %zu,\n", result.runs);
+		omrfile_printf(fd, "      \"gcCount\": %zu,\n", result.gcCount);
+		omrfile_printf(fd, "      \"pauseCount\": %zu,\n", result.pauseCount);
+		formatPercentile(p90, sizeof(p90), result.pauseP90, result.pauseCount, 90, "null");
+		formatPercentile(p99, sizeof(p99), result.pauseP99, result.pauseCount, 99, "null");
+		omrfile_printf(fd, "      \"pauseMs\": {\"total\": %f, \"p50\": %f, \"p90\": %s, \"p99\": %s, \"max\": %f},\n",
+				result.pauseTotal, result.pauseP50, p90, p99, result.pauseMax);
+		omrfile_printf(fd, "      \"elapsedMs\": %f,\n", elapsedTime);
+		omrfile_printf(fd, "      \"mutatorThroughputPercent\": %f,\n", result.mutatorThroughput);
+		omrfile_printf(fd, "      \"gcCpuMs\": %f,\n", result.gcCpuTime);
+		/* may exceed 100 when several GC threads run in parallel */
+		omrfile_printf(fd, "      \"gcCpuPercent\": %f,\n", gcCpuPercent);
+		omrfile_printf(fd, "      \"loadBarrier\": {\"copied\": %.0f, \"updated\": %.0f}\n", result.barrierCopies, result.barrierUpdates);
+		omrfile_printf(fd, "    }");
+	}
+	omrfile_printf(fd, "\n  ]\n}\n");
+
+	return 0 == omrfile_close(fd);
+}
+
+bool
+analyze(const char* fileName, OMRPortLibrary portLibrary, BenchmarkResult &result)
 {
 	std::vector<double> mark_values;
 	std::vector<double> sweep_values;
@@ -132,15 +410,16 @@ analyze(char* fileName, OMRPortLibrary portLibrary)
 	double avgGCDuration = 0;
 
 	pugi::xml_document doc;
-	pugi::xml_parse_result result = doc.load_file(fileName);
+	pugi::xml_parse_result parseResult = doc.load_file(fileName);
 
 	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
-	if(!result) {
+	if(!parseResult) {
 		omrtty_printf("Error loading file : %s\n", fileName);
-		return;
+		return false;
 	} else {
 		omrtty_printf("\nResults for : %s\n",fileName);
 	}
+	result.name = getBenchmarkName(fileName);
 
 	markTimes = doc.select_nodes(XPATH_GET_ALL_MARK_TIME);
 	for (pugi::xpath_node_set::const_iterator it = markTimes.begin(); it != markTimes.end(); ++it) {
@@ -204,4 +483,7 @@ analyze(char* fileName, OMRPortLibrary portLibrary)
 
 	omrtty_printf("Average : %f        %f        %f        %f\n\n",
 								avgMark, avgSweep, avgExpand, avgGCDuration);
+
+	analyzePauses(doc, result);
+	return true;
 }
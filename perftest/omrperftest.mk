@@ -42,8 +42,12 @@ endif
 
 all: test
 	
+# Each perfTest configuration is repeated so that, pooled over the runs, even the configurations
+# with few pauses per run give the parser enough samples to report a P99 pause.
+PERF_GC_REPEAT ?= 20
+
 omr_perfgctest:
-	./omrgctest --gtest_filter="perfTest*" -keepVerboseLog
-	./omrperfgctest
+	./omrgctest --gtest_filter="perfTest*" --gtest_repeat=$(PERF_GC_REPEAT) -keepVerboseLog
+	./omrperfgctest -json=omrperfgctest-results.json
 
 .PHONY: all test omr_perfgctest 
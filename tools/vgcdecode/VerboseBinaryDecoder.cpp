@@ -0,0 +1,328 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#include <stdarg.h>
+#include <string.h>
+#include <time.h>
+
+#include "VerboseBinaryDecoder.hpp"
+
+#define INDENT_SPACER "  "
+#define UNKNOWN_STRING "unknown"
+
+static void
+displayUsage()
+{
+	fprintf(stderr, "Usage: vgcdecode <binary verbose log> [<xml output file>]\n");
+	fprintf(stderr, "  Converts a verbose GC log written with -Xgc:binaryLogging to verbosegc XML.\n");
+	fprintf(stderr, "  The XML is written to standard output when no output file is given.\n");
+}
+
+RCType
+startVerboseBinaryDecoder(int argc, char *argv[])
+{
+	if ((argc < 2) || (argc > 3)) {
+		displayUsage();
+		return RC_FAILED;
+	}
+
+	VerboseBinaryDecoder decoder;
+	if (RC_OK != decoder.load(argv[1])) {
+		fprintf(stderr, "vgcdecode: %s\n", decoder.getError());
+		return RC_FAILED;
+	}
+
+	std::string xml;
+	decoder.toXML(xml);
+
+	FILE *output = stdout;
+	if (3 == argc) {
+		output = fopen(argv[2], "w");
+		if (NULL == output) {
+			fprintf(stderr, "vgcdecode: cannot open %s for writing\n", argv[2]);
+			return RC_FAILED;
+		}
+	}
+
+	RCType rc = RC_OK;
+	if (xml.size() != fwrite(xml.data(), 1, xml.size(), output)) {
+		fprintf(stderr, "vgcdecode: failed to write the XML\n");
+		rc = RC_FAILED;
+	}
+	if (stdout != output) {
+		fclose(output);
+	}
+	return rc;
+}
+
+RCType
+VerboseBinaryDecoder::load(const char *fileName)
+{
+	_records.clear();
+	_strings.clear();
+	_gcVersion.clear();
+
+	FILE *input = fopen(fileName, "rb");
+	if (NULL == input) {
+		_error = std::string("cannot open ") + fileName;
+		return RC_FAILED;
+	}
+
+	RCType rc = RC_OK;
+	OMR_VerboseBinaryFileHeader header;
+	if ((1 != fread(&header, sizeof(header), 1, input))
+		|| (OMR_VERBOSE_BINARY_MAGIC != header.magic)
+	) {
+		_error = std::string(fileName) + " is not a binary verbose GC log";
+		rc = RC_FAILED;
+	} else if ((OMR_VERBOSE_BINARY_VERSION != header.version) || (sizeof(OMR_VerboseBinaryRecord) != header.recordSize)) {
+		_error = std::string(fileName) + " was written in an unsupported version of the binary format";
+		rc = RC_FAILED;
+	} else {
+		header.gcVersion[sizeof(header.gcVersion) - 1] = '\0';
+		_gcVersion = header.gcVersion;
+
+		/* a log being written, or cut short by a crash, may end in a partial record: stop before it */
+		OMR_VerboseBinaryRecord record;
+		while (1 == fread(&record, sizeof(record), 1, input)) {
+			if (OMR_VERBOSE_BINARY_RECORD_STRING == record.type) {
+				/* records may refer to a code before its definition, so the dictionary is built up front */
+				record.payload.string[sizeof(record.payload.string) - 1] = '\0';
+				_strings[record.code] = record.payload.string;
+			} else {
+				_records.push_back(record);
+			}
+		}
+	}
+
+	fclose(input);
+	return rc;
+}
+
+void
+VerboseBinaryDecoder::toXML(std::string &xml)
+{
+	xml.clear();
+	appendFormatted(xml, 0, "<?xml version=\"1.0\" ?>\n\n<verbosegc xmlns=\"http://www.ibm.com/j9/verbosegc\" version=\"%s\">\n", escape(_gcVersion.c_str()).c_str());
+
+	for (size_t index = 0; index < _records.size(); index++) {
+		const OMR_VerboseBinaryRecord *record = &_records[index];
+		const uint64_t *data = record->payload.data;
+		std::string timestamp = formatTimestamp(record->timestamp);
+		std::string type = escape(getString(record->code));
+		unsigned long long id = (unsigned long long)record->id;
+		unsigned long long contextId = (unsigned long long)record->contextId;
+
+		switch (record->type) {
+		case OMR_VERBOSE_BINARY_RECORD_CYCLE_START:
+			appendClockWarning(xml, record);
+			appendFormatted(xml, 0, "<cycle-start id=\"%llu\" type=\"%s\" contextid=\"%llu\" timestamp=\"%s\" intervalms=\"%llu.%03llu\" />",
+					id, type.c_str(), contextId, timestamp.c_str(),
+					(unsigned long long)(data[0] / 1000), (unsigned long long)(data[0] % 1000));
+			break;
+		case OMR_VERBOSE_BINARY_RECORD_CYCLE_END:
+			appendFormatted(xml, 0, "<cycle-end id=\"%llu\" type=\"%s\" contextid=\"%llu\" timestamp=\"%s\" />",
+					id, type.c_str(), contextId, timestamp.c_str());
+			appendFormatted(xml, 0, "");
+			break;
+		case OMR_VERBOSE_BINARY_RECORD_GC_START:
+		{
+			appendFormatted(xml, 0, "<gc-start id=\"%llu\" type=\"%s\" contextid=\"%llu\" timestamp=\"%s\">",
+					id, type.c_str(), contextId, timestamp.c_str());
+			const OMR_VerboseBinaryRecord *memoryInfo = nextMemoryInfo(&index);
+			if (NULL != memoryInfo) {
+				appendMemoryInfo(xml, 1, memoryInfo);
+			}
+			appendFormatted(xml, 0, "</gc-start>");
+			break;
+		}
+		case OMR_VERBOSE_BINARY_RECORD_GC_END:
+		{
+			appendClockWarning(xml, record);
+			appendFormatted(xml, 0, "<gc-end id=\"%llu\" type=\"%s\" contextid=\"%llu\" durationms=\"%llu.%03llu\" usertimems=\"%llu.%03llu\" systemtimems=\"%llu.%03llu\" stalltimems=\"%llu.%03llu\" timestamp=\"%s\" activeThreads=\"%llu\">",
+					id, type.c_str(), contextId,
+					(unsigned long long)(data[0] / 1000), (unsigned long long)(data[0] % 1000),
+					(unsigned long long)(data[1] / 1000), (unsigned long long)(data[1] % 1000),
+					(unsigned long long)(data[2] / 1000), (unsigned long long)(data[2] % 1000),
+					(unsigned long long)(data[3] / 1000), (unsigned long long)(data[3] % 1000),
+					timestamp.c_str(), (unsigned long long)data[4]);
+			const OMR_VerboseBinaryRecord *memoryInfo = nextMemoryInfo(&index);
+			if (NULL != memoryInfo) {
+				appendMemoryInfo(xml, 1, memoryInfo);
+			}
+			appendFormatted(xml, 0, "</gc-end>");
+			break;
+		}
+		case OMR_VERBOSE_BINARY_RECORD_MEM_INFO:
+			/* a heap snapshot whose increment record was lost to a full ring */
+			appendMemoryInfo(xml, 0, record);
+			break;
+		case OMR_VERBOSE_BINARY_RECORD_GC_OP:
+			appendClockWarning(xml, record);
+			if (0 != (OMR_VERBOSE_BINARY_FLAG_TRACE_INFO & record->flags)) {
+				appendFormatted(xml, 0, "<gc-op id=\"%llu\" type=\"%s\" timems=\"%llu.%03llu\" contextid=\"%llu\" timestamp=\"%s\">",
+						id, type.c_str(), (unsigned long long)(data[0] / 1000), (unsigned long long)(data[0] % 1000), contextId, timestamp.c_str());
+				appendFormatted(xml, 1, "<trace-info objectcount=\"%llu\" scancount=\"%llu\" scanbytes=\"%llu\" />",
+						(unsigned long long)data[1], (unsigned long long)data[2], (unsigned long long)data[3]);
+				appendFormatted(xml, 0, "</gc-op>");
+			} else {
+				appendFormatted(xml, 0, "<gc-op id=\"%llu\" type=\"%s\" timems=\"%llu.%03llu\" contextid=\"%llu\" timestamp=\"%s\" />",
+						id, type.c_str(), (unsigned long long)(data[0] / 1000), (unsigned long long)(data[0] % 1000), contextId, timestamp.c_str());
+			}
+			break;
+		case OMR_VERBOSE_BINARY_RECORD_HEAP_RESIZE:
+		{
+			uint64_t timeInMicroSeconds = data[OMR_VERBOSE_BINARY_RESIZE_TIME];
+			appendFormatted(xml, 0, "<heap-resize id=\"%llu\" type=\"%s\" space=\"%s\" amount=\"%llu\" count=\"%llu\" timems=\"%llu.%03llu\" reason=\"%s\" timestamp=\"%s\" />",
+					id, type.c_str(),
+					escape(getString((uint32_t)data[OMR_VERBOSE_BINARY_RESIZE_SPACE])).c_str(),
+					(unsigned long long)data[OMR_VERBOSE_BINARY_RESIZE_AMOUNT],
+					(unsigned long long)data[OMR_VERBOSE_BINARY_RESIZE_COUNT],
+					(unsigned long long)(timeInMicroSeconds / 1000), (unsigned long long)(timeInMicroSeconds % 1000),
+					escape(getString((uint32_t)data[OMR_VERBOSE_BINARY_RESIZE_REASON])).c_str(),
+					timestamp.c_str());
+			break;
+		}
+		case OMR_VERBOSE_BINARY_RECORD_DROPPED:
+			appendFormatted(xml, 0, "<warning details=\"%llu verbose records dropped by the binary writer\" timestamp=\"%s\" />",
+					(unsigned long long)data[0], timestamp.c_str());
+			break;
+		default:
+			/* a record type from a newer writer: skip it, the rest of the log is still readable */
+			break;
+		}
+	}
+
+	appendFormatted(xml, 0, "</verbosegc>");
+}
+
+const OMR_VerboseBinaryRecord *
+VerboseBinaryDecoder::nextMemoryInfo(size_t *index) const
+{
+	size_t next = *index + 1;
+	if ((next < _records.size()) && (OMR_VERBOSE_BINARY_RECORD_MEM_INFO == _records[next].type)) {
+		*index = next;
+		return &_records[next];
+	}
+	return NULL;
+}
+
+void
+VerboseBinaryDecoder::appendMemoryInfo(std::string &xml, uintptr_t indent, const OMR_VerboseBinaryRecord *record)
+{
+	const uint64_t *data = record->payload.data;
+	uint64_t free = data[OMR_VERBOSE_BINARY_MEM_FREE];
+	uint64_t total = data[OMR_VERBOSE_BINARY_MEM_TOTAL];
+
+	appendFormatted(xml, indent, "<mem-info id=\"%llu\" free=\"%llu\" total=\"%llu\" percent=\"%llu\">",
+			(unsigned long long)record->id, (unsigned long long)free, (unsigned long long)total,
+			(unsigned long long)((0 == total) ? 0 : ((free * 100) / total)));
+	if (0 != (OMR_VERBOSE_BINARY_FLAG_NURSERY & record->flags)) {
+		free = data[OMR_VERBOSE_BINARY_MEM_NURSERY_FREE];
+		total = data[OMR_VERBOSE_BINARY_MEM_NURSERY_TOTAL];
+		appendFormatted(xml, indent + 1, "<mem type=\"nursery\" free=\"%llu\" total=\"%llu\" percent=\"%llu\" />",
+				(unsigned long long)free, (unsigned long long)total, (unsigned long long)((0 == total) ? 0 : ((free * 100) / total)));
+	}
+	free = data[OMR_VERBOSE_BINARY_MEM_TENURE_FREE];
+	total = data[OMR_VERBOSE_BINARY_MEM_TENURE_TOTAL];
+	appendFormatted(xml, indent + 1, "<mem type=\"tenure\" free=\"%llu\" total=\"%llu\" percent=\"%llu\" />",
+			(unsigned long long)free, (unsigned long long)total, (unsigned long long)((0 == total) ? 0 : ((free * 100) / total)));
+	appendFormatted(xml, indent, "</mem-info>");
+}
+
+void
+VerboseBinaryDecoder::appendClockWarning(std::string &xml, const OMR_VerboseBinaryRecord *record)
+{
+	if (0 != (OMR_VERBOSE_BINARY_FLAG_CLOCK_ERROR & record->flags)) {
+		appendFormatted(xml, 0, "<warning details=\"clock error detected, following timing may be inaccurate\" />");
+	}
+}
+
+const char *
+VerboseBinaryDecoder::getString(uint32_t code) const
+{
+	std::map<uint32_t, std::string>::const_iterator entry = _strings.find(code);
+	if (_strings.end() == entry) {
+		return UNKNOWN_STRING;
+	}
+	return entry->second.c_str();
+}
+
+std::string
+VerboseBinaryDecoder::escape(const char *text)
+{
+	std::string escaped;
+	for (; '\0' != *text; text++) {
+		switch (*text) {
+		case '&':
+			escaped += "&amp;";
+			break;
+		case '<':
+			escaped += "&lt;";
+			break;
+		case '>':
+			escaped += "&gt;";
+			break;
+		case '"':
+			escaped += "&quot;";
+			break;
+		default:
+			escaped += *text;
+			break;
+		}
+	}
+	return escaped;
+}
+
+std::string
+VerboseBinaryDecoder::formatTimestamp(uint64_t wallTimeMillis)
+{
+	/* the text writers' format, in the local time of the machine decoding the log */
+	time_t seconds = (time_t)(wallTimeMillis / 1000);
+	struct tm localTime;
+	char buffer[64] = "";
+#if defined(OMR_OS_WINDOWS)
+	localtime_s(&localTime, &seconds);
+#else /* defined(OMR_OS_WINDOWS) */
+	localtime_r(&seconds, &localTime);
+#endif /* defined(OMR_OS_WINDOWS) */
+	size_t length = strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%S.", &localTime);
+	snprintf(buffer + length, sizeof(buffer) - length, "%03llu", (unsigned long long)(wallTimeMillis % 1000));
+	return buffer;
+}
+
+void
+VerboseBinaryDecoder::appendFormatted(std::string &xml, uintptr_t indent, const char *format, ...)
+{
+	char buffer[1024];
+	va_list args;
+
+	for (uintptr_t i = 0; i < indent; i++) {
+		xml += INDENT_SPACER;
+	}
+	va_start(args, format);
+	vsnprintf(buffer, sizeof(buffer), format, args);
+	va_end(args);
+	xml += buffer;
+	xml += "\n";
+}
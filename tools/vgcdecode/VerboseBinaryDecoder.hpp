@@ -0,0 +1,95 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#ifndef VERBOSEBINARYDECODER_HPP_
+#define VERBOSEBINARYDECODER_HPP_
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "VerboseBinaryFormat.h"
+
+typedef enum RCType {
+	RC_OK = 0,
+	RC_FAILED = -1,
+	RCType_EnsureWideEnum = 0x1000000 /* force 4-byte enum */
+} RCType;
+
+RCType startVerboseBinaryDecoder(int argc, char *argv[]);
+
+/**
+ * Converts a binary verbose GC log (-Xgc:binaryLogging) into the verbosegc XML the text writers produce.
+ */
+class VerboseBinaryDecoder
+{
+	/*
+	 * Data members
+	 */
+private:
+	std::string _gcVersion; /**< version attribute of the verbosegc element */
+	std::vector<OMR_VerboseBinaryRecord> _records; /**< every record in the log, dictionary entries included */
+	std::map<uint32_t, std::string> _strings; /**< the dictionary, by code */
+	std::string _error; /**< why the last call failed */
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	const char *getString(uint32_t code) const;
+	static std::string escape(const char *text);
+	static std::string formatTimestamp(uint64_t wallTimeMillis);
+	static void appendFormatted(std::string &xml, uintptr_t indent, const char *format, ...);
+
+	void appendMemoryInfo(std::string &xml, uintptr_t indent, const OMR_VerboseBinaryRecord *record);
+	void appendClockWarning(std::string &xml, const OMR_VerboseBinaryRecord *record);
+
+	/**
+	 * Answer the MEM_INFO record nested in the GC_START or GC_END at index, stepping index past it, or NULL.
+	 */
+	const OMR_VerboseBinaryRecord *nextMemoryInfo(size_t *index) const;
+
+protected:
+public:
+	/**
+	 * Read a binary log, replacing anything read before.
+	 * @param[in] fileName the log to read
+	 * @return RC_OK on success, RC_FAILED if the file cannot be read or is not a binary verbose log
+	 */
+	RCType load(const char *fileName);
+
+	/**
+	 * Convert the records read by load() into verbosegc XML.
+	 * @param[out] xml the document
+	 */
+	void toXML(std::string &xml);
+
+	const char *getError() const {return _error.c_str();}
+};
+
+#endif /* VERBOSEBINARYDECODER_HPP_ */